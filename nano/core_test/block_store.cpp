@@ -10,9 +10,11 @@
 #include <nano/secure/utility.hpp>
 #include <nano/store/account.hpp>
 #include <nano/store/block.hpp>
+#include <nano/store/confirmation_height.hpp>
 #include <nano/store/lmdb/lmdb.hpp>
 #include <nano/store/rocksdb/rocksdb.hpp>
 #include <nano/store/versioning.hpp>
+#include <nano/store/views.hpp>
 #include <nano/test_common/system.hpp>
 #include <nano/test_common/testutil.hpp>
 
@@ -131,6 +133,55 @@ TEST (block_store, add_item)
 	ASSERT_EQ (nullptr, latest3);
 }
 
+TEST (block_store, get_serialized)
+{
+	nano::logger_mt logger;
+	auto store = nano::make_store (logger, nano::unique_path (), nano::dev::constants);
+	ASSERT_TRUE (!store->init_error ());
+	nano::keypair key1;
+	nano::block_builder builder;
+	auto block1 = builder
+				  .open ()
+				  .source (0)
+				  .representative (1)
+				  .account (key1.pub)
+				  .sign (key1.prv, key1.pub)
+				  .work (0)
+				  .build ();
+	block1->sideband_set ({});
+	auto block2 = builder
+				  .change ()
+				  .previous (block1->hash ())
+				  .representative (2)
+				  .sign (key1.prv, key1.pub)
+				  .work (0)
+				  .build ();
+	block2->sideband_set ({});
+	auto transaction (store->tx_begin_write ());
+	store->block.put (transaction, block1->hash (), *block1);
+	store->block.put (transaction, block2->hash (), *block2);
+
+	std::vector<uint8_t> expected;
+	{
+		nano::vectorstream stream{ expected };
+		nano::serialize_block (stream, *block1);
+		nano::serialize_block (stream, *block2);
+	}
+
+	// Successive blocks are appended in network serialization and successors are taken from the sideband
+	std::vector<uint8_t> buffer;
+	auto successor1 = store->block.get_serialized (transaction, block1->hash (), buffer);
+	ASSERT_TRUE (successor1);
+	ASSERT_EQ (block2->hash (), *successor1);
+	auto successor2 = store->block.get_serialized (transaction, *successor1, buffer);
+	ASSERT_TRUE (successor2);
+	ASSERT_TRUE (successor2->is_zero ());
+	ASSERT_EQ (expected, buffer);
+
+	ASSERT_FALSE (store->block.get_serialized (transaction, nano::block_hash{ 1 }, buffer));
+	ASSERT_EQ (expected, buffer);
+}
+
 TEST (block_store, clear_successor)
 {
 	nano::logger_mt logger;
@@ -324,6 +375,53 @@ TEST (block_store, pending_iterator)
 	ASSERT_EQ (nano::epoch::epoch_1, pending.epoch);
 }
 
+TEST (block_store, view_iterator)
+{
+	nano::logger_mt logger;
+	auto store = nano::make_store (logger, nano::unique_path (), nano::dev::constants);
+	ASSERT_TRUE (!store->init_error ());
+	auto transaction (store->tx_begin_write ());
+	nano::account_info info1{ 1, 2, 3, 4, 5, 6, nano::epoch::epoch_1 };
+	nano::account_info info2{ 7, 8, 9, 10, 11, 12, nano::epoch::epoch_2 };
+	store->account.put (transaction, nano::account (1), info1);
+	store->account.put (transaction, nano::account (2), info2);
+	store->pending.put (transaction, nano::pending_key (3, 4), { 5, 6, nano::epoch::epoch_1 });
+	store->confirmation_height.put (transaction, nano::account (1), { 7, nano::block_hash (8) });
+
+	nano::store::view_iterator<nano::account, nano::account_info> i{ store->account.begin (transaction) };
+	auto const n (store->account.end ());
+	for (auto [account, info] : { std::make_pair (nano::account (1), info1), std::make_pair (nano::account (2), info2) })
+	{
+		ASSERT_TRUE (i != n);
+		ASSERT_EQ (account, i.view ().key_as<nano::account> ());
+		nano::store::account_info_view const view (i.view ().value);
+		ASSERT_EQ (info.head, view.head ());
+		ASSERT_EQ (info.representative, view.representative ());
+		ASSERT_EQ (info.open_block, view.open_block ());
+		ASSERT_EQ (info.balance, view.balance ());
+		ASSERT_EQ (info.modified, view.modified ());
+		ASSERT_EQ (info.block_count, view.block_count ());
+		ASSERT_EQ (info.epoch (), view.epoch ());
+		ASSERT_EQ (std::make_pair (account, info), i.entry ());
+		++i;
+	}
+	ASSERT_TRUE (i == n);
+
+	nano::store::view_iterator<nano::pending_key, nano::pending_info> pending{ store->pending.begin (transaction) };
+	ASSERT_TRUE (pending != store->pending.end ());
+	ASSERT_EQ (nano::pending_key (3, 4), pending.view ().key_as<nano::pending_key> ());
+	nano::store::pending_info_view const pending_view (pending.view ().value);
+	ASSERT_EQ (nano::account (5), pending_view.source ());
+	ASSERT_EQ (nano::amount (6), pending_view.amount ());
+	ASSERT_EQ (nano::epoch::epoch_1, pending_view.epoch ());
+
+	nano::store::view_iterator<nano::account, nano::confirmation_height_info> confirmation_height{ store->confirmation_height.begin (transaction) };
+	ASSERT_TRUE (confirmation_height != store->confirmation_height.end ());
+	nano::store::confirmation_height_info_view const confirmation_height_view (confirmation_height.view ().value);
+	ASSERT_EQ (7, confirmation_height_view.height ());
+	ASSERT_EQ (nano::block_hash (8), confirmation_height_view.frontier ());
+}
+
 /**
  * Regression test for Issue 1164
  * This reconstructs the situation where a key is larger in pending than the account being iterated in pending_v1, leaving
@@ -437,11 +535,7 @@ TEST (block_store, empty_bootstrap)
 	nano::test::system system{};
 	nano::logger_mt logger;
 	nano::unchecked_map unchecked{ system.stats, false };
-	size_t count = 0;
-	unchecked.for_each ([&count] (nano::unchecked_key const & key, nano::unchecked_info const & info) {
-		++count;
-	});
-	ASSERT_EQ (count, 0);
+	ASSERT_TRUE (unchecked.list ().empty ());
 }
 
 TEST (block_store, unchecked_begin_search)
@@ -688,6 +782,45 @@ TEST (mdb_block_store, bad_path)
 	ASSERT_TRUE (false);
 }
 
+TEST (mdb_block_store, read_transaction_pool)
+{
+	if (nano::rocksdb_config::using_rocksdb_in_tests ())
+	{
+		// Don't test this in rocksdb mode
+		GTEST_SKIP ();
+	}
+	nano::logger_mt logger;
+	nano::lmdb_config config;
+	config.read_transaction_pool_size = 1;
+	nano::store::lmdb::component store (logger, nano::unique_path () / "data.ldb", nano::dev::constants, nano::txn_tracking_config{}, std::chrono::milliseconds (5000), config);
+	ASSERT_FALSE (store.init_error ());
+	nano::keypair key;
+	void * handle{ nullptr };
+	{
+		auto transaction = store.tx_begin_read ();
+		handle = transaction.get_handle ();
+		ASSERT_FALSE (store.account.exists (transaction, key.pub));
+	}
+	nano::account_info info{ 1, 2, 3, 4, 5, 6, nano::epoch::epoch_0 };
+	store.account.put (store.tx_begin_write (), key.pub, info);
+	{
+		// The finished transaction is renewed and sees the latest commit
+		auto transaction = store.tx_begin_read ();
+		ASSERT_EQ (handle, transaction.get_handle ());
+		ASSERT_TRUE (store.account.exists (transaction, key.pub));
+		// The pool is empty, concurrent readers begin their own transaction
+		auto transaction2 = store.tx_begin_read ();
+		ASSERT_NE (handle, transaction2.get_handle ());
+		ASSERT_TRUE (store.account.exists (transaction2, key.pub));
+	}
+	{
+		auto transaction = store.tx_begin_read ();
+		transaction.reset ();
+		transaction.renew ();
+		ASSERT_TRUE (store.account.exists (transaction, key.pub));
+	}
+}
+
 TEST (block_store, DISABLED_already_open) // File can be shared
 {
 	auto path (nano::unique_path ());
@@ -1398,6 +1531,62 @@ TEST (mdb_block_store, upgrade_v21_v22)
 	// Testing the upgrade code worked
 	check_correct_state ();
 }
+
+TEST (mdb_block_store, upgrade_v22_v23)
+{
+	if (nano::rocksdb_config::using_rocksdb_in_tests ())
+	{
+		// Don't test this in rocksdb mode
+		GTEST_SKIP ();
+	}
+
+	auto path (nano::unique_path () / "data.ldb");
+	nano::logger_mt logger;
+	// Setting the database to its 22nd version state, which has no delegators table
+	{
+		nano::store::lmdb::component store (logger, path, nano::dev::constants);
+		auto transaction (store.tx_begin_write ());
+		ASSERT_FALSE (mdb_drop (store.env.tx (transaction), store.delegator_store.delegators_handle, 1));
+		store.version.put (transaction, 22);
+	}
+
+	// Testing the upgrade created an empty delegators table
+	nano::store::lmdb::component store (logger, path, nano::dev::constants);
+	ASSERT_FALSE (store.init_error ());
+	auto transaction (store.tx_begin_read ());
+	ASSERT_EQ (store.version.get (transaction), store.version_current);
+	MDB_dbi delegators_handle{ 0 };
+	ASSERT_FALSE (mdb_dbi_open (store.env.tx (transaction), "delegators", 0, &delegators_handle));
+	ASSERT_EQ (store.delegator.end (), store.delegator.begin (transaction));
+}
+
+TEST (mdb_block_store, upgrade_v23_v24)
+{
+	if (nano::rocksdb_config::using_rocksdb_in_tests ())
+	{
+		// Don't test this in rocksdb mode
+		GTEST_SKIP ();
+	}
+
+	auto path (nano::unique_path () / "data.ldb");
+	nano::logger_mt logger;
+	// Setting the database to its 23rd version state, which has no receivable amounts table
+	{
+		nano::store::lmdb::component store (logger, path, nano::dev::constants);
+		auto transaction (store.tx_begin_write ());
+		ASSERT_FALSE (mdb_drop (store.env.tx (transaction), store.receivable_amount_store.receivable_amounts_handle, 1));
+		store.version.put (transaction, 23);
+	}
+
+	// Testing the upgrade created an empty receivable amounts table
+	nano::store::lmdb::component store (logger, path, nano::dev::constants);
+	ASSERT_FALSE (store.init_error ());
+	auto transaction (store.tx_begin_read ());
+	ASSERT_EQ (store.version.get (transaction), store.version_current);
+	MDB_dbi receivable_amounts_handle{ 0 };
+	ASSERT_FALSE (mdb_dbi_open (store.env.tx (transaction), "receivable_amounts", 0, &receivable_amounts_handle));
+	ASSERT_EQ (store.receivable_amount.end (), store.receivable_amount.begin (transaction));
+}
 }
 
 namespace nano::store::rocksdb
@@ -0,0 +1,157 @@
+#include <nano/lib/blocks.hpp>
+#include <nano/node/block_stream.hpp>
+#include <nano/secure/utility.hpp>
+#include <nano/store/component.hpp>
+#include <nano/test_common/ledger.hpp>
+#include <nano/test_common/testutil.hpp>
+
+#include <gtest/gtest.h>
+
+// Chains of two accounts which depend on each other must be interleaved in the stream
+TEST (block_stream, export_import)
+{
+	nano::work_pool pool{ nano::dev::network_params.network, std::numeric_limits<unsigned>::max () };
+	nano::block_builder builder;
+	nano::keypair key;
+	auto send1 = builder.state ()
+				 .account (nano::dev::genesis_key.pub)
+				 .previous (nano::dev::genesis->hash ())
+				 .representative (nano::dev::genesis_key.pub)
+				 .balance (nano::dev::constants.genesis_amount - 100)
+				 .link (key.pub)
+				 .sign (nano::dev::genesis_key.prv, nano::dev::genesis_key.pub)
+				 .work (*pool.generate (nano::dev::genesis->hash ()))
+				 .build_shared ();
+	auto open = builder.state ()
+				.account (key.pub)
+				.previous (0)
+				.representative (key.pub)
+				.balance (100)
+				.link (send1->hash ())
+				.sign (key.prv, key.pub)
+				.work (*pool.generate (key.pub))
+				.build_shared ();
+	auto send2 = builder.state ()
+				 .account (key.pub)
+				 .previous (open->hash ())
+				 .representative (key.pub)
+				 .balance (50)
+				 .link (nano::dev::genesis_key.pub)
+				 .sign (key.prv, key.pub)
+				 .work (*pool.generate (open->hash ()))
+				 .build_shared ();
+	auto receive = builder.state ()
+				   .account (nano::dev::genesis_key.pub)
+				   .previous (send1->hash ())
+				   .representative (nano::dev::genesis_key.pub)
+				   .balance (nano::dev::constants.genesis_amount - 50)
+				   .link (send2->hash ())
+				   .sign (nano::dev::genesis_key.prv, nano::dev::genesis_key.pub)
+				   .work (*pool.generate (send1->hash ()))
+				   .build_shared ();
+	nano::test::context::ledger_context source{ { send1, open, send2, receive } };
+	auto path = nano::unique_path () / "blocks.dat";
+	std::filesystem::create_directories (path.parent_path ());
+	uint64_t count{ 0 };
+	ASSERT_FALSE (nano::block_stream::export_ledger (source.ledger (), nano::networks::nano_dev_network, path, count));
+	ASSERT_EQ (4, count);
+
+	auto target = nano::test::context::ledger_empty ();
+	auto result = nano::block_stream::import_ledger (target.ledger (), nano::networks::nano_dev_network, path, 2, 3);
+	ASSERT_FALSE (result.error);
+	ASSERT_EQ (4, result.processed);
+	ASSERT_EQ (4, result.progress);
+	ASSERT_EQ (0, result.invalid);
+	ASSERT_EQ (0, result.rejected);
+	ASSERT_EQ (5, target.ledger ().cache.block_count);
+	ASSERT_TRUE (target.ledger ().block_or_pruned_exists (receive->hash ()));
+
+	// Importing the same stream again is harmless
+	auto again = nano::block_stream::import_ledger (target.ledger (), nano::networks::nano_dev_network, path, 2);
+	ASSERT_FALSE (again.error);
+	ASSERT_EQ (4, again.old);
+
+	// Streams from another network are refused
+	auto mismatch = nano::block_stream::import_ledger (target.ledger (), nano::networks::nano_live_network, path, 2);
+	ASSERT_TRUE (mismatch.error);
+	ASSERT_EQ (0, mismatch.processed);
+}
+
+// Epoch opens have no source block, they must still follow a send to their account
+TEST (block_stream, epoch_open)
+{
+	nano::work_pool pool{ nano::dev::network_params.network, std::numeric_limits<unsigned>::max () };
+	nano::block_builder builder;
+	// Accounts sorting before genesis are exported before the genesis chain holding their sends
+	auto key_before_genesis = [] () {
+		nano::keypair key;
+		while (!(key.pub < nano::dev::genesis_key.pub))
+		{
+			key = nano::keypair{};
+		}
+		return key;
+	};
+	auto key1 = key_before_genesis ();
+	auto key2 = key_before_genesis ();
+	auto send1 = builder.state ()
+				 .account (nano::dev::genesis_key.pub)
+				 .previous (nano::dev::genesis->hash ())
+				 .representative (nano::dev::genesis_key.pub)
+				 .balance (nano::dev::constants.genesis_amount - 100)
+				 .link (key1.pub)
+				 .sign (nano::dev::genesis_key.prv, nano::dev::genesis_key.pub)
+				 .work (*pool.generate (nano::dev::genesis->hash ()))
+				 .build_shared ();
+	auto send2 = builder.state ()
+				 .account (nano::dev::genesis_key.pub)
+				 .previous (send1->hash ())
+				 .representative (nano::dev::genesis_key.pub)
+				 .balance (nano::dev::constants.genesis_amount - 200)
+				 .link (key2.pub)
+				 .sign (nano::dev::genesis_key.prv, nano::dev::genesis_key.pub)
+				 .work (*pool.generate (send1->hash ()))
+				 .build_shared ();
+	auto epoch1 = builder.state ()
+				  .account (key1.pub)
+				  .previous (0)
+				  .representative (0)
+				  .balance (0)
+				  .link (nano::dev::constants.epochs.link (nano::epoch::epoch_1))
+				  .sign (nano::dev::genesis_key.prv, nano::dev::genesis_key.pub)
+				  .work (*pool.generate (key1.pub))
+				  .build_shared ();
+	auto receive1 = builder.state ()
+					.account (key1.pub)
+					.previous (epoch1->hash ())
+					.representative (key1.pub)
+					.balance (100)
+					.link (send1->hash ())
+					.sign (key1.prv, key1.pub)
+					.work (*pool.generate (epoch1->hash ()))
+					.build_shared ();
+	// Opened by an epoch block while its send is still receivable
+	auto epoch2 = builder.state ()
+				  .account (key2.pub)
+				  .previous (0)
+				  .representative (0)
+				  .balance (0)
+				  .link (nano::dev::constants.epochs.link (nano::epoch::epoch_1))
+				  .sign (nano::dev::genesis_key.prv, nano::dev::genesis_key.pub)
+				  .work (*pool.generate (key2.pub))
+				  .build_shared ();
+	nano::test::context::ledger_context source{ { send1, send2, epoch1, receive1, epoch2 } };
+	auto path = nano::unique_path () / "blocks.dat";
+	std::filesystem::create_directories (path.parent_path ());
+	uint64_t count{ 0 };
+	ASSERT_FALSE (nano::block_stream::export_ledger (source.ledger (), nano::networks::nano_dev_network, path, count));
+	ASSERT_EQ (5, count);
+
+	auto target = nano::test::context::ledger_empty ();
+	auto result = nano::block_stream::import_ledger (target.ledger (), nano::networks::nano_dev_network, path, 2);
+	ASSERT_FALSE (result.error);
+	ASSERT_EQ (5, result.progress);
+	ASSERT_EQ (0, result.rejected);
+	ASSERT_EQ (6, target.ledger ().cache.block_count);
+	ASSERT_TRUE (target.ledger ().block_or_pruned_exists (receive1->hash ()));
+	ASSERT_TRUE (target.ledger ().block_or_pruned_exists (epoch2->hash ()));
+}
@@ -280,6 +280,107 @@ TEST (bulk_pull, count_limit)
 	ASSERT_EQ (nullptr, block);
 }
 
+// Chains longer than one batch are sent in order across several writes, ending at `end` or after `count` blocks, followed by not_a_block
+TEST (bulk_pull, send_batches)
+{
+	nano::test::system system (1);
+	auto node = system.nodes[0];
+	std::vector<std::shared_ptr<nano::block>> chain{ nano::dev::genesis };
+	nano::block_builder builder;
+	for (auto i = 0u; i < nano::bulk_pull_server::max_batch_blocks + 50; ++i)
+	{
+		auto send = builder
+					.send ()
+					.previous (chain.back ()->hash ())
+					.destination (nano::dev::genesis_key.pub)
+					.balance (nano::dev::constants.genesis_amount - i - 1)
+					.sign (nano::dev::genesis_key.prv, nano::dev::genesis_key.pub)
+					.work (*system.work.generate (chain.back ()->hash ()))
+					.build_shared ();
+		ASSERT_EQ (nano::process_result::progress, node->process (*send).code);
+		chain.push_back (send);
+	}
+
+	// Serves `request` to a plain socket and collects the hashes of the blocks received before not_a_block
+	auto pull = [&] (std::unique_ptr<nano::bulk_pull> request, std::vector<nano::block_hash> & hashes) {
+		boost::asio::ip::tcp::acceptor acceptor (system.io_ctx, boost::asio::ip::tcp::endpoint (boost::asio::ip::address_v6::loopback (), system.get_available_port ()));
+		boost::asio::ip::tcp::socket peer (system.io_ctx);
+		acceptor.async_accept (peer, [] (boost::system::error_code const & ec) {
+			EXPECT_FALSE (ec);
+		});
+		auto socket = std::make_shared<nano::transport::client_socket> (*node);
+		std::atomic<bool> connected{ false };
+		socket->async_connect (acceptor.local_endpoint (), [&connected] (boost::system::error_code const & ec) {
+			EXPECT_FALSE (ec);
+			connected = true;
+		});
+		ASSERT_TIMELY (5s, connected);
+
+		std::vector<uint8_t> received;
+		std::array<uint8_t, 4096> buffer;
+		std::function<void ()> read = [&] () {
+			peer.async_read_some (boost::asio::buffer (buffer), [&] (boost::system::error_code const & ec, std::size_t size) {
+				if (!ec)
+				{
+					received.insert (received.end (), buffer.begin (), buffer.begin () + size);
+					read ();
+				}
+			});
+		};
+		read ();
+		auto finished = [&] () {
+			hashes.clear ();
+			nano::bufferstream stream{ received.data (), received.size () };
+			nano::block_type type;
+			while (!nano::try_read (stream, type))
+			{
+				if (type == nano::block_type::not_a_block)
+				{
+					return true;
+				}
+				auto block = nano::deserialize_block (stream, type);
+				if (block == nullptr)
+				{
+					return false;
+				}
+				hashes.push_back (block->hash ());
+			}
+			return false;
+		};
+
+		auto connection = std::make_shared<nano::transport::tcp_server> (socket, node);
+		auto server = std::make_shared<nano::bulk_pull_server> (connection, std::move (request));
+		server->send_next ();
+		ASSERT_TIMELY (10s, finished ());
+		// Nothing follows the terminator
+		ASSERT_EQ (static_cast<uint8_t> (nano::block_type::not_a_block), received.back ());
+		peer.close ();
+	};
+
+	// Pulling down to `end` excludes it
+	auto request = std::make_unique<nano::bulk_pull> (nano::dev::network_params.network);
+	request->start = nano::dev::genesis_key.pub;
+	request->end = chain[10]->hash ();
+	std::vector<nano::block_hash> hashes;
+	pull (std::move (request), hashes);
+	std::vector<nano::block_hash> expected;
+	for (auto i = chain.size () - 1; i > 10; --i)
+	{
+		expected.push_back (chain[i]->hash ());
+	}
+	ASSERT_GT (expected.size (), nano::bulk_pull_server::max_batch_blocks);
+	ASSERT_EQ (expected, hashes);
+
+	// A count stops the pull after that many blocks, even within the second batch
+	request = std::make_unique<nano::bulk_pull> (nano::dev::network_params.network);
+	request->start = nano::dev::genesis_key.pub;
+	request->set_count_present (true);
+	request->count = nano::bulk_pull_server::max_batch_blocks + 10;
+	pull (std::move (request), hashes);
+	expected.resize (nano::bulk_pull_server::max_batch_blocks + 10);
+	ASSERT_EQ (expected, hashes);
+}
+
 TEST (bootstrap_processor, DISABLED_process_none)
 {
 	nano::test::system system (1);
@@ -1,11 +1,16 @@
 #include <nano/lib/stats.hpp>
+#include <nano/node/bootstrap_ascending/peer_scoring.hpp>
 #include <nano/node/bootstrap_ascending/service.hpp>
 #include <nano/node/make_store.hpp>
+#include <nano/node/node.hpp>
+#include <nano/node/transport/fake.hpp>
 #include <nano/test_common/system.hpp>
 #include <nano/test_common/testutil.hpp>
 
 #include <gtest/gtest.h>
 
+#include <fstream>
+
 using namespace std::chrono_literals;
 
 namespace
@@ -149,6 +154,121 @@ TEST (account_sets, saturate_priority)
 	ASSERT_EQ (sets.priority (account), nano::bootstrap_ascending::account_sets::priority_max);
 }
 
+/*
+ * Priorities and blocked accounts survive a serialization roundtrip, timestamps are reset
+ */
+TEST (account_sets, serialize)
+{
+	nano::stats stats;
+	nano::bootstrap_ascending::account_sets sets{ stats };
+	nano::account prioritized{ 1 };
+	nano::account blocked{ 2 };
+	nano::account blocked_prioritized{ 3 };
+	auto dependency = random_hash ();
+	sets.priority_up (prioritized);
+	sets.priority_up (prioritized);
+	sets.block (blocked, dependency);
+	sets.priority_up (blocked_prioritized);
+	sets.block (blocked_prioritized, dependency);
+
+	std::vector<uint8_t> bytes;
+	{
+		nano::vectorstream stream{ bytes };
+		sets.serialize (stream);
+	}
+
+	nano::bootstrap_ascending::account_sets loaded{ stats };
+	nano::bufferstream stream{ bytes.data (), bytes.size () };
+	ASSERT_FALSE (loaded.deserialize (stream));
+	ASSERT_EQ (1, loaded.priority_size ());
+	ASSERT_EQ (2, loaded.blocked_size ());
+	ASSERT_EQ (sets.priority (prioritized), loaded.priority (prioritized));
+	ASSERT_TRUE (loaded.blocked (blocked));
+	ASSERT_TRUE (loaded.blocked (blocked_prioritized));
+
+	// Unblocking restores the priority the account had before it was blocked
+	loaded.unblock (blocked_prioritized, dependency);
+	ASSERT_EQ (nano::bootstrap_ascending::account_sets::priority_initial, loaded.priority (blocked_prioritized));
+}
+
+TEST (account_sets, deserialize_truncated)
+{
+	nano::stats stats;
+	nano::bootstrap_ascending::account_sets sets{ stats };
+	sets.priority_up (nano::account{ 1 });
+	std::vector<uint8_t> bytes;
+	{
+		nano::vectorstream stream{ bytes };
+		sets.serialize (stream);
+	}
+	bytes.resize (bytes.size () - 1);
+
+	nano::bootstrap_ascending::account_sets loaded{ stats };
+	nano::bufferstream stream{ bytes.data (), bytes.size () };
+	ASSERT_TRUE (loaded.deserialize (stream));
+	ASSERT_EQ (0, loaded.priority_size ());
+}
+
+/*
+ * Accounts are unblocked when their dependency is found, others stay blocked
+ */
+TEST (account_sets, unblock_existing)
+{
+	nano::stats stats;
+	nano::bootstrap_ascending::account_sets sets{ stats };
+	nano::account resolved{ 1 };
+	nano::account unresolved{ 2 };
+	auto dependency = random_hash ();
+	sets.block (resolved, dependency);
+	sets.block (unresolved, random_hash ());
+	ASSERT_EQ (1, sets.unblock_existing ([&dependency] (nano::block_hash const & hash) { return hash == dependency; }));
+	ASSERT_FALSE (sets.blocked (resolved));
+	ASSERT_EQ (nano::bootstrap_ascending::account_sets::priority_initial, sets.priority (resolved));
+	ASSERT_TRUE (sets.blocked (unresolved));
+}
+
+/*
+ * Tests that the request window of a peer starts at the configured minimum and grows with its measured throughput, up to the limit
+ */
+TEST (peer_scoring, window)
+{
+	nano::test::system system{ 1 };
+	auto & node = *system.nodes[0];
+	nano::bootstrap_ascending_config config;
+	config.requests_window_min = 4;
+	config.requests_limit = 64;
+	nano::bootstrap_ascending::peer_scoring scoring{ config, node.network_params.network };
+	auto channel = std::make_shared<nano::transport::fake::channel> (node);
+	scoring.sync ({ channel });
+	ASSERT_EQ (1, scoring.size ());
+	ASSERT_EQ (4, scoring.window (channel));
+
+	// Window limits the number of requests in flight
+	std::size_t sent = 0;
+	while (scoring.channel () != nullptr)
+	{
+		++sent;
+	}
+	ASSERT_EQ (3, sent); // Sync starts the channel with one outstanding request
+
+	// A fast peer answering many requests gets a larger window, capped by the limit
+	for (int i = 0; i < 1000; ++i)
+	{
+		scoring.received_message (channel, 100ms);
+	}
+	std::this_thread::sleep_for (10ms);
+	scoring.timeout ();
+	ASSERT_EQ (64, scoring.window (channel));
+
+	// Without responses the measured throughput decays and the window shrinks back
+	for (int i = 0; i < 50; ++i)
+	{
+		std::this_thread::sleep_for (1ms);
+		scoring.timeout ();
+	}
+	ASSERT_EQ (4, scoring.window (channel));
+}
+
 /**
  * Tests the base case for returning
  */
@@ -251,3 +371,55 @@ TEST (bootstrap_ascending, trace_base)
 	//	std::cerr << "node1: " << node1.network.endpoint () << std::endl;
 	ASSERT_TIMELY (10s, node1.block (receive1->hash ()) != nullptr);
 }
+
+/*
+ * A node that is stopped without having been started, as CLI commands do with inactive nodes, leaves the account sets snapshot of the data directory alone
+ */
+TEST (bootstrap_ascending, snapshot_kept_when_not_started)
+{
+	nano::test::system system;
+	auto path = nano::unique_path ();
+	std::filesystem::create_directories (path);
+	std::string const contents{ "snapshot of a running node" };
+	{
+		std::ofstream file{ path / "bootstrap_ascending.dat", std::ios::binary };
+		file << contents;
+	}
+	{
+		nano::node node{ system.io_ctx, system.get_available_port (), path, system.logging, system.work };
+		node.stop ();
+	}
+	std::ifstream file{ path / "bootstrap_ascending.dat", std::ios::binary };
+	std::string const read{ std::istreambuf_iterator<char> (file), std::istreambuf_iterator<char> () };
+	ASSERT_EQ (contents, read);
+}
+
+/*
+ * A snapshot can be older than blocks in the ledger, accounts blocked on a block inserted since are unblocked when it is loaded
+ */
+TEST (bootstrap_ascending, snapshot_dependency_inserted)
+{
+	nano::test::system system;
+	auto path = nano::unique_path ();
+	std::filesystem::create_directories (path);
+	nano::account resolved{ 1 };
+	nano::account unresolved{ 2 };
+	{
+		nano::stats stats;
+		nano::bootstrap_ascending::account_sets sets{ stats };
+		sets.block (resolved, nano::dev::genesis->hash ());
+		sets.block (unresolved, random_hash ());
+		std::vector<uint8_t> bytes;
+		{
+			nano::vectorstream stream{ bytes };
+			sets.serialize (stream);
+		}
+		std::ofstream file{ path / "bootstrap_ascending.dat", std::ios::binary };
+		file.write (reinterpret_cast<char const *> (bytes.data ()), bytes.size ());
+	}
+	nano::node node{ system.io_ctx, system.get_available_port (), path, system.logging, system.work };
+	node.start ();
+	ASSERT_EQ (1, node.stats.count (nano::stat::type::bootstrap_ascending, nano::stat::detail::snapshot_load));
+	ASSERT_EQ (1, node.ascendboot.blocked_size ());
+	node.stop ();
+}
@@ -15,8 +15,21 @@ class responses_helper final
 public:
 	void add (nano::asc_pull_ack & ack)
 	{
+		// Keep the response as the peer receives it, blocks are served as raw bytes and only materialized by deserialization
+		std::vector<uint8_t> bytes;
+		{
+			nano::vectorstream stream{ bytes };
+			ack.serialize (stream);
+		}
+		nano::bufferstream stream{ bytes.data (), bytes.size () };
+		bool error = false;
+		nano::message_header header{ error, stream };
+		debug_assert (!error);
+		nano::asc_pull_ack received{ error, stream, header };
+		debug_assert (!error);
+
 		nano::lock_guard<nano::mutex> lock{ mutex };
-		responses.push_back (ack);
+		responses.push_back (received);
 	}
 
 	std::vector<nano::asc_pull_ack> get ()
@@ -194,6 +207,55 @@ TEST (bootstrap_server, serve_hash_one)
 	ASSERT_TRUE (response_payload.blocks.front ()->hash () == request_payload.start.as_block_hash ());
 }
 
+/*
+ * Repeated requests for the same chain are answered from the response cache, with their own ids
+ */
+TEST (bootstrap_server, serve_cached)
+{
+	nano::test::system system{};
+	auto & node = *system.add_node ();
+
+	responses_helper responses;
+	node.bootstrap_server.on_response.add ([&] (auto & response, auto & channel) {
+		responses.add (response);
+	});
+
+	auto chains = nano::test::setup_chains (system, node, 1, 128);
+	auto [account, blocks] = chains.front ();
+
+	for (nano::asc_pull_req::id_t id : { 7, 8 })
+	{
+		nano::asc_pull_req request{ node.network_params.network };
+		request.id = id;
+		request.type = nano::asc_pull_type::blocks;
+
+		nano::asc_pull_req::blocks_payload request_payload;
+		request_payload.start = blocks.front ()->hash ();
+		request_payload.count = nano::bootstrap_server::max_blocks;
+		request_payload.start_type = nano::asc_pull_req::hash_type::block;
+
+		request.payload = request_payload;
+		request.update_header ();
+
+		node.network.inbound (request, nano::test::fake_channel (node));
+		ASSERT_TIMELY (5s, responses.size () == id - 6);
+	}
+
+	ASSERT_EQ (1, node.stats.count (nano::stat::type::bootstrap_server, nano::stat::detail::cache_miss));
+	ASSERT_EQ (1, node.stats.count (nano::stat::type::bootstrap_server, nano::stat::detail::cache_hit));
+
+	auto all = responses.get ();
+	ASSERT_EQ (7, all[0].id);
+	ASSERT_EQ (8, all[1].id);
+	for (auto const & response : all)
+	{
+		nano::asc_pull_ack::blocks_payload response_payload;
+		ASSERT_NO_THROW (response_payload = std::get<nano::asc_pull_ack::blocks_payload> (response.payload));
+		ASSERT_EQ (response_payload.blocks.size (), 128);
+		ASSERT_TRUE (compare_blocks (response_payload.blocks, blocks));
+	}
+}
+
 TEST (bootstrap_server, serve_end_of_chain)
 {
 	nano::test::system system{};
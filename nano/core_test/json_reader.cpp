@@ -0,0 +1,108 @@
+#include <nano/lib/json_reader.hpp>
+
+#include <gtest/gtest.h>
+
+#include <boost/property_tree/json_parser.hpp>
+#include <boost/property_tree/ptree.hpp>
+
+#include <sstream>
+
+namespace
+{
+/** Whether read_json rejects `text` */
+bool read_json_fails (std::string const & text, boost::property_tree::ptree & tree)
+{
+	try
+	{
+		std::stringstream stream{ text };
+		boost::property_tree::read_json (stream, tree);
+		return false;
+	}
+	catch (boost::property_tree::json_parser_error const &)
+	{
+		return true;
+	}
+}
+}
+
+// Documents are accepted or rejected the same as read_json and produce the same tree
+TEST (json_reader, ptree_compatible)
+{
+	std::vector<std::string> const documents{
+		R"({"action": "account_info", "account": "nano_1111", "representative": true})",
+		R"({"a": {"b": {"c": "d"}}, "list": ["1", 2, -3.5e+2, true, false, null], "empty": {}, "none": []})",
+		R"({"escapes": "\"\\\/\b\f\n\r\t\u0041\u00e9\u20ac\ud83d\ude00", "utf8": "é€"})",
+		R"({"duplicate": "1", "duplicate": "2"})",
+		R"([{"key.with.dots": "1"}, [], "x"])",
+		"\xef\xbb\xbf{\"bom\": \"1\"}",
+		" \t\r\n\"top level string\" ",
+		"0",
+		"{\"a\": \"b\"",
+		"{\"a\" \"b\"}",
+		"{\"a\": \"b\",}",
+		"[1,]",
+		"{,\"a\": 1}",
+		"[01]",
+		"[-]",
+		"[1.]",
+		"[1e]",
+		"[tru]",
+		"[nul]",
+		"\"unterminated",
+		"\"control \x01 character\"",
+		"\"bad escape \\x\"",
+		"\"stray low \\udc00\"",
+		"\"lone high \\ud83d\"",
+		"\"invalid utf8 \x80\"",
+		"\"truncated utf8 \xe2\x82\"",
+		"{} trailing",
+		"",
+		"   ",
+	};
+	for (auto const & document : documents)
+	{
+		boost::property_tree::ptree expected;
+		auto const expected_error = read_json_fails (document, expected);
+		nano::json_reader reader;
+		ASSERT_EQ (expected_error, reader.parse (document)) << document;
+		if (!expected_error)
+		{
+			ASSERT_EQ (expected, reader.root ().to_ptree ()) << document;
+		}
+	}
+}
+
+TEST (json_reader, accessors)
+{
+	nano::json_reader reader;
+	ASSERT_FALSE (reader.parse (R"({"action": "process", "json_block": "true", "count": "10", "flag": 1, "block": {"type": "state"}, "accounts": ["a", "b"], "nested": {"inner": {"value": "x"}}})"));
+	auto const request = reader.root ();
+	ASSERT_EQ ("process", request.get<std::string> ("action"));
+	ASSERT_TRUE (request.get<bool> ("json_block"));
+	ASSERT_TRUE (request.get<bool> ("flag"));
+	ASSERT_EQ (10, request.get<uint8_t> ("count"));
+	ASSERT_EQ ("x", request.get<std::string> ("nested.inner.value"));
+	ASSERT_EQ ("", request.get<std::string> ("block"));
+	ASSERT_EQ ("state", request.get_child ("block").get<std::string> ("type"));
+	ASSERT_EQ ("default", request.get<std::string> ("missing", "default"));
+	ASSERT_FALSE (request.get<bool> ("action", false));
+	ASSERT_FALSE (request.get_optional<std::string> ("missing").is_initialized ());
+	ASSERT_FALSE (request.get_optional<bool> ("action").is_initialized ());
+	ASSERT_FALSE (request.get_child_optional ("missing").is_initialized ());
+	ASSERT_THROW (request.get<std::string> ("missing"), std::runtime_error);
+	ASSERT_THROW (request.get<bool> ("action"), std::runtime_error);
+	ASSERT_EQ (1, request.count ("accounts"));
+	ASSERT_EQ (0, request.count ("nested.inner"));
+	std::vector<std::string> accounts;
+	for (auto & account : request.get_child ("accounts"))
+	{
+		ASSERT_TRUE (account.first.empty ());
+		accounts.emplace_back (account.second.get<std::string> (""));
+	}
+	ASSERT_EQ ((std::vector<std::string>{ "a", "b" }), accounts);
+	ASSERT_EQ (7, request.size ());
+	ASSERT_FALSE (request.is_array ());
+	ASSERT_TRUE (request.get_child ("accounts").is_array ());
+	ASSERT_TRUE (nano::json_value{}.empty ());
+	ASSERT_FALSE (nano::json_value{}.is_array ());
+}
@@ -0,0 +1,92 @@
+#include <nano/lib/json_writer.hpp>
+
+#include <gtest/gtest.h>
+
+#include <boost/property_tree/json_parser.hpp>
+#include <boost/property_tree/ptree.hpp>
+
+#include <sstream>
+
+namespace
+{
+std::string write_json (boost::property_tree::ptree const & tree)
+{
+	std::stringstream stream;
+	boost::property_tree::write_json (stream, tree);
+	return stream.str ();
+}
+}
+
+TEST (json_writer, empty)
+{
+	nano::json_writer writer;
+	ASSERT_TRUE (writer.empty ());
+	ASSERT_EQ (write_json ({}), writer.str ());
+}
+
+// The writer output is byte for byte what write_json produces for the equivalent tree
+TEST (json_writer, ptree_compatible)
+{
+	boost::property_tree::ptree tree;
+	tree.put ("escaped", "a/b\"c\\d\n\t\x01\x7f\xc3\xa9");
+	tree.put ("number", 42);
+	tree.put ("flag", true);
+	tree.add_child ("empty_object", boost::property_tree::ptree{});
+	boost::property_tree::ptree hashes;
+	for (auto i = 0; i < 3; ++i)
+	{
+		boost::property_tree::ptree entry;
+		entry.put ("", std::to_string (i));
+		hashes.push_back (std::make_pair ("", entry));
+	}
+	tree.add_child ("hashes", hashes);
+	boost::property_tree::ptree member;
+	member.put ("amount", "1");
+	boost::property_tree::ptree members;
+	members.add_child ("first", member);
+	members.add_child ("second", member);
+	tree.add_child ("members", members);
+	boost::property_tree::ptree objects;
+	objects.push_back (std::make_pair ("", member));
+	objects.push_back (std::make_pair ("", member));
+	tree.add_child ("objects", objects);
+
+	nano::json_writer writer;
+	writer.put ("escaped", "a/b\"c\\d\n\t\x01\x7f\xc3\xa9");
+	writer.put ("number", 42);
+	writer.put ("flag", true);
+	writer.begin_object ("empty_object");
+	writer.end_object ();
+	writer.begin_array ("hashes");
+	for (auto i = 0; i < 3; ++i)
+	{
+		writer.push_back (std::to_string (i));
+	}
+	ASSERT_EQ (3, writer.size ());
+	writer.end_array ();
+	writer.begin_object ("members");
+	writer.begin_object ("first");
+	writer.put ("amount", "1");
+	writer.end_object ();
+	writer.put ("second", member);
+	writer.end_object ();
+	writer.begin_array ("objects");
+	writer.begin_object ();
+	writer.put ("amount", "1");
+	writer.end_object ();
+	writer.push_back (member);
+	writer.end_array ();
+	ASSERT_FALSE (writer.empty ());
+	ASSERT_EQ (write_json (tree), writer.str ());
+}
+
+TEST (json_writer, initial_tree)
+{
+	boost::property_tree::ptree tree;
+	tree.put ("deprecated", "1");
+	nano::json_writer writer{ tree };
+	writer.begin_array ("history");
+	writer.end_array ();
+	tree.add_child ("history", boost::property_tree::ptree{});
+	ASSERT_EQ (write_json (tree), writer.str ());
+}
@@ -5,6 +5,8 @@
 #include <nano/node/scheduler/component.hpp>
 #include <nano/node/scheduler/priority.hpp>
 #include <nano/node/transport/inproc.hpp>
+#include <nano/store/delegator.hpp>
+#include <nano/store/receivable_amount.hpp>
 #include <nano/store/rocksdb/rocksdb.hpp>
 #include <nano/test_common/ledger.hpp>
 #include <nano/test_common/system.hpp>
@@ -1354,6 +1356,46 @@ TEST (ledger, fail_send_bad_signature)
 	ASSERT_EQ (nano::process_result::bad_signature, result1.code);
 }
 
+TEST (ledger, process_verified)
+{
+	auto ctx = nano::test::context::ledger_empty ();
+	auto & ledger = ctx.ledger ();
+	auto & store = ctx.store ();
+	auto transaction = store.tx_begin_write ();
+	nano::work_pool pool{ nano::dev::network_params.network, std::numeric_limits<unsigned>::max () };
+	nano::keypair key1;
+	nano::block_builder builder;
+	auto bad_signature = builder
+						 .send ()
+						 .previous (nano::dev::genesis->hash ())
+						 .destination (key1.pub)
+						 .balance (1)
+						 .sign (key1.prv, key1.pub)
+						 .work (*pool.generate (nano::dev::genesis->hash ()))
+						 .build ();
+	// A verification by a key other than the one the ledger requires is not trusted
+	nano::block_verification other_signer;
+	other_signer.signer = key1.pub;
+	ASSERT_EQ (nano::process_result::bad_signature, ledger.process (transaction, *bad_signature, other_signer).code);
+	auto send = builder
+				.send ()
+				.previous (nano::dev::genesis->hash ())
+				.destination (key1.pub)
+				.balance (1)
+				.sign (nano::dev::genesis_key.prv, nano::dev::genesis_key.pub)
+				.work (*pool.generate (nano::dev::genesis->hash ()))
+				.build ();
+	// The supplied difficulty is used instead of the work being checked again
+	nano::block_verification low_difficulty;
+	low_difficulty.signer = nano::dev::genesis_key.pub;
+	low_difficulty.difficulty = 1;
+	ASSERT_EQ (nano::process_result::insufficient_work, ledger.process (transaction, *send, low_difficulty).code);
+	nano::block_verification verified;
+	verified.signer = nano::dev::genesis_key.pub;
+	verified.difficulty = nano::dev::network_params.work.difficulty (*send);
+	ASSERT_EQ (nano::process_result::progress, ledger.process (transaction, *send, verified).code);
+}
+
 TEST (ledger, fail_send_negative_spend)
 {
 	auto ctx = nano::test::context::ledger_empty ();
@@ -3112,6 +3154,167 @@ TEST (ledger, state_rollback_send)
 	ASSERT_EQ (store.account.count (transaction), ledger.cache.account_count);
 }
 
+TEST (ledger, delegators_index)
+{
+	auto ctx = nano::test::context::ledger_empty ();
+	auto & ledger = ctx.ledger ();
+	auto & store = ctx.store ();
+	ASSERT_FALSE (ledger.delegators_index);
+	// Enabling builds the index from the genesis account
+	ASSERT_EQ (1, ledger.delegators_index_set (true));
+	ASSERT_TRUE (ledger.delegators_index);
+	// Already built
+	ASSERT_EQ (0, ledger.delegators_index_set (true));
+	nano::keypair key1;
+	nano::keypair rep;
+	nano::work_pool pool{ nano::dev::network_params.network, std::numeric_limits<unsigned>::max () };
+	nano::block_builder builder;
+	{
+		auto transaction = store.tx_begin_write ();
+		ASSERT_TRUE (store.delegator.exists (transaction, { nano::dev::genesis_key.pub, nano::dev::genesis_key.pub }));
+		auto send1 = builder
+					 .state ()
+					 .account (nano::dev::genesis_key.pub)
+					 .previous (nano::dev::genesis->hash ())
+					 .representative (nano::dev::genesis_key.pub)
+					 .balance (nano::dev::constants.genesis_amount - nano::Gxrb_ratio)
+					 .link (key1.pub)
+					 .sign (nano::dev::genesis_key.prv, nano::dev::genesis_key.pub)
+					 .work (*pool.generate (nano::dev::genesis->hash ()))
+					 .build ();
+		ASSERT_EQ (nano::process_result::progress, ledger.process (transaction, *send1).code);
+		auto open1 = builder
+					 .open ()
+					 .source (send1->hash ())
+					 .representative (rep.pub)
+					 .account (key1.pub)
+					 .sign (key1.prv, key1.pub)
+					 .work (*pool.generate (key1.pub))
+					 .build ();
+		ASSERT_EQ (nano::process_result::progress, ledger.process (transaction, *open1).code);
+		ASSERT_TRUE (store.delegator.exists (transaction, { rep.pub, key1.pub }));
+		auto change1 = builder
+					   .state ()
+					   .account (key1.pub)
+					   .previous (open1->hash ())
+					   .representative (nano::dev::genesis_key.pub)
+					   .balance (nano::Gxrb_ratio)
+					   .link (0)
+					   .sign (key1.prv, key1.pub)
+					   .work (*pool.generate (open1->hash ()))
+					   .build ();
+		ASSERT_EQ (nano::process_result::progress, ledger.process (transaction, *change1).code);
+		ASSERT_FALSE (store.delegator.exists (transaction, { rep.pub, key1.pub }));
+		ASSERT_TRUE (store.delegator.exists (transaction, { nano::dev::genesis_key.pub, key1.pub }));
+		// The delegators of a representative are adjacent
+		auto i = store.delegator.begin (transaction, { nano::dev::genesis_key.pub, 0 });
+		ASSERT_NE (store.delegator.end (), i);
+		ASSERT_EQ (nano::dev::genesis_key.pub, i->first.representative);
+		++i;
+		ASSERT_NE (store.delegator.end (), i);
+		ASSERT_EQ (nano::dev::genesis_key.pub, i->first.representative);
+
+		// Rolling back restores the previous representative and removes accounts which are no longer opened
+		ASSERT_FALSE (ledger.rollback (transaction, change1->hash ()));
+		ASSERT_TRUE (store.delegator.exists (transaction, { rep.pub, key1.pub }));
+		ASSERT_FALSE (store.delegator.exists (transaction, { nano::dev::genesis_key.pub, key1.pub }));
+		ASSERT_FALSE (ledger.rollback (transaction, open1->hash ()));
+		ASSERT_FALSE (store.delegator.exists (transaction, { rep.pub, key1.pub }));
+		ASSERT_TRUE (store.delegator.exists (transaction, { nano::dev::genesis_key.pub, nano::dev::genesis_key.pub }));
+	}
+	// Disabling removes the index
+	ASSERT_EQ (0, ledger.delegators_index_set (false));
+	ASSERT_FALSE (ledger.delegators_index);
+	auto transaction = store.tx_begin_read ();
+	ASSERT_EQ (store.delegator.end (), store.delegator.begin (transaction));
+}
+
+TEST (ledger, receivable_index)
+{
+	auto ctx = nano::test::context::ledger_empty ();
+	auto & ledger = ctx.ledger ();
+	auto & store = ctx.store ();
+	nano::keypair key1;
+	nano::work_pool pool{ nano::dev::network_params.network, std::numeric_limits<unsigned>::max () };
+	nano::block_builder builder;
+	auto send1 = builder
+				 .state ()
+				 .account (nano::dev::genesis_key.pub)
+				 .previous (nano::dev::genesis->hash ())
+				 .representative (nano::dev::genesis_key.pub)
+				 .balance (nano::dev::constants.genesis_amount - 100)
+				 .link (key1.pub)
+				 .sign (nano::dev::genesis_key.prv, nano::dev::genesis_key.pub)
+				 .work (*pool.generate (nano::dev::genesis->hash ()))
+				 .build ();
+	ASSERT_EQ (nano::process_result::progress, ledger.process (store.tx_begin_write (), *send1).code);
+	ASSERT_FALSE (ledger.receivable_index);
+	// Enabling builds the index from the existing receivable
+	ASSERT_EQ (1, ledger.receivable_index_set (true));
+	ASSERT_TRUE (ledger.receivable_index);
+	ASSERT_EQ (0, ledger.receivable_index_set (true));
+	{
+		auto transaction = store.tx_begin_write ();
+		auto send2 = builder
+					 .state ()
+					 .account (nano::dev::genesis_key.pub)
+					 .previous (send1->hash ())
+					 .representative (nano::dev::genesis_key.pub)
+					 .balance (nano::dev::constants.genesis_amount - 400)
+					 .link (key1.pub)
+					 .sign (nano::dev::genesis_key.prv, nano::dev::genesis_key.pub)
+					 .work (*pool.generate (send1->hash ()))
+					 .build ();
+		ASSERT_EQ (nano::process_result::progress, ledger.process (transaction, *send2).code);
+		auto send3 = builder
+					 .send ()
+					 .previous (send2->hash ())
+					 .destination (key1.pub)
+					 .balance (nano::dev::constants.genesis_amount - 600)
+					 .sign (nano::dev::genesis_key.prv, nano::dev::genesis_key.pub)
+					 .work (*pool.generate (send2->hash ()))
+					 .build ();
+		ASSERT_EQ (nano::process_result::progress, ledger.process (transaction, *send3).code);
+		// The receivables of an account are adjacent and ordered by descending amount
+		auto const amounts = [&] () {
+			std::vector<std::pair<nano::uint128_t, nano::block_hash>> result;
+			for (auto i = store.receivable_amount.begin (transaction, { key1.pub, std::numeric_limits<nano::uint128_t>::max (), 0 }), n = store.receivable_amount.end (); i != n && i->first.account == key1.pub; ++i)
+			{
+				result.emplace_back (i->first.amount ().number (), i->first.hash);
+			}
+			return result;
+		};
+		std::vector<std::pair<nano::uint128_t, nano::block_hash>> expected{ { 300, send2->hash () }, { 200, send3->hash () }, { 100, send1->hash () } };
+		ASSERT_EQ (expected, amounts ());
+
+		// Receiving removes the entry, rolling back the receive restores it
+		auto open1 = builder
+					 .state ()
+					 .account (key1.pub)
+					 .previous (0)
+					 .representative (key1.pub)
+					 .balance (300)
+					 .link (send2->hash ())
+					 .sign (key1.prv, key1.pub)
+					 .work (*pool.generate (key1.pub))
+					 .build ();
+		ASSERT_EQ (nano::process_result::progress, ledger.process (transaction, *open1).code);
+		ASSERT_FALSE (store.receivable_amount.exists (transaction, { key1.pub, 300, send2->hash () }));
+		ASSERT_EQ (2, amounts ().size ());
+		ASSERT_FALSE (ledger.rollback (transaction, open1->hash ()));
+		ASSERT_EQ (expected, amounts ());
+		// Rolling back a send removes its entry
+		ASSERT_FALSE (ledger.rollback (transaction, send3->hash ()));
+		ASSERT_FALSE (store.receivable_amount.exists (transaction, { key1.pub, 200, send3->hash () }));
+		ASSERT_EQ (2, amounts ().size ());
+	}
+
+	// Disabling removes the index
+	ASSERT_EQ (0, ledger.receivable_index_set (false));
+	ASSERT_FALSE (ledger.receivable_index);
+	ASSERT_EQ (store.receivable_amount.end (), store.receivable_amount.begin (store.tx_begin_read ()));
+}
+
 TEST (ledger, state_rollback_receive)
 {
 	auto ctx = nano::test::context::ledger_empty ();
@@ -0,0 +1,79 @@
+#include <nano/node/ledger_snapshot.hpp>
+#include <nano/secure/utility.hpp>
+#include <nano/store/account.hpp>
+#include <nano/store/block.hpp>
+#include <nano/store/component.hpp>
+#include <nano/store/confirmation_height.hpp>
+#include <nano/store/final.hpp>
+#include <nano/store/pending.hpp>
+#include <nano/test_common/ledger.hpp>
+#include <nano/test_common/testutil.hpp>
+
+#include <gtest/gtest.h>
+
+TEST (ledger_snapshot, write_read)
+{
+	auto source = nano::test::context::ledger_send_receive ();
+	auto & send = source.blocks ()[0];
+	auto & receive = source.blocks ()[1];
+	nano::pending_key pending_key{ nano::dev::genesis_key.pub, 42 };
+	nano::pending_info pending_info{ nano::dev::genesis_key.pub, 100, nano::epoch::epoch_0 };
+	nano::qualified_root root{ receive->qualified_root () };
+	{
+		auto transaction = source.store ().tx_begin_write ();
+		source.store ().pending.put (transaction, pending_key, pending_info);
+		source.store ().final_vote.put (transaction, root, receive->hash ());
+		source.store ().confirmation_height.put (transaction, nano::dev::genesis_key.pub, { 2, send->hash () });
+	}
+	auto path = nano::unique_path () / "ledger.snapshot";
+	std::filesystem::create_directories (path.parent_path ());
+	uint64_t written{ 0 };
+	ASSERT_FALSE (nano::ledger_snapshot::write (source.store (), nano::networks::nano_dev_network, path, written));
+	ASSERT_LT (0, written);
+
+	auto target = nano::test::context::ledger_empty ();
+	uint64_t restored{ 0 };
+	ASSERT_FALSE (nano::ledger_snapshot::read (target.store (), nano::networks::nano_dev_network, nano::dev::constants, path, 2, restored));
+	ASSERT_EQ (written, restored);
+	{
+		auto transaction = target.store ().tx_begin_read ();
+		ASSERT_EQ (3, target.store ().block.count (transaction));
+		auto block = target.store ().block.get (transaction, receive->hash ());
+		ASSERT_NE (nullptr, block);
+		ASSERT_EQ (*receive, *block);
+		ASSERT_EQ (receive->sideband ().height, block->sideband ().height);
+		ASSERT_EQ (source.store ().account.get (source.store ().tx_begin_read (), nano::dev::genesis_key.pub), target.store ().account.get (transaction, nano::dev::genesis_key.pub));
+		nano::pending_info restored_pending;
+		ASSERT_FALSE (target.store ().pending.get (transaction, pending_key, restored_pending));
+		ASSERT_EQ (pending_info, restored_pending);
+		auto final_votes = target.store ().final_vote.get (transaction, root.root ());
+		ASSERT_EQ (1, final_votes.size ());
+		ASSERT_EQ (receive->hash (), final_votes[0]);
+		nano::confirmation_height_info confirmation_height;
+		ASSERT_FALSE (target.store ().confirmation_height.get (transaction, nano::dev::genesis_key.pub, confirmation_height));
+		ASSERT_EQ (2, confirmation_height.height);
+	}
+
+	// A ledger with more than genesis is refused
+	ASSERT_TRUE (nano::ledger_snapshot::read (target.store (), nano::networks::nano_dev_network, nano::dev::constants, path, 2, restored));
+}
+
+TEST (ledger_snapshot, failed_read_resets)
+{
+	auto source = nano::test::context::ledger_send_receive ();
+	auto path = nano::unique_path () / "ledger.snapshot";
+	std::filesystem::create_directories (path.parent_path ());
+	uint64_t written{ 0 };
+	ASSERT_FALSE (nano::ledger_snapshot::write (source.store (), nano::networks::nano_dev_network, path, written));
+	// Dropping the footer leaves every chunk intact, so records are restored before the error is noticed
+	std::filesystem::resize_file (path, std::filesystem::file_size (path) - 1);
+
+	auto target = nano::test::context::ledger_empty ();
+	uint64_t restored{ 0 };
+	ASSERT_TRUE (nano::ledger_snapshot::read (target.store (), nano::networks::nano_dev_network, nano::dev::constants, path, 2, restored));
+	auto transaction = target.store ().tx_begin_read ();
+	ASSERT_EQ (1, target.store ().block.count (transaction));
+	ASSERT_EQ (1, target.store ().account.count (transaction));
+	ASSERT_TRUE (target.store ().block.exists (transaction, nano::dev::genesis->hash ()));
+	ASSERT_FALSE (target.store ().block.exists (transaction, source.blocks ()[0]->hash ()));
+}
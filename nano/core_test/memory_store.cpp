@@ -0,0 +1,111 @@
+#include <nano/secure/ledger.hpp>
+#include <nano/store/account.hpp>
+#include <nano/store/block.hpp>
+#include <nano/store/memory/memory.hpp>
+#include <nano/store/views.hpp>
+#include <nano/test_common/ledger.hpp>
+#include <nano/test_common/testutil.hpp>
+
+#include <gtest/gtest.h>
+
+TEST (memory_store, snapshot_isolation)
+{
+	nano::store::memory::component store;
+	nano::keypair key1;
+	nano::keypair key2;
+	nano::account_info info1{ 1, 2, 3, 4, 5, 6, nano::epoch::epoch_0 };
+	nano::account_info info2{ 7, 8, 9, 10, 11, 12, nano::epoch::epoch_1 };
+	store.account.put (store.tx_begin_write (), key1.pub, info1);
+
+	auto snapshot = store.tx_begin_read ();
+	{
+		auto transaction = store.tx_begin_write ();
+		store.account.put (transaction, key1.pub, info2);
+		store.account.put (transaction, key2.pub, info1);
+		// The write transaction sees its own changes before committing
+		ASSERT_EQ (2, store.account.count (transaction));
+		ASSERT_EQ (1, store.account.count (snapshot));
+	}
+	// Readers keep seeing the version they started with after the writer committed
+	ASSERT_EQ (info1, store.account.get (snapshot, key1.pub));
+	ASSERT_FALSE (store.account.exists (snapshot, key2.pub));
+	ASSERT_EQ (1, store.account.count (snapshot));
+	{
+		auto transaction = store.tx_begin_read ();
+		ASSERT_EQ (info2, store.account.get (transaction, key1.pub));
+		ASSERT_TRUE (store.account.exists (transaction, key2.pub));
+	}
+
+	store.account.del (store.tx_begin_write (), key1.pub);
+	ASSERT_EQ (info1, store.account.get (snapshot, key1.pub));
+	snapshot.refresh ();
+	ASSERT_FALSE (store.account.exists (snapshot, key1.pub));
+	ASSERT_EQ (1, store.account.count (snapshot));
+	auto i = store.account.begin (snapshot);
+	ASSERT_NE (store.account.end (), i);
+	ASSERT_EQ (key2.pub, i->first);
+	ASSERT_EQ (store.account.end (), ++i);
+}
+
+TEST (memory_store, ledger)
+{
+	auto source = nano::test::context::ledger_send_receive ();
+	nano::store::memory::component store;
+	nano::stats stats;
+	nano::ledger ledger{ store, stats, nano::dev::constants };
+	store.initialize (store.tx_begin_write (), ledger.cache, ledger.constants);
+	{
+		auto transaction = store.tx_begin_write ();
+		for (auto const & block : source.blocks ())
+		{
+			ASSERT_EQ (nano::process_result::progress, ledger.process (transaction, *block).code);
+		}
+	}
+	auto transaction = store.tx_begin_read ();
+	ASSERT_EQ (3, store.block.count (transaction));
+	auto & send = source.blocks ()[0];
+	auto & receive = source.blocks ()[1];
+	ASSERT_EQ (send->hash (), store.block.successor (transaction, nano::dev::genesis->hash ()));
+	ASSERT_EQ (receive->hash (), store.block.successor (transaction, send->hash ()));
+	auto block = store.block.get (transaction, receive->hash ());
+	ASSERT_NE (nullptr, block);
+	ASSERT_EQ (*receive, *block);
+	ASSERT_EQ (3, block->sideband ().height);
+	size_t count{ 0 };
+	for (auto i = store.block.begin (transaction), n = store.block.end (); i != n; ++i)
+	{
+		ASSERT_EQ (i->first, i->second.block->hash ());
+		++count;
+	}
+	ASSERT_EQ (3, count);
+	ASSERT_EQ (nano::dev::constants.genesis_amount, ledger.account_balance (transaction, nano::dev::genesis_key.pub));
+}
+
+TEST (memory_store, views)
+{
+	nano::store::memory::component store;
+	nano::account_info info{ 1, 2, 3, 4, 5, 6, nano::epoch::epoch_2 };
+	{
+		auto transaction = store.tx_begin_write ();
+		store.account.put (transaction, nano::account{ 1 }, info);
+		store.pending.put (transaction, nano::pending_key{ 2, 3 }, { 4, 5, nano::epoch::epoch_1 });
+	}
+	auto transaction = store.tx_begin_read ();
+	// Views see the layout the disk backends store
+	nano::store::view_iterator<nano::account, nano::account_info> i{ store.account.begin (transaction) };
+	ASSERT_TRUE (i != store.account.end ());
+	ASSERT_EQ (nano::account{ 1 }, i.view ().key_as<nano::account> ());
+	ASSERT_EQ (info.db_size (), i.view ().value.size ());
+	nano::store::account_info_view const view{ i.view ().value };
+	ASSERT_EQ (info.representative, view.representative ());
+	ASSERT_EQ (info.balance, view.balance ());
+	ASSERT_EQ (info.block_count, view.block_count ());
+	ASSERT_EQ (nano::epoch::epoch_2, view.epoch ());
+	++i;
+	ASSERT_TRUE (i == store.account.end ());
+
+	nano::store::view_iterator<nano::pending_key, nano::pending_info> pending{ store.pending.begin (transaction) };
+	ASSERT_TRUE (pending != store.pending.end ());
+	ASSERT_EQ ((nano::pending_key{ 2, 3 }), pending.view ().key_as<nano::pending_key> ());
+	ASSERT_EQ (nano::amount{ 5 }, nano::store::pending_info_view{ pending.view ().value }.amount ());
+}
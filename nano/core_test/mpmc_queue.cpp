@@ -0,0 +1,73 @@
+#include <nano/lib/mpmc_queue.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+TEST (mpmc_queue, construction)
+{
+	nano::mpmc_queue<int> queue{ 5 };
+	ASSERT_EQ (8, queue.capacity ());
+	ASSERT_TRUE (queue.empty ());
+	ASSERT_FALSE (queue.try_pop ());
+}
+
+TEST (mpmc_queue, fifo)
+{
+	nano::mpmc_queue<int> queue{ 4 };
+	for (int i = 0; i < 4; ++i)
+	{
+		ASSERT_TRUE (queue.try_push (i));
+	}
+	ASSERT_FALSE (queue.try_push (4));
+	ASSERT_EQ (4, queue.size ());
+	for (int i = 0; i < 4; ++i)
+	{
+		auto value = queue.try_pop ();
+		ASSERT_TRUE (value);
+		ASSERT_EQ (i, *value);
+	}
+	ASSERT_TRUE (queue.empty ());
+	// Wraps around
+	ASSERT_TRUE (queue.try_push (5));
+	ASSERT_EQ (5, *queue.try_pop ());
+}
+
+TEST (mpmc_queue, multithreaded)
+{
+	nano::mpmc_queue<int> queue{ 64 };
+	int const per_producer = 10'000;
+	std::atomic<long long> sum{ 0 };
+	std::atomic<int> consumed{ 0 };
+	std::vector<std::thread> threads;
+	for (int n = 0; n < 4; ++n)
+	{
+		threads.emplace_back ([&] () {
+			for (int i = 1; i <= per_producer;)
+			{
+				if (queue.try_push (i))
+				{
+					++i;
+				}
+			}
+		});
+		threads.emplace_back ([&] () {
+			while (consumed < 4 * per_producer)
+			{
+				if (auto value = queue.try_pop ())
+				{
+					sum += *value;
+					++consumed;
+				}
+			}
+		});
+	}
+	for (auto & thread : threads)
+	{
+		thread.join ();
+	}
+	ASSERT_EQ (4LL * per_producer * (per_producer + 1) / 2, sum);
+	ASSERT_TRUE (queue.empty ());
+}
@@ -2,6 +2,7 @@
 #include <nano/node/nodeconfig.hpp>
 #include <nano/node/scheduler/component.hpp>
 #include <nano/node/scheduler/priority.hpp>
+#include <nano/node/transport/fake.hpp>
 #include <nano/node/transport/inproc.hpp>
 #include <nano/node/transport/socket.hpp>
 #include <nano/test_common/network.hpp>
@@ -11,7 +12,6 @@
 #include <gtest/gtest.h>
 
 #include <boost/iostreams/stream_buffer.hpp>
-#include <boost/range/join.hpp>
 #include <boost/thread.hpp>
 
 using namespace std::chrono_literals;
@@ -994,42 +994,43 @@ namespace nano
 {
 TEST (network, tcp_message_manager)
 {
-	nano::tcp_message_manager manager (1);
+	nano::test::system system;
+	nano::stats stats;
+	nano::tcp_message_manager manager (stats, 1);
 	nano::tcp_message_item item;
 	item.node_id = nano::account (100);
-	ASSERT_EQ (0, manager.entries.size ());
-	manager.put_message (item);
-	ASSERT_EQ (1, manager.entries.size ());
+	ASSERT_EQ (0, manager.size ());
+	ASSERT_TRUE (manager.put_message (item));
+	ASSERT_EQ (1, manager.size ());
 	ASSERT_EQ (manager.get_message ().node_id, item.node_id);
-	ASSERT_EQ (0, manager.entries.size ());
-
-	// Fill the queue
-	manager.entries = decltype (manager.entries) (manager.max_entries, item);
-	ASSERT_EQ (manager.entries.size (), manager.max_entries);
-
-	// This task will wait until a message is consumed
-	auto future = std::async (std::launch::async, [&] {
-		manager.put_message (item);
-	});
+	ASSERT_EQ (0, manager.size ());
 
-	// This should give sufficient time to execute put_message
-	// and prove that it waits on condition variable
-	std::this_thread::sleep_for (200ms);
-
-	ASSERT_EQ (manager.entries.size (), manager.max_entries);
+	// Fill the queue, producers must not block once it is full
+	for (auto i = 0u; i < manager.max_entries; ++i)
+	{
+		ASSERT_TRUE (manager.put_message (item));
+	}
+	ASSERT_EQ (manager.size (), manager.max_entries);
+	ASSERT_FALSE (manager.put_message (item));
+	ASSERT_EQ (1, stats.count (nano::stat::type::tcp_message_manager, nano::stat::detail::overfill));
 	ASSERT_EQ (manager.get_message ().node_id, item.node_id);
-	ASSERT_NE (std::future_status::timeout, future.wait_for (1s));
-	ASSERT_EQ (manager.entries.size (), manager.max_entries);
+	ASSERT_TRUE (manager.put_message (item));
+	while (manager.size () > 0)
+	{
+		manager.get_message ();
+	}
 
-	nano::tcp_message_manager manager2 (2);
+	nano::tcp_message_manager manager2 (stats, 2);
 	size_t message_count = 10'000;
+	std::atomic<size_t> produced{ 0 };
+	std::atomic<size_t> consumed{ 0 };
 	std::vector<std::thread> consumers;
 	for (auto i = 0; i < 4; ++i)
 	{
 		consumers.emplace_back ([&] {
-			for (auto i = 0; i < message_count; ++i)
+			while (manager2.get_message ().message != nullptr)
 			{
-				ASSERT_EQ (manager.get_message ().node_id, item.node_id);
+				++consumed;
 			}
 		});
 	}
@@ -1037,18 +1038,210 @@ TEST (network, tcp_message_manager)
 	for (auto i = 0; i < 4; ++i)
 	{
 		producers.emplace_back ([&] {
+			auto message = std::make_shared<nano::keepalive> (nano::dev::network_params.network);
 			for (auto i = 0; i < message_count; ++i)
 			{
-				manager.put_message (item);
+				if (manager2.put_message (nano::tcp_message_item{ message, {}, nano::account (100), nullptr }))
+				{
+					++produced;
+				}
 			}
 		});
 	}
-
-	for (auto & t : boost::range::join (producers, consumers))
+	for (auto & t : producers)
 	{
 		t.join ();
 	}
+	ASSERT_TIMELY (5s, consumed == produced);
+	manager2.stop ();
+	for (auto & t : consumers)
+	{
+		t.join ();
+	}
+}
+
+// A single peer must not be able to occupy more than its share of the queue
+TEST (network, tcp_message_manager_peer_fairness)
+{
+	nano::test::system system (1);
+	auto & node = *system.nodes[0];
+	nano::tcp_message_manager manager (node.stats, 4);
+	auto chatty = std::make_shared<nano::transport::socket> (node, nano::transport::socket::endpoint_type_t::server);
+	auto quiet = std::make_shared<nano::transport::socket> (node, nano::transport::socket::endpoint_type_t::server);
+	auto message = std::make_shared<nano::keepalive> (nano::dev::network_params.network);
+	for (auto i = 0u; i < nano::tcp_message_manager::max_entries_per_connection; ++i)
+	{
+		ASSERT_TRUE (manager.put_message (nano::tcp_message_item{ message, {}, nano::account (1), chatty }));
+	}
+	ASSERT_FALSE (manager.put_message (nano::tcp_message_item{ message, {}, nano::account (1), chatty }));
+	ASSERT_TRUE (manager.put_message (nano::tcp_message_item{ message, {}, nano::account (2), quiet }));
+	ASSERT_EQ (nano::tcp_message_manager::max_entries_per_connection, chatty->inbound.queued);
+	ASSERT_EQ (nano::tcp_message_manager::max_entries_per_connection, chatty->inbound.enqueued);
+	ASSERT_EQ (1, chatty->inbound.dropped);
+	ASSERT_EQ (1, quiet->inbound.enqueued);
+	ASSERT_EQ (0, quiet->inbound.dropped);
+	ASSERT_EQ (1, node.stats.count (nano::stat::type::tcp_message_manager, nano::stat::detail::peer_overfill));
+
+	// Consuming releases the peer's share
+	ASSERT_EQ (manager.get_message ().socket, chatty);
+	ASSERT_EQ (nano::tcp_message_manager::max_entries_per_connection - 1, chatty->inbound.queued);
+	ASSERT_TRUE (manager.put_message (nano::tcp_message_item{ message, {}, nano::account (1), chatty }));
+}
+}
+
+TEST (network, channel_rtt)
+{
+	nano::test::system system (1);
+	auto channel = std::make_shared<nano::transport::fake::channel> (*system.nodes[0]);
+	ASSERT_EQ (std::chrono::microseconds{ 0 }, channel->get_rtt ());
+	// Replies without an outstanding probe are not samples
+	ASSERT_FALSE (channel->rtt_probe_end (1));
+	ASSERT_EQ (std::chrono::microseconds{ 0 }, channel->get_rtt ());
+	channel->rtt_sample (80ms);
+	ASSERT_EQ (80ms, channel->get_rtt ());
+	channel->rtt_sample (160ms);
+	ASSERT_EQ (90ms, channel->get_rtt ());
+	// Only the reply to the outstanding probe completes it, once
+	ASSERT_TRUE (channel->rtt_probe_start (2, 0ms));
+	// Probes are not started again within the interval
+	ASSERT_FALSE (channel->rtt_probe_start (4, 1h));
+	ASSERT_FALSE (channel->rtt_probe_end (3));
+	ASSERT_EQ (90ms, channel->get_rtt ());
+	ASSERT_TRUE (channel->rtt_probe_end (2));
+	ASSERT_LT (channel->get_rtt (), 90ms);
+	ASSERT_FALSE (channel->rtt_probe_end (2));
+}
+
+TEST (network, throughput_weighted_keys)
+{
+	nano::test::system system (1);
+	auto & node = *system.nodes[0];
+	auto busy = std::make_shared<nano::transport::fake::channel> (node);
+	auto idle = std::make_shared<nano::transport::fake::channel> (node);
+	busy->rtt_sample (100ms);
+	idle->rtt_sample (100ms);
+	busy->traffic.add (nano::message_type::publish, nano::stat::dir::in, 1024 * 1024);
+	idle->traffic.add (nano::message_type::publish, nano::stat::dir::in, 1024);
+	std::this_thread::sleep_for (10ms);
+	busy->throughput_sample ();
+	idle->throughput_sample ();
+	ASSERT_GT (busy->get_throughput (), idle->get_throughput ());
+	std::vector<std::shared_ptr<nano::transport::channel>> channels{ busy, idle };
+	int busy_first = 0;
+	int const iterations = 1000;
+	for (int i = 0; i < iterations; ++i)
+	{
+		auto keys = nano::network::latency_weighted_keys (channels);
+		busy_first += keys[0] > keys[1] ? 1 : 0;
+	}
+	// With equal round trip times the peer delivering more data is preferred
+	ASSERT_GT (busy_first, iterations * 8 / 10);
+	ASSERT_LT (busy_first, iterations);
+}
+
+TEST (network, latency_weighted_keys)
+{
+	nano::test::system system (1);
+	auto & node = *system.nodes[0];
+	auto fast = std::make_shared<nano::transport::fake::channel> (node);
+	auto slow = std::make_shared<nano::transport::fake::channel> (node);
+	fast->rtt_sample (10ms);
+	slow->rtt_sample (1000ms);
+	std::vector<std::shared_ptr<nano::transport::channel>> channels{ fast, slow };
+	int fast_first = 0;
+	int const iterations = 1000;
+	for (int i = 0; i < iterations; ++i)
+	{
+		auto keys = nano::network::latency_weighted_keys (channels);
+		ASSERT_EQ (2, keys.size ());
+		fast_first += keys[0] > keys[1] ? 1 : 0;
+	}
+	// The fast peer is preferred, but the slow one is still picked occasionally
+	ASSERT_GT (fast_first, iterations * 8 / 10);
+	ASSERT_LT (fast_first, iterations);
 }
+
+TEST (network, peer_bandwidth_limit)
+{
+	nano::test::system system;
+	auto config = system.default_config ();
+	// 1024 byte burst capacity, refilled at a negligible rate
+	config.peer_bandwidth_limit = 1;
+	config.peer_bandwidth_burst_ratio = 1024;
+	auto & node = *system.add_node (config);
+	auto channel1 = std::make_shared<nano::transport::fake::channel> (node);
+	auto channel2 = std::make_shared<nano::transport::fake::channel> (node);
+	nano::keepalive message{ nano::dev::network_params.network };
+	auto const size = message.to_shared_const_buffer ().size ();
+	auto const passing = 1024 / size;
+	for (std::size_t i = 0; i < passing + 4; ++i)
+	{
+		channel1->send (message);
+	}
+	ASSERT_EQ (passing, channel1->traffic.messages (nano::message_type::keepalive, nano::stat::dir::out));
+	ASSERT_EQ (passing * size, channel1->traffic.bytes (nano::message_type::keepalive, nano::stat::dir::out));
+	ASSERT_EQ (4, node.stats.count (nano::stat::type::drop, nano::stat::detail::keepalive, nano::stat::dir::out));
+	// Other peers have their own budget
+	channel2->send (message);
+	ASSERT_EQ (1, channel2->traffic.messages (nano::message_type::keepalive, nano::stat::dir::out));
+	// Messages that must not be dropped by limiters bypass the peer limit too
+	channel1->send (message, nullptr, nano::transport::buffer_drop_policy::no_limiter_drop);
+	ASSERT_EQ (passing + 1, channel1->traffic.messages (nano::message_type::keepalive, nano::stat::dir::out));
+}
+
+TEST (network, peer_bandwidth_limit_node_budget)
+{
+	nano::test::system system;
+	auto config = system.default_config ();
+	// Peers get 1024 bytes each and the node 2048 bytes in total, both refilled at a negligible rate
+	config.peer_bandwidth_limit = 1;
+	config.peer_bandwidth_burst_ratio = 1024;
+	config.bandwidth_limit = 1;
+	config.bandwidth_limit_burst_ratio = 2048;
+	auto & node = *system.add_node (config);
+	auto channel1 = std::make_shared<nano::transport::fake::channel> (node);
+	auto channel2 = std::make_shared<nano::transport::fake::channel> (node);
+	nano::keepalive message{ nano::dev::network_params.network };
+	auto const size = message.to_shared_const_buffer ().size ();
+	auto const passing = 1024 / size;
+	for (std::size_t i = 0; i < passing + 4; ++i)
+	{
+		channel1->send (message);
+	}
+	for (std::size_t i = 0; i < passing + 4; ++i)
+	{
+		channel2->send (message);
+	}
+	// Messages dropped by a peer limit leave the node wide budget to other peers
+	ASSERT_EQ (passing, channel1->traffic.messages (nano::message_type::keepalive, nano::stat::dir::out));
+	ASSERT_EQ (passing, channel2->traffic.messages (nano::message_type::keepalive, nano::stat::dir::out));
+}
+
+TEST (network, peer_bandwidth_limit_refund)
+{
+	nano::test::system system;
+	auto config = system.default_config ();
+	// The peer gets 2048 bytes and the node 1024 bytes, both refilled at a negligible rate
+	config.peer_bandwidth_limit = 1;
+	config.peer_bandwidth_burst_ratio = 2048;
+	config.bandwidth_limit = 1;
+	config.bandwidth_limit_burst_ratio = 1024;
+	auto & node = *system.add_node (config);
+	auto channel = std::make_shared<nano::transport::fake::channel> (node);
+	nano::keepalive message{ nano::dev::network_params.network };
+	auto const size = message.to_shared_const_buffer ().size ();
+	for (std::size_t i = 0; i < 1024 / size + 4; ++i)
+	{
+		channel->send (message);
+	}
+	ASSERT_EQ (1024 / size, channel->traffic.messages (nano::message_type::keepalive, nano::stat::dir::out));
+	// Messages dropped by the node limit leave the peer budget untouched
+	node.outbound_limiter.reset (0, 0);
+	for (std::size_t i = 0; i < 2048 / size + 4; ++i)
+	{
+		channel->send (message);
+	}
+	ASSERT_EQ (2048 / size, channel->traffic.messages (nano::message_type::keepalive, nano::stat::dir::out));
 }
 
 TEST (network, cleanup_purge)
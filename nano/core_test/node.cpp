@@ -3324,6 +3324,29 @@ TEST (node, dont_write_lock_node)
 	finished_promise.set_value ();
 }
 
+// Command line tools run inactive nodes on the data directory of a running node, they must leave its unchecked spill files alone
+TEST (node, inactive_node_unchecked_spill)
+{
+	auto path (nano::unique_path ());
+	std::filesystem::create_directories (path);
+	auto spill_path = path / "unchecked.spill.0";
+	{
+		std::ofstream spill{ spill_path };
+		spill << "spilled";
+	}
+	{
+		auto node_flags = nano::inactive_node_flag_defaults ();
+		node_flags.read_only = false;
+		nano::inactive_node node (path, node_flags);
+		ASSERT_FALSE (node.node->init_error ());
+	}
+	ASSERT_TRUE (std::filesystem::exists (spill_path));
+	std::ifstream spill{ spill_path };
+	std::string contents;
+	spill >> contents;
+	ASSERT_EQ ("spilled", contents);
+}
+
 TEST (node, bidirectional_tcp)
 {
 #ifdef _WIN32
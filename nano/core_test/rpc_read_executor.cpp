@@ -0,0 +1,85 @@
+#include <nano/lib/stats.hpp>
+#include <nano/node/rpc_read_executor.hpp>
+#include <nano/test_common/system.hpp>
+#include <nano/test_common/testutil.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <future>
+
+using namespace std::chrono_literals;
+
+TEST (rpc_read_executor, read_only_actions)
+{
+	ASSERT_EQ (nano::stat::detail::ledger, nano::rpc_read_executor::read_only ("ledger"));
+	// Aliases are recorded with the action they alias
+	ASSERT_EQ (nano::stat::detail::receivable, nano::rpc_read_executor::read_only ("pending"));
+	ASSERT_FALSE (nano::rpc_read_executor::read_only ("send"));
+	ASSERT_FALSE (nano::rpc_read_executor::read_only ("unknown"));
+}
+
+TEST (rpc_read_executor, admission)
+{
+	nano::test::system system;
+	nano::stats stats;
+	nano::rpc_read_executor_config config;
+	config.threads = 1;
+	config.max_queued = 2;
+	nano::rpc_read_executor executor{ config, stats };
+	std::promise<void> release;
+	std::shared_future<void> released{ release.get_future () };
+	std::atomic<int> done{ 0 };
+	auto task = [released, &done] () {
+		released.wait ();
+		++done;
+	};
+	// One running and one waiting saturate the executor
+	ASSERT_FALSE (executor.push (nano::stat::detail::ledger, task));
+	ASSERT_FALSE (executor.push (nano::stat::detail::ledger, task));
+	ASSERT_TRUE (executor.push (nano::stat::detail::ledger, task));
+	ASSERT_EQ (1, stats.count (nano::stat::type::rpc_read, nano::stat::detail::overfill));
+	release.set_value ();
+	ASSERT_TIMELY_EQ (5s, done, 2);
+	ASSERT_TIMELY (5s, !executor.push (nano::stat::detail::ledger, task));
+	ASSERT_TIMELY_EQ (5s, done, 3);
+	ASSERT_EQ (3, stats.count (nano::stat::type::rpc_read, nano::stat::detail::ledger));
+	// Run times are recorded once each task returns
+	auto recorded = [&stats] () {
+		uint64_t result{ 0 };
+		for (auto const & bin : stats.get_histogram (nano::stat::type::rpc_read, nano::stat::detail::ledger, nano::stat::dir::out)->get_bins ())
+		{
+			result += bin.value;
+		}
+		return result;
+	};
+	ASSERT_TIMELY_EQ (5s, recorded (), 3);
+}
+
+TEST (rpc_read_executor, slots)
+{
+	nano::test::system system;
+	nano::stats stats;
+	nano::rpc_read_executor_config config;
+	config.threads = 1;
+	config.max_queued = 4;
+	nano::rpc_read_executor executor{ config, stats };
+	std::promise<void> release;
+	std::shared_future<void> released{ release.get_future () };
+	std::atomic<int> done{ 0 };
+	auto task = [released, &done] () {
+		released.wait ();
+		++done;
+	};
+	// A batch of three actions takes three of the four slots
+	ASSERT_FALSE (executor.push (nano::stat::detail::batch, task, 3));
+	ASSERT_TRUE (executor.push (nano::stat::detail::batch, task, 2));
+	ASSERT_FALSE (executor.push (nano::stat::detail::ledger, task));
+	ASSERT_TRUE (executor.push (nano::stat::detail::ledger, task));
+	// More actions than slots take every slot, waiting for the executor to be idle
+	ASSERT_TRUE (executor.push (nano::stat::detail::batch, task, 5));
+	release.set_value ();
+	ASSERT_TIMELY_EQ (5s, done, 2);
+	ASSERT_TIMELY (5s, !executor.push (nano::stat::detail::batch, task, 5));
+	ASSERT_TIMELY_EQ (5s, done, 3);
+}
@@ -0,0 +1,80 @@
+#include <nano/lib/logger_mt.hpp>
+#include <nano/lib/stats.hpp>
+#include <nano/node/make_store.hpp>
+#include <nano/secure/utility.hpp>
+#include <nano/store/account.hpp>
+#include <nano/store/component.hpp>
+#include <nano/test_common/testutil.hpp>
+
+#include <gtest/gtest.h>
+
+#include <boost/property_tree/ptree.hpp>
+
+using operation = nano::store::instrumentation::operation;
+
+TEST (store_instrumentation, disabled)
+{
+	nano::logger_mt logger;
+	auto store = nano::make_store (logger, nano::unique_path (), nano::dev::constants);
+	ASSERT_FALSE (store->init_error ());
+	ASSERT_FALSE (store->instrumentation.enabled ());
+	nano::account_info info{ 1, 2, 3, 4, 5, 6, nano::epoch::epoch_0 };
+	store->account.put (store->tx_begin_write (), nano::account{ 1 }, info);
+	ASSERT_TRUE (store->account.exists (store->tx_begin_read (), nano::account{ 1 }));
+	ASSERT_EQ (0, store->instrumentation.count (nano::tables::accounts, operation::put));
+	ASSERT_EQ (0, store->instrumentation.count (nano::tables::accounts, operation::get));
+}
+
+TEST (store_instrumentation, table_operations)
+{
+	nano::logger_mt logger;
+	auto store = nano::make_store (logger, nano::unique_path (), nano::dev::constants);
+	ASSERT_FALSE (store->init_error ());
+	auto & instrumentation = store->instrumentation;
+	instrumentation.enable (true);
+	nano::account_info info{ 1, 2, 3, 4, 5, 6, nano::epoch::epoch_0 };
+	{
+		auto transaction = store->tx_begin_write ();
+		store->account.put (transaction, nano::account{ 1 }, info);
+		store->account.put (transaction, nano::account{ 2 }, info);
+	}
+	ASSERT_EQ (2, instrumentation.count (nano::tables::accounts, operation::put));
+	ASSERT_LT (0, instrumentation.bytes (nano::tables::accounts, operation::put));
+	{
+		auto transaction = store->tx_begin_read ();
+		nano::account_info info_l;
+		ASSERT_FALSE (store->account.get (transaction, nano::account{ 1 }, info_l));
+		size_t count{ 0 };
+		for (auto i = store->account.begin (transaction), n = store->account.end (); i != n; ++i)
+		{
+			++count;
+		}
+		ASSERT_EQ (2, count);
+	}
+	ASSERT_EQ (1, instrumentation.count (nano::tables::accounts, operation::get));
+	ASSERT_EQ (instrumentation.bytes (nano::tables::accounts, operation::put) / 2, instrumentation.bytes (nano::tables::accounts, operation::get));
+	// The seek and a step per entry
+	ASSERT_EQ (3, instrumentation.count (nano::tables::accounts, operation::iterate));
+	ASSERT_EQ (1, instrumentation.count (nano::tables::accounts, operation::get, nano::thread_role::get ()));
+	store->account.del (store->tx_begin_write (), nano::account{ 1 });
+	ASSERT_EQ (1, instrumentation.count (nano::tables::accounts, operation::del));
+	ASSERT_EQ (0, instrumentation.count (nano::tables::blocks, operation::get));
+
+	boost::property_tree::ptree tree;
+	instrumentation.serialize (tree);
+	ASSERT_EQ ("true", tree.get<std::string> ("enabled"));
+	ASSERT_EQ (2, tree.get<uint64_t> ("tables.accounts.put.count"));
+
+	nano::stats stats;
+	instrumentation.flush (stats);
+	ASSERT_EQ (2, stats.count (nano::stat::type::store_put, nano::stat::detail::accounts, nano::stat::dir::in));
+	// Only the difference to the previous flush is added
+	instrumentation.flush (stats);
+	ASSERT_EQ (2, stats.count (nano::stat::type::store_put, nano::stat::detail::accounts, nano::stat::dir::in));
+
+	instrumentation.clear ();
+	ASSERT_EQ (0, instrumentation.count (nano::tables::accounts, operation::put));
+	instrumentation.enable (false);
+	store->account.put (store->tx_begin_write (), nano::account{ 3 }, info);
+	ASSERT_EQ (0, instrumentation.count (nano::tables::accounts, operation::put));
+}
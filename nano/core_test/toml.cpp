@@ -101,6 +101,7 @@ TEST (toml, rpc_config_deserialize_defaults)
 	ASSERT_EQ (conf.enable_control, defaults.enable_control);
 	ASSERT_EQ (conf.max_json_depth, defaults.max_json_depth);
 	ASSERT_EQ (conf.max_request_size, defaults.max_request_size);
+	ASSERT_EQ (conf.max_batch_size, defaults.max_batch_size);
 	ASSERT_EQ (conf.port, defaults.port);
 
 	ASSERT_EQ (conf.rpc_process.io_threads, defaults.rpc_process.io_threads);
@@ -146,6 +147,8 @@ TEST (toml, daemon_config_deserialize_defaults)
 	ASSERT_EQ (conf.opencl.threads, defaults.opencl.threads);
 	ASSERT_EQ (conf.rpc_enable, defaults.rpc_enable);
 	ASSERT_EQ (conf.rpc.enable_sign_hash, defaults.rpc.enable_sign_hash);
+	ASSERT_EQ (conf.rpc.max_batch_size, defaults.rpc.max_batch_size);
+	ASSERT_EQ (conf.rpc.max_listing_count, defaults.rpc.max_listing_count);
 	ASSERT_EQ (conf.rpc.child_process.enable, defaults.rpc.child_process.enable);
 	ASSERT_EQ (conf.rpc.child_process.rpc_path, defaults.rpc.child_process.rpc_path);
 
@@ -156,6 +159,9 @@ TEST (toml, daemon_config_deserialize_defaults)
 	ASSERT_EQ (conf.node.bandwidth_limit_burst_ratio, defaults.node.bandwidth_limit_burst_ratio);
 	ASSERT_EQ (conf.node.bootstrap_bandwidth_limit, defaults.node.bootstrap_bandwidth_limit);
 	ASSERT_EQ (conf.node.bootstrap_bandwidth_burst_ratio, defaults.node.bootstrap_bandwidth_burst_ratio);
+	ASSERT_EQ (conf.node.peer_bandwidth_limit, defaults.node.peer_bandwidth_limit);
+	ASSERT_EQ (conf.node.peer_bandwidth_burst_ratio, defaults.node.peer_bandwidth_burst_ratio);
+	ASSERT_EQ (conf.node.adaptive_flooding, defaults.node.adaptive_flooding);
 	ASSERT_EQ (conf.node.block_processor_batch_max_time, defaults.node.block_processor_batch_max_time);
 	ASSERT_EQ (conf.node.block_process_timeout, defaults.node.block_process_timeout);
 	ASSERT_EQ (conf.node.bootstrap_connections, defaults.node.bootstrap_connections);
@@ -186,6 +192,7 @@ TEST (toml, daemon_config_deserialize_defaults)
 	ASSERT_EQ (conf.node.tcp_incoming_connections_max, defaults.node.tcp_incoming_connections_max);
 	ASSERT_EQ (conf.node.tcp_io_timeout, defaults.node.tcp_io_timeout);
 	ASSERT_EQ (conf.node.unchecked_cutoff_time, defaults.node.unchecked_cutoff_time);
+	ASSERT_EQ (conf.node.unchecked_spill_max, defaults.node.unchecked_spill_max);
 	ASSERT_EQ (conf.node.use_memory_pools, defaults.node.use_memory_pools);
 	ASSERT_EQ (conf.node.vote_generator_delay, defaults.node.vote_generator_delay);
 	ASSERT_EQ (conf.node.vote_generator_threshold, defaults.node.vote_generator_threshold);
@@ -193,6 +200,7 @@ TEST (toml, daemon_config_deserialize_defaults)
 	ASSERT_EQ (conf.node.work_peers, defaults.node.work_peers);
 	ASSERT_EQ (conf.node.work_threads, defaults.node.work_threads);
 	ASSERT_EQ (conf.node.max_queued_requests, defaults.node.max_queued_requests);
+	ASSERT_EQ (conf.node.peer_selection, defaults.node.peer_selection);
 	ASSERT_EQ (conf.node.backlog_scan_batch_size, defaults.node.backlog_scan_batch_size);
 	ASSERT_EQ (conf.node.backlog_scan_frequency, defaults.node.backlog_scan_frequency);
 
@@ -263,10 +271,14 @@ TEST (toml, daemon_config_deserialize_defaults)
 	ASSERT_EQ (conf.node.lmdb_config.sync, defaults.node.lmdb_config.sync);
 	ASSERT_EQ (conf.node.lmdb_config.max_databases, defaults.node.lmdb_config.max_databases);
 	ASSERT_EQ (conf.node.lmdb_config.map_size, defaults.node.lmdb_config.map_size);
+	ASSERT_EQ (conf.node.lmdb_config.read_transaction_pool_size, defaults.node.lmdb_config.read_transaction_pool_size);
 
 	ASSERT_EQ (conf.node.rocksdb_config.enable, defaults.node.rocksdb_config.enable);
 	ASSERT_EQ (conf.node.rocksdb_config.memory_multiplier, defaults.node.rocksdb_config.memory_multiplier);
 	ASSERT_EQ (conf.node.rocksdb_config.io_threads, defaults.node.rocksdb_config.io_threads);
+	ASSERT_EQ (conf.node.rocksdb_config.bloom_filter_bits, defaults.node.rocksdb_config.bloom_filter_bits);
+	ASSERT_EQ (conf.node.rocksdb_config.pending_prefix_bloom, defaults.node.rocksdb_config.pending_prefix_bloom);
+	ASSERT_EQ (conf.node.rocksdb_config.partitioned_index_filters, defaults.node.rocksdb_config.partitioned_index_filters);
 
 	ASSERT_EQ (conf.node.optimistic_scheduler.enabled, defaults.node.optimistic_scheduler.enabled);
 	ASSERT_EQ (conf.node.optimistic_scheduler.gap_threshold, defaults.node.optimistic_scheduler.gap_threshold);
@@ -278,6 +290,13 @@ TEST (toml, daemon_config_deserialize_defaults)
 
 	ASSERT_EQ (conf.node.vote_cache.max_size, defaults.node.vote_cache.max_size);
 	ASSERT_EQ (conf.node.vote_cache.max_voters, defaults.node.vote_cache.max_voters);
+
+	ASSERT_EQ (conf.node.bootstrap_server.threads, defaults.node.bootstrap_server.threads);
+	ASSERT_EQ (conf.node.bootstrap_server.cache_size, defaults.node.bootstrap_server.cache_size);
+	ASSERT_EQ (conf.node.bootstrap_server.cache_timeout, defaults.node.bootstrap_server.cache_timeout);
+
+	ASSERT_EQ (conf.node.rpc_read_executor.threads, defaults.node.rpc_read_executor.threads);
+	ASSERT_EQ (conf.node.rpc_read_executor.max_queued, defaults.node.rpc_read_executor.max_queued);
 }
 
 TEST (toml, optional_child)
@@ -412,6 +431,9 @@ TEST (toml, daemon_config_deserialize_no_defaults)
 	bandwidth_limit_burst_ratio = 999.9
 	bootstrap_bandwidth_limit = 999
 	bootstrap_bandwidth_burst_ratio = 999.9
+	peer_bandwidth_limit = 999
+	peer_bandwidth_burst_ratio = 999.9
+	adaptive_flooding = false
 	block_processor_batch_max_time = 999
 	block_process_timeout = 999
 	bootstrap_connections = 999
@@ -441,6 +463,7 @@ TEST (toml, daemon_config_deserialize_no_defaults)
 	tcp_incoming_connections_max = 999
 	tcp_io_timeout = 999
 	unchecked_cutoff_time = 999
+	unchecked_spill_max = 999
 	use_memory_pools = false
 	vote_generator_delay = 999
 	vote_generator_threshold = 9
@@ -450,6 +473,7 @@ TEST (toml, daemon_config_deserialize_no_defaults)
 	max_work_generate_multiplier = 1.0
 	max_queued_requests = 999
 	frontiers_confirmation = "always"
+	peer_selection = "random"
 	backlog_scan_batch_size = 999
 	backlog_scan_frequency = 999
 
@@ -533,6 +557,7 @@ TEST (toml, daemon_config_deserialize_no_defaults)
 	sync = "nosync_safe"
 	max_databases = 999
 	map_size = 999
+	read_transaction_pool_size = 999
 
 	[node.optimistic_scheduler]
 	enabled = false
@@ -548,6 +573,9 @@ TEST (toml, daemon_config_deserialize_no_defaults)
 	enable = true
 	memory_multiplier = 3
 	io_threads = 99
+	bloom_filter_bits = 16
+	pending_prefix_bloom = false
+	partitioned_index_filters = true
 
 	[node.experimental]
 	secondary_work_peers = ["dev.org:998"]
@@ -558,6 +586,15 @@ TEST (toml, daemon_config_deserialize_no_defaults)
 	max_size = 999
 	max_voters = 999
 
+	[node.bootstrap_server]
+	threads = 999
+	cache_size = 999
+	cache_timeout = 999
+
+	[node.rpc_read_executor]
+	threads = 999
+	max_queued = 999
+
 	[opencl]
 	device = 999
 	enable = true
@@ -567,6 +604,8 @@ TEST (toml, daemon_config_deserialize_no_defaults)
 	[rpc]
 	enable = true
 	enable_sign_hash = true
+	max_batch_size = 999
+	max_listing_count = 999
 
 	[rpc.child_process]
 	enable = true
@@ -587,6 +626,8 @@ TEST (toml, daemon_config_deserialize_no_defaults)
 	ASSERT_NE (conf.opencl.threads, defaults.opencl.threads);
 	ASSERT_NE (conf.rpc_enable, defaults.rpc_enable);
 	ASSERT_NE (conf.rpc.enable_sign_hash, defaults.rpc.enable_sign_hash);
+	ASSERT_NE (conf.rpc.max_batch_size, defaults.rpc.max_batch_size);
+	ASSERT_NE (conf.rpc.max_listing_count, defaults.rpc.max_listing_count);
 	ASSERT_NE (conf.rpc.child_process.enable, defaults.rpc.child_process.enable);
 	ASSERT_NE (conf.rpc.child_process.rpc_path, defaults.rpc.child_process.rpc_path);
 
@@ -597,6 +638,9 @@ TEST (toml, daemon_config_deserialize_no_defaults)
 	ASSERT_NE (conf.node.bandwidth_limit_burst_ratio, defaults.node.bandwidth_limit_burst_ratio);
 	ASSERT_NE (conf.node.bootstrap_bandwidth_limit, defaults.node.bootstrap_bandwidth_limit);
 	ASSERT_NE (conf.node.bootstrap_bandwidth_burst_ratio, defaults.node.bootstrap_bandwidth_burst_ratio);
+	ASSERT_NE (conf.node.peer_bandwidth_limit, defaults.node.peer_bandwidth_limit);
+	ASSERT_NE (conf.node.peer_bandwidth_burst_ratio, defaults.node.peer_bandwidth_burst_ratio);
+	ASSERT_NE (conf.node.adaptive_flooding, defaults.node.adaptive_flooding);
 	ASSERT_NE (conf.node.block_processor_batch_max_time, defaults.node.block_processor_batch_max_time);
 	ASSERT_NE (conf.node.block_process_timeout, defaults.node.block_process_timeout);
 	ASSERT_NE (conf.node.bootstrap_connections, defaults.node.bootstrap_connections);
@@ -613,6 +657,7 @@ TEST (toml, daemon_config_deserialize_no_defaults)
 	ASSERT_NE (conf.node.io_threads, defaults.node.io_threads);
 	ASSERT_NE (conf.node.max_work_generate_multiplier, defaults.node.max_work_generate_multiplier);
 	ASSERT_NE (conf.node.frontiers_confirmation, defaults.node.frontiers_confirmation);
+	ASSERT_NE (conf.node.peer_selection, defaults.node.peer_selection);
 	ASSERT_NE (conf.node.network_threads, defaults.node.network_threads);
 	ASSERT_NE (conf.node.background_threads, defaults.node.background_threads);
 	ASSERT_NE (conf.node.secondary_work_peers, defaults.node.secondary_work_peers);
@@ -630,6 +675,7 @@ TEST (toml, daemon_config_deserialize_no_defaults)
 	ASSERT_NE (conf.node.tcp_incoming_connections_max, defaults.node.tcp_incoming_connections_max);
 	ASSERT_NE (conf.node.tcp_io_timeout, defaults.node.tcp_io_timeout);
 	ASSERT_NE (conf.node.unchecked_cutoff_time, defaults.node.unchecked_cutoff_time);
+	ASSERT_NE (conf.node.unchecked_spill_max, defaults.node.unchecked_spill_max);
 	ASSERT_NE (conf.node.use_memory_pools, defaults.node.use_memory_pools);
 	ASSERT_NE (conf.node.vote_generator_delay, defaults.node.vote_generator_delay);
 	ASSERT_NE (conf.node.vote_generator_threshold, defaults.node.vote_generator_threshold);
@@ -707,11 +753,15 @@ TEST (toml, daemon_config_deserialize_no_defaults)
 	ASSERT_NE (conf.node.lmdb_config.sync, defaults.node.lmdb_config.sync);
 	ASSERT_NE (conf.node.lmdb_config.max_databases, defaults.node.lmdb_config.max_databases);
 	ASSERT_NE (conf.node.lmdb_config.map_size, defaults.node.lmdb_config.map_size);
+	ASSERT_NE (conf.node.lmdb_config.read_transaction_pool_size, defaults.node.lmdb_config.read_transaction_pool_size);
 
 	ASSERT_TRUE (conf.node.rocksdb_config.enable);
 	ASSERT_EQ (nano::rocksdb_config::using_rocksdb_in_tests (), defaults.node.rocksdb_config.enable);
 	ASSERT_NE (conf.node.rocksdb_config.memory_multiplier, defaults.node.rocksdb_config.memory_multiplier);
 	ASSERT_NE (conf.node.rocksdb_config.io_threads, defaults.node.rocksdb_config.io_threads);
+	ASSERT_NE (conf.node.rocksdb_config.bloom_filter_bits, defaults.node.rocksdb_config.bloom_filter_bits);
+	ASSERT_NE (conf.node.rocksdb_config.pending_prefix_bloom, defaults.node.rocksdb_config.pending_prefix_bloom);
+	ASSERT_NE (conf.node.rocksdb_config.partitioned_index_filters, defaults.node.rocksdb_config.partitioned_index_filters);
 
 	ASSERT_NE (conf.node.optimistic_scheduler.enabled, defaults.node.optimistic_scheduler.enabled);
 	ASSERT_NE (conf.node.optimistic_scheduler.gap_threshold, defaults.node.optimistic_scheduler.gap_threshold);
@@ -723,6 +773,13 @@ TEST (toml, daemon_config_deserialize_no_defaults)
 
 	ASSERT_NE (conf.node.vote_cache.max_size, defaults.node.vote_cache.max_size);
 	ASSERT_NE (conf.node.vote_cache.max_voters, defaults.node.vote_cache.max_voters);
+
+	ASSERT_NE (conf.node.bootstrap_server.threads, defaults.node.bootstrap_server.threads);
+	ASSERT_NE (conf.node.bootstrap_server.cache_size, defaults.node.bootstrap_server.cache_size);
+	ASSERT_NE (conf.node.bootstrap_server.cache_timeout, defaults.node.bootstrap_server.cache_timeout);
+
+	ASSERT_NE (conf.node.rpc_read_executor.threads, defaults.node.rpc_read_executor.threads);
+	ASSERT_NE (conf.node.rpc_read_executor.max_queued, defaults.node.rpc_read_executor.max_queued);
 }
 
 /** There should be no required values **/
@@ -767,6 +824,7 @@ TEST (toml, rpc_config_deserialize_no_defaults)
 	enable_control = true
 	max_json_depth = 9
 	max_request_size = 999
+	max_batch_size = 999
 	port = 999
 	[process]
 	io_threads = 999
@@ -789,6 +847,7 @@ TEST (toml, rpc_config_deserialize_no_defaults)
 	ASSERT_NE (conf.enable_control, defaults.enable_control);
 	ASSERT_NE (conf.max_json_depth, defaults.max_json_depth);
 	ASSERT_NE (conf.max_request_size, defaults.max_request_size);
+	ASSERT_NE (conf.max_batch_size, defaults.max_batch_size);
 	ASSERT_NE (conf.port, defaults.port);
 
 	ASSERT_NE (conf.rpc_process.io_threads, defaults.rpc_process.io_threads);
@@ -9,6 +9,7 @@
 
 #include <gtest/gtest.h>
 
+#include <filesystem>
 #include <memory>
 
 using namespace std::chrono_literals;
@@ -72,9 +73,10 @@ TEST (block_store, one_bootstrap)
 	// Waits for the block1 to get saved in the database
 	ASSERT_TIMELY (10s, check_block_is_listed (block1->hash ()));
 	std::vector<nano::block_hash> dependencies;
-	unchecked.for_each ([&dependencies] (nano::unchecked_key const & key, nano::unchecked_info const & info) {
+	for (auto const & [key, info] : unchecked.list ())
+	{
 		dependencies.push_back (key.key ());
-	});
+	}
 	auto hash1 = dependencies[0];
 	ASSERT_EQ (block1->hash (), hash1);
 	auto blocks = unchecked.get (hash1);
@@ -230,11 +232,7 @@ TEST (unchecked, multiple_get)
 	// count the number of blocks in the unchecked table by counting them one by one
 	// we cannot trust the count() method if the backend is rocksdb
 	auto count_unchecked_blocks_one_by_one = [&unchecked] () {
-		size_t count = 0;
-		unchecked.for_each ([&count] (nano::unchecked_key const & key, nano::unchecked_info const & info) {
-			++count;
-		});
-		return count;
+		return unchecked.list ().size ();
 	};
 
 	// Waits for the blocks to get saved in the database
@@ -275,3 +273,142 @@ TEST (unchecked, multiple_get)
 	auto unchecked5 = unchecked.get (block2->hash ());
 	ASSERT_EQ (unchecked5.size (), 0);
 }
+
+// Entries evicted from memory are kept in the spill file and still satisfied when their dependency arrives
+TEST (unchecked, spill)
+{
+	nano::test::system system{};
+	// Limits are split between the shards, all entries below share a dependency and so a shard
+	nano::unchecked_map unchecked{ system.stats, false, nano::unique_path (), 2 * nano::unchecked_map::shard_count, nano::unchecked_map::shard_count };
+	nano::block_builder builder;
+	std::vector<std::shared_ptr<nano::block>> blocks;
+	for (auto i = 0; i < 3; ++i)
+	{
+		blocks.push_back (builder
+						  .send ()
+						  .previous (4)
+						  .destination (i)
+						  .balance (2)
+						  .sign (nano::keypair ().prv, 4)
+						  .work (5)
+						  .build_shared ());
+		unchecked.put (blocks.back ()->previous (), nano::unchecked_info (blocks.back ()));
+	}
+	// One entry in memory, two on disk
+	ASSERT_EQ (3, unchecked.count ());
+	ASSERT_EQ (2, unchecked.spilled ());
+	ASSERT_EQ (2, system.stats.count (nano::stat::type::unchecked, nano::stat::detail::spill));
+	for (auto const & block : blocks)
+	{
+		ASSERT_TRUE (unchecked.exists (nano::unchecked_key{ block->previous (), block->hash () }));
+	}
+	auto listing = unchecked.get (nano::block_hash{ 4 });
+	ASSERT_EQ (3, listing.size ());
+	for (auto const & block : blocks)
+	{
+		ASSERT_TRUE (std::any_of (listing.begin (), listing.end (), [&block] (auto const & info) { return *info.block == *block; }));
+	}
+	// The spill limit drops the oldest spilled entry
+	auto block = builder
+				 .send ()
+				 .previous (4)
+				 .destination (3)
+				 .balance (2)
+				 .sign (nano::keypair ().prv, 4)
+				 .work (5)
+				 .build_shared ();
+	unchecked.put (block->previous (), nano::unchecked_info (block));
+	ASSERT_EQ (3, unchecked.count ());
+	ASSERT_EQ (1, system.stats.count (nano::stat::type::unchecked, nano::stat::detail::spill_overflow));
+	ASSERT_FALSE (unchecked.exists (nano::unchecked_key{ blocks[0]->previous (), blocks[0]->hash () }));
+	// Triggering the dependency pulls back the spilled entries
+	std::atomic<unsigned> satisfied{ 0 };
+	unchecked.satisfied.add ([&satisfied] (nano::unchecked_info const &) { ++satisfied; });
+	unchecked.trigger (nano::block_hash{ 4 });
+	ASSERT_TIMELY (5s, satisfied == 3);
+	ASSERT_TIMELY (5s, unchecked.count () == 0);
+	ASSERT_EQ (0, unchecked.spilled ());
+}
+
+// Spilled entries that cannot be read back are dropped instead of stopping the node
+TEST (unchecked, spill_read_error)
+{
+	nano::test::system system{};
+	auto const path = nano::unique_path () / "unchecked.spill";
+	nano::unchecked_map unchecked{ system.stats, false, path, 2 * nano::unchecked_map::shard_count, nano::unchecked_map::shard_count };
+	nano::block_builder builder;
+	std::vector<std::shared_ptr<nano::block>> blocks;
+	for (auto i = 0; i < 3; ++i)
+	{
+		blocks.push_back (builder
+						  .send ()
+						  .previous (4)
+						  .destination (i)
+						  .balance (2)
+						  .sign (nano::keypair ().prv, 4)
+						  .work (5)
+						  .build_shared ());
+		unchecked.put (blocks.back ()->previous (), nano::unchecked_info (blocks.back ()));
+	}
+	ASSERT_EQ (2, unchecked.spilled ());
+	// Lose the spilled entries from under the open file
+	for (auto i = 0u; i < nano::unchecked_map::shard_count; ++i)
+	{
+		auto shard_path = path;
+		shard_path += "." + std::to_string (i);
+		if (std::filesystem::exists (shard_path))
+		{
+			std::filesystem::resize_file (shard_path, 0);
+		}
+	}
+	auto listing = unchecked.get (nano::block_hash{ 4 });
+	ASSERT_EQ (1, listing.size ());
+	ASSERT_EQ (*blocks[2], *listing[0].block);
+	ASSERT_EQ (2, system.stats.count (nano::stat::type::unchecked, nano::stat::detail::spill_error));
+	ASSERT_EQ (0, unchecked.spilled ());
+	ASSERT_EQ (1, unchecked.count ());
+	// The spill keeps working afterwards
+	auto block = builder
+				 .send ()
+				 .previous (4)
+				 .destination (3)
+				 .balance (2)
+				 .sign (nano::keypair ().prv, 4)
+				 .work (5)
+				 .build_shared ();
+	unchecked.put (block->previous (), nano::unchecked_info (block));
+	ASSERT_EQ (1, unchecked.spilled ());
+	ASSERT_EQ (2, unchecked.get (nano::block_hash{ 4 }).size ());
+}
+
+// Extracting the entries of a dependency leaves the entries of other dependencies in place
+TEST (unchecked, extract)
+{
+	nano::test::system system{};
+	nano::unchecked_map unchecked{ system.stats, false };
+	auto block1 = block ();
+	nano::block_builder builder;
+	auto block2 = builder
+				  .send ()
+				  .previous (4)
+				  .destination (1)
+				  .balance (2)
+				  .sign (nano::keypair ().prv, 4)
+				  .work (5)
+				  .build_shared ();
+	unchecked.put (block1->previous (), nano::unchecked_info (block1));
+	unchecked.put (block1->hash (), nano::unchecked_info (block2));
+	unchecked.put (block2->previous (), nano::unchecked_info (block2));
+	ASSERT_EQ (3, unchecked.list ().size ());
+	ASSERT_EQ (2, unchecked.list (2).size ());
+	auto found = unchecked.find (block1->hash ());
+	ASSERT_TRUE (found.has_value ());
+	ASSERT_EQ (block1->previous (), found->first.key ());
+	auto extracted = unchecked.extract (block1->hash ());
+	ASSERT_EQ (1, extracted.size ());
+	ASSERT_EQ (*block2, *extracted[0].second.block);
+	ASSERT_TRUE (unchecked.extract (block1->hash ()).empty ());
+	ASSERT_EQ (2, unchecked.count ());
+	ASSERT_TRUE (unchecked.exists (nano::unchecked_key{ block2->previous (), block2->hash () }));
+	ASSERT_FALSE (unchecked.find (nano::block_hash{ 1 }).has_value ());
+}
@@ -33,6 +33,19 @@ TEST (rate, basic)
 	ASSERT_EQ (bucket.largest_burst (), 10);
 }
 
+TEST (rate, refund)
+{
+	nano::rate::token_bucket bucket (10, 1);
+	ASSERT_TRUE (bucket.try_consume (8));
+	bucket.refund (5);
+	ASSERT_TRUE (bucket.try_consume (7));
+	ASSERT_FALSE (bucket.try_consume (1));
+	// Refunds never fill the bucket beyond its capacity
+	bucket.refund (100);
+	ASSERT_FALSE (bucket.try_consume (11));
+	ASSERT_TRUE (bucket.try_consume (10));
+}
+
 TEST (rate, network)
 {
 	// For the purpose of the test, one token represents 1MB instead of one byte.
@@ -1,5 +1,6 @@
 #include <nano/crypto_lib/random_pool.hpp>
 #include <nano/lib/blocks.hpp>
+#include <nano/lib/json_reader.hpp>
 #include <nano/lib/memory.hpp>
 #include <nano/lib/numbers.hpp>
 #include <nano/lib/threading.hpp>
@@ -34,6 +35,203 @@ std::shared_ptr<block> deserialize_block (nano::stream & stream_a)
 
 	return result;
 }
+
+/** Fields of a JSON block, read through either a ptree or a json_value */
+template <typename Tree>
+bool deserialize_json_fields (nano::send_block & block_a, Tree const & tree_a)
+{
+	auto error (false);
+	try
+	{
+		auto previous_l (tree_a.template get<std::string> ("previous"));
+		auto destination_l (tree_a.template get<std::string> ("destination"));
+		auto balance_l (tree_a.template get<std::string> ("balance"));
+		auto signature_l (tree_a.template get<std::string> ("signature"));
+		auto work_l (tree_a.template get<std::string> ("work"));
+		error = block_a.hashables.previous.decode_hex (previous_l);
+		if (!error)
+		{
+			error = block_a.hashables.destination.decode_account (destination_l);
+			if (!error)
+			{
+				error = block_a.hashables.balance.decode_hex (balance_l);
+				if (!error)
+				{
+					error = block_a.signature.decode_hex (signature_l);
+					if (!error)
+					{
+						error = nano::from_string_hex (work_l, block_a.work);
+					}
+				}
+			}
+		}
+	}
+	catch (std::runtime_error const &)
+	{
+		error = true;
+	}
+	return error;
+}
+
+template <typename Tree>
+bool deserialize_json_fields (nano::receive_block & block_a, Tree const & tree_a)
+{
+	auto error (false);
+	try
+	{
+		auto previous_l (tree_a.template get<std::string> ("previous"));
+		auto source_l (tree_a.template get<std::string> ("source"));
+		auto signature_l (tree_a.template get<std::string> ("signature"));
+		auto work_l (tree_a.template get<std::string> ("work"));
+		error = block_a.hashables.previous.decode_hex (previous_l);
+		if (!error)
+		{
+			error = block_a.hashables.source.decode_hex (source_l);
+			if (!error)
+			{
+				error = block_a.signature.decode_hex (signature_l);
+				if (!error)
+				{
+					error = nano::from_string_hex (work_l, block_a.work);
+				}
+			}
+		}
+	}
+	catch (std::runtime_error const &)
+	{
+		error = true;
+	}
+	return error;
+}
+
+template <typename Tree>
+bool deserialize_json_fields (nano::open_block & block_a, Tree const & tree_a)
+{
+	auto error (false);
+	try
+	{
+		auto source_l (tree_a.template get<std::string> ("source"));
+		auto representative_l (tree_a.template get<std::string> ("representative"));
+		auto account_l (tree_a.template get<std::string> ("account"));
+		auto work_l (tree_a.template get<std::string> ("work"));
+		auto signature_l (tree_a.template get<std::string> ("signature"));
+		error = block_a.hashables.source.decode_hex (source_l);
+		if (!error)
+		{
+			error = block_a.hashables.representative.decode_account (representative_l);
+			if (!error)
+			{
+				error = block_a.hashables.account.decode_account (account_l);
+				if (!error)
+				{
+					error = nano::from_string_hex (work_l, block_a.work);
+					if (!error)
+					{
+						error = block_a.signature.decode_hex (signature_l);
+					}
+				}
+			}
+		}
+	}
+	catch (std::runtime_error const &)
+	{
+		error = true;
+	}
+	return error;
+}
+
+template <typename Tree>
+bool deserialize_json_fields (nano::change_block & block_a, Tree const & tree_a)
+{
+	auto error (false);
+	try
+	{
+		auto previous_l (tree_a.template get<std::string> ("previous"));
+		auto representative_l (tree_a.template get<std::string> ("representative"));
+		auto work_l (tree_a.template get<std::string> ("work"));
+		auto signature_l (tree_a.template get<std::string> ("signature"));
+		error = block_a.hashables.previous.decode_hex (previous_l);
+		if (!error)
+		{
+			error = block_a.hashables.representative.decode_account (representative_l);
+			if (!error)
+			{
+				error = nano::from_string_hex (work_l, block_a.work);
+				if (!error)
+				{
+					error = block_a.signature.decode_hex (signature_l);
+				}
+			}
+		}
+	}
+	catch (std::runtime_error const &)
+	{
+		error = true;
+	}
+	return error;
+}
+
+template <typename Tree>
+bool deserialize_json_fields (nano::state_block & block_a, Tree const & tree_a)
+{
+	auto error (false);
+	try
+	{
+		auto account_l (tree_a.template get<std::string> ("account"));
+		auto previous_l (tree_a.template get<std::string> ("previous"));
+		auto representative_l (tree_a.template get<std::string> ("representative"));
+		auto balance_l (tree_a.template get<std::string> ("balance"));
+		auto link_l (tree_a.template get<std::string> ("link"));
+		auto type_l (tree_a.template get<std::string> ("type"));
+		auto signature_l (tree_a.template get<std::string> ("signature"));
+		auto work_l (tree_a.template get<std::string> ("work"));
+		error = block_a.hashables.account.decode_account (account_l);
+		if (!error)
+		{
+			error = block_a.hashables.previous.decode_hex (previous_l);
+			if (!error)
+			{
+				error = block_a.hashables.representative.decode_account (representative_l);
+				if (!error)
+				{
+					error = block_a.hashables.balance.decode_dec (balance_l);
+					if (!error)
+					{
+						error = block_a.hashables.link.decode_account (link_l) && block_a.hashables.link.decode_hex (link_l);
+						if (!error)
+						{
+							error = type_l != "state";
+							if (!error)
+							{
+								error = nano::from_string_hex (work_l, block_a.work);
+								if (!error)
+								{
+									error = block_a.signature.decode_hex (signature_l);
+								}
+							}
+						}
+					}
+				}
+			}
+		}
+	}
+	catch (std::runtime_error const &)
+	{
+		error = true;
+	}
+	return error;
+}
+
+template <typename block>
+std::shared_ptr<nano::block> deserialize_block_json (nano::json_value const & tree_a)
+{
+	auto result = nano::make_shared<block> ();
+	if (deserialize_json_fields (*result, tree_a))
+	{
+		result = nullptr;
+	}
+	return result;
+}
 }
 
 void nano::block_memory_pool_purge ()
@@ -237,29 +435,6 @@ nano::send_hashables::send_hashables (bool & error_a, nano::stream & stream_a)
 	}
 }
 
-nano::send_hashables::send_hashables (bool & error_a, boost::property_tree::ptree const & tree_a)
-{
-	try
-	{
-		auto previous_l (tree_a.get<std::string> ("previous"));
-		auto destination_l (tree_a.get<std::string> ("destination"));
-		auto balance_l (tree_a.get<std::string> ("balance"));
-		error_a = previous.decode_hex (previous_l);
-		if (!error_a)
-		{
-			error_a = destination.decode_account (destination_l);
-			if (!error_a)
-			{
-				error_a = balance.decode_hex (balance_l);
-			}
-		}
-	}
-	catch (std::runtime_error const &)
-	{
-		error_a = true;
-	}
-}
-
 void nano::send_hashables::hash (blake2b_state & hash_a) const
 {
 	auto status (blake2b_update (&hash_a, previous.bytes.data (), sizeof (previous.bytes)));
@@ -385,26 +560,9 @@ nano::send_block::send_block (bool & error_a, nano::stream & stream_a) :
 	}
 }
 
-nano::send_block::send_block (bool & error_a, boost::property_tree::ptree const & tree_a) :
-	hashables (error_a, tree_a)
+nano::send_block::send_block (bool & error_a, boost::property_tree::ptree const & tree_a)
 {
-	if (!error_a)
-	{
-		try
-		{
-			auto signature_l (tree_a.get<std::string> ("signature"));
-			auto work_l (tree_a.get<std::string> ("work"));
-			error_a = signature.decode_hex (signature_l);
-			if (!error_a)
-			{
-				error_a = nano::from_string_hex (work_l, work);
-			}
-		}
-		catch (std::runtime_error const &)
-		{
-			error_a = true;
-		}
-	}
+	error_a = deserialize_json_fields (*this, tree_a);
 }
 
 bool nano::send_block::operator== (nano::block const & other_a) const
@@ -492,29 +650,6 @@ nano::open_hashables::open_hashables (bool & error_a, nano::stream & stream_a)
 	}
 }
 
-nano::open_hashables::open_hashables (bool & error_a, boost::property_tree::ptree const & tree_a)
-{
-	try
-	{
-		auto source_l (tree_a.get<std::string> ("source"));
-		auto representative_l (tree_a.get<std::string> ("representative"));
-		auto account_l (tree_a.get<std::string> ("account"));
-		error_a = source.decode_hex (source_l);
-		if (!error_a)
-		{
-			error_a = representative.decode_account (representative_l);
-			if (!error_a)
-			{
-				error_a = account.decode_account (account_l);
-			}
-		}
-	}
-	catch (std::runtime_error const &)
-	{
-		error_a = true;
-	}
-}
-
 void nano::open_hashables::hash (blake2b_state & hash_a) const
 {
 	blake2b_update (&hash_a, source.bytes.data (), sizeof (source.bytes));
@@ -559,26 +694,9 @@ nano::open_block::open_block (bool & error_a, nano::stream & stream_a) :
 	}
 }
 
-nano::open_block::open_block (bool & error_a, boost::property_tree::ptree const & tree_a) :
-	hashables (error_a, tree_a)
+nano::open_block::open_block (bool & error_a, boost::property_tree::ptree const & tree_a)
 {
-	if (!error_a)
-	{
-		try
-		{
-			auto work_l (tree_a.get<std::string> ("work"));
-			auto signature_l (tree_a.get<std::string> ("signature"));
-			error_a = nano::from_string_hex (work_l, work);
-			if (!error_a)
-			{
-				error_a = signature.decode_hex (signature_l);
-			}
-		}
-		catch (std::runtime_error const &)
-		{
-			error_a = true;
-		}
-	}
+	error_a = deserialize_json_fields (*this, tree_a);
 }
 
 void nano::open_block::hash (blake2b_state & hash_a) const
@@ -766,24 +884,6 @@ nano::change_hashables::change_hashables (bool & error_a, nano::stream & stream_
 	}
 }
 
-nano::change_hashables::change_hashables (bool & error_a, boost::property_tree::ptree const & tree_a)
-{
-	try
-	{
-		auto previous_l (tree_a.get<std::string> ("previous"));
-		auto representative_l (tree_a.get<std::string> ("representative"));
-		error_a = previous.decode_hex (previous_l);
-		if (!error_a)
-		{
-			error_a = representative.decode_account (representative_l);
-		}
-	}
-	catch (std::runtime_error const &)
-	{
-		error_a = true;
-	}
-}
-
 void nano::change_hashables::hash (blake2b_state & hash_a) const
 {
 	blake2b_update (&hash_a, previous.bytes.data (), sizeof (previous.bytes));
@@ -816,26 +916,9 @@ nano::change_block::change_block (bool & error_a, nano::stream & stream_a) :
 	}
 }
 
-nano::change_block::change_block (bool & error_a, boost::property_tree::ptree const & tree_a) :
-	hashables (error_a, tree_a)
+nano::change_block::change_block (bool & error_a, boost::property_tree::ptree const & tree_a)
 {
-	if (!error_a)
-	{
-		try
-		{
-			auto work_l (tree_a.get<std::string> ("work"));
-			auto signature_l (tree_a.get<std::string> ("signature"));
-			error_a = nano::from_string_hex (work_l, work);
-			if (!error_a)
-			{
-				error_a = signature.decode_hex (signature_l);
-			}
-		}
-		catch (std::runtime_error const &)
-		{
-			error_a = true;
-		}
-	}
+	error_a = deserialize_json_fields (*this, tree_a);
 }
 
 void nano::change_block::hash (blake2b_state & hash_a) const
@@ -1023,39 +1106,6 @@ nano::state_hashables::state_hashables (bool & error_a, nano::stream & stream_a)
 	}
 }
 
-nano::state_hashables::state_hashables (bool & error_a, boost::property_tree::ptree const & tree_a)
-{
-	try
-	{
-		auto account_l (tree_a.get<std::string> ("account"));
-		auto previous_l (tree_a.get<std::string> ("previous"));
-		auto representative_l (tree_a.get<std::string> ("representative"));
-		auto balance_l (tree_a.get<std::string> ("balance"));
-		auto link_l (tree_a.get<std::string> ("link"));
-		error_a = account.decode_account (account_l);
-		if (!error_a)
-		{
-			error_a = previous.decode_hex (previous_l);
-			if (!error_a)
-			{
-				error_a = representative.decode_account (representative_l);
-				if (!error_a)
-				{
-					error_a = balance.decode_dec (balance_l);
-					if (!error_a)
-					{
-						error_a = link.decode_account (link_l) && link.decode_hex (link_l);
-					}
-				}
-			}
-		}
-	}
-	catch (std::runtime_error const &)
-	{
-		error_a = true;
-	}
-}
-
 void nano::state_hashables::hash (blake2b_state & hash_a) const
 {
 	blake2b_update (&hash_a, account.bytes.data (), sizeof (account.bytes));
@@ -1094,31 +1144,9 @@ nano::state_block::state_block (bool & error_a, nano::stream & stream_a) :
 	}
 }
 
-nano::state_block::state_block (bool & error_a, boost::property_tree::ptree const & tree_a) :
-	hashables (error_a, tree_a)
+nano::state_block::state_block (bool & error_a, boost::property_tree::ptree const & tree_a)
 {
-	if (!error_a)
-	{
-		try
-		{
-			auto type_l (tree_a.get<std::string> ("type"));
-			auto signature_l (tree_a.get<std::string> ("signature"));
-			auto work_l (tree_a.get<std::string> ("work"));
-			error_a = type_l != "state";
-			if (!error_a)
-			{
-				error_a = nano::from_string_hex (work_l, work);
-				if (!error_a)
-				{
-					error_a = signature.decode_hex (signature_l);
-				}
-			}
-		}
-		catch (std::runtime_error const &)
-		{
-			error_a = true;
-		}
-	}
+	error_a = deserialize_json_fields (*this, tree_a);
 }
 
 void nano::state_block::hash (blake2b_state & hash_a) const
@@ -1362,6 +1390,37 @@ std::shared_ptr<nano::block> nano::deserialize_block_json (boost::property_tree:
 	return result;
 }
 
+std::shared_ptr<nano::block> nano::deserialize_block_json (nano::json_value const & tree_a, nano::block_uniquer * uniquer_a)
+{
+	std::shared_ptr<nano::block> result;
+	auto type (tree_a.get<std::string> ("type", ""));
+	if (type == "receive")
+	{
+		result = ::deserialize_block_json<nano::receive_block> (tree_a);
+	}
+	else if (type == "send")
+	{
+		result = ::deserialize_block_json<nano::send_block> (tree_a);
+	}
+	else if (type == "open")
+	{
+		result = ::deserialize_block_json<nano::open_block> (tree_a);
+	}
+	else if (type == "change")
+	{
+		result = ::deserialize_block_json<nano::change_block> (tree_a);
+	}
+	else if (type == "state")
+	{
+		result = ::deserialize_block_json<nano::state_block> (tree_a);
+	}
+	if (uniquer_a != nullptr)
+	{
+		result = uniquer_a->unique (result);
+	}
+	return result;
+}
+
 void nano::serialize_block_type (nano::stream & stream, const nano::block_type & type)
 {
 	nano::write (stream, type);
@@ -1549,26 +1608,9 @@ nano::receive_block::receive_block (bool & error_a, nano::stream & stream_a) :
 	}
 }
 
-nano::receive_block::receive_block (bool & error_a, boost::property_tree::ptree const & tree_a) :
-	hashables (error_a, tree_a)
+nano::receive_block::receive_block (bool & error_a, boost::property_tree::ptree const & tree_a)
 {
-	if (!error_a)
-	{
-		try
-		{
-			auto signature_l (tree_a.get<std::string> ("signature"));
-			auto work_l (tree_a.get<std::string> ("work"));
-			error_a = signature.decode_hex (signature_l);
-			if (!error_a)
-			{
-				error_a = nano::from_string_hex (work_l, work);
-			}
-		}
-		catch (std::runtime_error const &)
-		{
-			error_a = true;
-		}
-	}
+	error_a = deserialize_json_fields (*this, tree_a);
 }
 
 void nano::receive_block::hash (blake2b_state & hash_a) const
@@ -1658,24 +1700,6 @@ nano::receive_hashables::receive_hashables (bool & error_a, nano::stream & strea
 	}
 }
 
-nano::receive_hashables::receive_hashables (bool & error_a, boost::property_tree::ptree const & tree_a)
-{
-	try
-	{
-		auto previous_l (tree_a.get<std::string> ("previous"));
-		auto source_l (tree_a.get<std::string> ("source"));
-		error_a = previous.decode_hex (previous_l);
-		if (!error_a)
-		{
-			error_a = source.decode_hex (source_l);
-		}
-	}
-	catch (std::runtime_error const &)
-	{
-		error_a = true;
-	}
-}
-
 void nano::receive_hashables::hash (blake2b_state & hash_a) const
 {
 	blake2b_update (&hash_a, previous.bytes.data (), sizeof (previous.bytes));
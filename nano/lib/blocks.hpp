@@ -17,6 +17,7 @@
 namespace nano
 {
 class block_visitor;
+class json_value;
 class mutable_block_visitor;
 enum class block_type : uint8_t
 {
@@ -138,7 +139,6 @@ public:
 	send_hashables () = default;
 	send_hashables (nano::block_hash const &, nano::account const &, nano::amount const &);
 	send_hashables (bool &, nano::stream &);
-	send_hashables (bool &, boost::property_tree::ptree const &);
 	void hash (blake2b_state &) const;
 	nano::block_hash previous;
 	nano::account destination;
@@ -185,7 +185,6 @@ public:
 	receive_hashables () = default;
 	receive_hashables (nano::block_hash const &, nano::block_hash const &);
 	receive_hashables (bool &, nano::stream &);
-	receive_hashables (bool &, boost::property_tree::ptree const &);
 	void hash (blake2b_state &) const;
 	nano::block_hash previous;
 	nano::block_hash source;
@@ -230,7 +229,6 @@ public:
 	open_hashables () = default;
 	open_hashables (nano::block_hash const &, nano::account const &, nano::account const &);
 	open_hashables (bool &, nano::stream &);
-	open_hashables (bool &, boost::property_tree::ptree const &);
 	void hash (blake2b_state &) const;
 	nano::block_hash source;
 	nano::account representative;
@@ -279,7 +277,6 @@ public:
 	change_hashables () = default;
 	change_hashables (nano::block_hash const &, nano::account const &);
 	change_hashables (bool &, nano::stream &);
-	change_hashables (bool &, boost::property_tree::ptree const &);
 	void hash (blake2b_state &) const;
 	nano::block_hash previous;
 	nano::account representative;
@@ -324,7 +321,6 @@ public:
 	state_hashables () = default;
 	state_hashables (nano::account const &, nano::block_hash const &, nano::account const &, nano::amount const &, nano::link const &);
 	state_hashables (bool &, nano::stream &);
-	state_hashables (bool &, boost::property_tree::ptree const &);
 	void hash (blake2b_state &) const;
 	// Account# / public key that operates this account
 	// Uses:
@@ -421,6 +417,8 @@ std::unique_ptr<container_info_component> collect_container_info (block_uniquer
 std::shared_ptr<nano::block> deserialize_block (nano::stream &);
 std::shared_ptr<nano::block> deserialize_block (nano::stream &, nano::block_type, nano::block_uniquer * = nullptr);
 std::shared_ptr<nano::block> deserialize_block_json (boost::property_tree::ptree const &, nano::block_uniquer * = nullptr);
+/** Reads a block straight from a parsed JSON request without building a ptree */
+std::shared_ptr<nano::block> deserialize_block_json (nano::json_value const &, nano::block_uniquer * = nullptr);
 /**
  * Serialize block type as an 8-bit value
  */
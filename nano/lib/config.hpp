@@ -244,6 +244,7 @@ public:
 			telemetry_cache_cutoff = 2000ms;
 			telemetry_request_interval = 500ms;
 			telemetry_broadcast_interval = 500ms;
+			rtt_probe_interval = 1000ms;
 			optimistic_activation_delay = 2s;
 		}
 	}
@@ -295,6 +296,8 @@ public:
 	std::chrono::milliseconds telemetry_broadcast_interval{ 1000 * 60 };
 	/** Telemetry data older than this value is considered stale */
 	std::chrono::milliseconds telemetry_cache_cutoff{ 1000 * 130 }; // 2 * `telemetry_broadcast_interval` + some margin
+	/** Minimum time between round trip time probes sent to a peer, each one costs the peer a ledger read */
+	std::chrono::milliseconds rtt_probe_interval{ 1000 * 60 * 5 };
 
 	/** How much to delay activation of optimistic elections to avoid interfering with election scheduler */
 	std::chrono::seconds optimistic_activation_delay{ 30 };
@@ -0,0 +1,574 @@
+#include <nano/lib/json_reader.hpp>
+#include <nano/lib/utility.hpp>
+
+#include <boost/property_tree/ptree.hpp>
+
+#include <limits>
+
+namespace
+{
+bool is_digit (char c)
+{
+	return c >= '0' && c <= '9';
+}
+
+int hex_value (char c)
+{
+	if (c >= '0' && c <= '9')
+	{
+		return c - '0';
+	}
+	if (c >= 'A' && c <= 'F')
+	{
+		return c - 'A' + 10;
+	}
+	if (c >= 'a' && c <= 'f')
+	{
+		return c - 'a' + 10;
+	}
+	return -1;
+}
+
+/** Number of continuation bytes following a UTF-8 lead byte, -1 for bytes read_json rejects as a lead */
+int utf8_trailing (unsigned char c)
+{
+	static signed char const table[] = { -1, -1, -1, -1, -1, -1, -1, -1, 1, 1, 1, 1, 2, 2, 3, -1 };
+	return table[(c & 0x7f) >> 3];
+}
+}
+
+bool nano::json_reader::parse (std::string text_a)
+{
+	text = std::move (text_a);
+	tokens.clear ();
+	auto error = text.size () >= std::numeric_limits<uint32_t>::max ();
+	std::size_t position = 0;
+	// A byte order mark is skipped without looking at the bytes following its first one, same as read_json
+	if (!text.empty () && static_cast<unsigned char> (text[0]) == 0xef)
+	{
+		position = std::min<std::size_t> (3, text.size ());
+	}
+	// Containers which have been opened and not yet closed
+	std::vector<uint32_t> open;
+	auto done = false;
+	while (!error && !done)
+	{
+		// A value is expected at `position`
+		auto const depth = open.size ();
+		error = parse_value (position, open);
+		if (error || open.size () > depth)
+		{
+			// Either failed or a non empty container was opened and its first element is next
+			continue;
+		}
+		// The value is complete, close containers until one continues with another element
+		while (!error && !done)
+		{
+			skip_whitespace (position);
+			if (open.empty ())
+			{
+				done = true;
+				error = position != text.size ();
+			}
+			else if (position == text.size ())
+			{
+				error = true;
+			}
+			else
+			{
+				auto & container = tokens[open.back ()];
+				auto const object = container.type == token_type::object;
+				if (text[position] == ',')
+				{
+					++position;
+					if (object)
+					{
+						skip_whitespace (position);
+						error = position == text.size () || text[position] != '"' || parse_string (position);
+						skip_whitespace (position);
+						error = error || position == text.size () || text[position++] != ':';
+					}
+					break;
+				}
+				else if (text[position] == (object ? '}' : ']'))
+				{
+					++position;
+					container.end = static_cast<uint32_t> (tokens.size ());
+					open.pop_back ();
+				}
+				else
+				{
+					error = true;
+				}
+			}
+		}
+	}
+	if (error)
+	{
+		tokens.clear ();
+	}
+	return error;
+}
+
+nano::json_value nano::json_reader::root () const
+{
+	return tokens.empty () ? nano::json_value{} : nano::json_value{ *this, 0 };
+}
+
+bool nano::json_reader::parse_value (std::size_t & position, std::vector<uint32_t> & open)
+{
+	skip_whitespace (position);
+	if (position == text.size ())
+	{
+		return true;
+	}
+	auto error = false;
+	auto const c = text[position];
+	if (c == '{' || c == '[')
+	{
+		auto const object = c == '{';
+		auto const index = static_cast<uint32_t> (tokens.size ());
+		// The end of a container stays zero until it's closed
+		tokens.push_back ({ object ? token_type::object : token_type::array, static_cast<uint32_t> (position), 0, 0 });
+		open.push_back (index);
+		++position;
+		skip_whitespace (position);
+		if (position < text.size () && text[position] == (object ? '}' : ']'))
+		{
+			++position;
+			tokens[index].end = index + 1;
+			open.pop_back ();
+		}
+		else if (object)
+		{
+			error = position == text.size () || text[position] != '"' || parse_string (position);
+			skip_whitespace (position);
+			error = error || position == text.size () || text[position++] != ':';
+		}
+	}
+	else if (c == '"')
+	{
+		error = parse_string (position);
+	}
+	else if (c == 't')
+	{
+		error = parse_literal (position, "true");
+	}
+	else if (c == 'f')
+	{
+		error = parse_literal (position, "false");
+	}
+	else if (c == 'n')
+	{
+		error = parse_literal (position, "null");
+	}
+	else
+	{
+		error = parse_number (position);
+	}
+	return error;
+}
+
+bool nano::json_reader::parse_string (std::size_t & position)
+{
+	debug_assert (text[position] == '"');
+	auto const start = ++position;
+	// Unescaped text is never longer than its escaped form so it's written over the input
+	auto write = start;
+	auto put = [this, &write] (char c) { text[write++] = c; };
+	auto hex_quad = [this, &position] (unsigned & codepoint) {
+		codepoint = 0;
+		for (auto i = 0; i < 4; ++i, ++position)
+		{
+			auto const value = position < text.size () ? hex_value (text[position]) : -1;
+			if (value < 0)
+			{
+				return true;
+			}
+			codepoint = (codepoint << 4) | static_cast<unsigned> (value);
+		}
+		return false;
+	};
+	while (true)
+	{
+		if (position == text.size ())
+		{
+			return true;
+		}
+		auto const c = static_cast<unsigned char> (text[position]);
+		if (c == '"')
+		{
+			break;
+		}
+		if (c < 0x20)
+		{
+			return true;
+		}
+		if (c < 0x80 && c != '\\')
+		{
+			put (text[position++]);
+		}
+		else if (c >= 0x80)
+		{
+			auto const trailing = utf8_trailing (c);
+			if (trailing < 0)
+			{
+				return true;
+			}
+			put (text[position++]);
+			for (auto i = 0; i < trailing; ++i)
+			{
+				if (position == text.size () || (static_cast<unsigned char> (text[position]) & 0xc0) != 0x80)
+				{
+					return true;
+				}
+				put (text[position++]);
+			}
+		}
+		else
+		{
+			if (++position == text.size ())
+			{
+				return true;
+			}
+			switch (text[position++])
+			{
+				case '"':
+					put ('"');
+					break;
+				case '\\':
+					put ('\\');
+					break;
+				case '/':
+					put ('/');
+					break;
+				case 'b':
+					put ('\b');
+					break;
+				case 'f':
+					put ('\f');
+					break;
+				case 'n':
+					put ('\n');
+					break;
+				case 'r':
+					put ('\r');
+					break;
+				case 't':
+					put ('\t');
+					break;
+				case 'u':
+				{
+					unsigned codepoint;
+					if (hex_quad (codepoint) || (codepoint & 0xfc00) == 0xdc00)
+					{
+						return true;
+					}
+					if ((codepoint & 0xfc00) == 0xd800)
+					{
+						// A high surrogate must be followed by an escaped low surrogate
+						unsigned low;
+						if (position + 2 > text.size () || text[position] != '\\' || text[position + 1] != 'u')
+						{
+							return true;
+						}
+						position += 2;
+						if (hex_quad (low) || (low & 0xfc00) != 0xdc00)
+						{
+							return true;
+						}
+						codepoint = 0x10000 + (((codepoint & 0x3ff) << 10) | (low & 0x3ff));
+					}
+					if (codepoint <= 0x7f)
+					{
+						put (static_cast<char> (codepoint));
+					}
+					else if (codepoint <= 0x7ff)
+					{
+						put (static_cast<char> (0xc0 | (codepoint >> 6)));
+						put (static_cast<char> (0x80 | (codepoint & 0x3f)));
+					}
+					else if (codepoint <= 0xffff)
+					{
+						put (static_cast<char> (0xe0 | (codepoint >> 12)));
+						put (static_cast<char> (0x80 | ((codepoint >> 6) & 0x3f)));
+						put (static_cast<char> (0x80 | (codepoint & 0x3f)));
+					}
+					else
+					{
+						put (static_cast<char> (0xf0 | (codepoint >> 18)));
+						put (static_cast<char> (0x80 | ((codepoint >> 12) & 0x3f)));
+						put (static_cast<char> (0x80 | ((codepoint >> 6) & 0x3f)));
+						put (static_cast<char> (0x80 | (codepoint & 0x3f)));
+					}
+					break;
+				}
+				default:
+					return true;
+			}
+		}
+	}
+	++position;
+	auto const index = static_cast<uint32_t> (tokens.size ());
+	tokens.push_back ({ token_type::string, static_cast<uint32_t> (start), static_cast<uint32_t> (write - start), index + 1 });
+	return false;
+}
+
+bool nano::json_reader::parse_literal (std::size_t & position, std::string_view literal)
+{
+	if (std::string_view{ text }.substr (position, literal.size ()) != literal)
+	{
+		return true;
+	}
+	auto const index = static_cast<uint32_t> (tokens.size ());
+	tokens.push_back ({ token_type::literal, static_cast<uint32_t> (position), static_cast<uint32_t> (literal.size ()), index + 1 });
+	position += literal.size ();
+	return false;
+}
+
+bool nano::json_reader::parse_number (std::size_t & position)
+{
+	auto const start = position;
+	auto have = [this, &position] (auto predicate) {
+		auto const result = position < text.size () && predicate (text[position]);
+		position += result ? 1 : 0;
+		return result;
+	};
+	auto digits = [&have] () {
+		while (have (is_digit))
+		{
+		}
+	};
+	have ([] (char c) { return c == '-'; });
+	if (!have ([] (char c) { return c == '0'; }))
+	{
+		if (!have ([] (char c) { return c >= '1' && c <= '9'; }))
+		{
+			return true;
+		}
+		digits ();
+	}
+	if (have ([] (char c) { return c == '.'; }))
+	{
+		if (!have (is_digit))
+		{
+			return true;
+		}
+		digits ();
+	}
+	if (have ([] (char c) { return c == 'e' || c == 'E'; }))
+	{
+		have ([] (char c) { return c == '+' || c == '-'; });
+		if (!have (is_digit))
+		{
+			return true;
+		}
+		digits ();
+	}
+	auto const index = static_cast<uint32_t> (tokens.size ());
+	tokens.push_back ({ token_type::literal, static_cast<uint32_t> (start), static_cast<uint32_t> (position - start), index + 1 });
+	return false;
+}
+
+void nano::json_reader::skip_whitespace (std::size_t & position) const
+{
+	while (position < text.size () && (text[position] == ' ' || text[position] == '\t' || text[position] == '\n' || text[position] == '\r'))
+	{
+		++position;
+	}
+}
+
+std::string_view nano::json_reader::text_of (token const & token_a) const
+{
+	return std::string_view{ text }.substr (token_a.offset, token_a.size);
+}
+
+nano::json_value::json_value (nano::json_reader const & reader_a, uint32_t index_a) :
+	reader{ &reader_a },
+	index{ index_a }
+{
+}
+
+bool nano::json_value::valid () const
+{
+	return reader != nullptr;
+}
+
+std::string_view nano::json_value::data () const
+{
+	if (!valid ())
+	{
+		return {};
+	}
+	auto const & token = reader->tokens[index];
+	if (token.type == nano::json_reader::token_type::object || token.type == nano::json_reader::token_type::array)
+	{
+		return {};
+	}
+	return reader->text_of (token);
+}
+
+bool nano::json_value::empty () const
+{
+	return begin () == end ();
+}
+
+bool nano::json_value::is_array () const
+{
+	return valid () && reader->tokens[index].type == nano::json_reader::token_type::array;
+}
+
+std::size_t nano::json_value::size () const
+{
+	return static_cast<std::size_t> (std::distance (begin (), end ()));
+}
+
+std::size_t nano::json_value::count (std::string_view key) const
+{
+	std::size_t result{ 0 };
+	for (auto const & [key_l, value] : *this)
+	{
+		result += key_l == key ? 1 : 0;
+	}
+	return result;
+}
+
+nano::json_value::const_iterator nano::json_value::begin () const
+{
+	if (!valid ())
+	{
+		return {};
+	}
+	auto const & token = reader->tokens[index];
+	return const_iterator{ reader, index + 1, token.type == nano::json_reader::token_type::array };
+}
+
+nano::json_value::const_iterator nano::json_value::end () const
+{
+	if (!valid ())
+	{
+		return {};
+	}
+	auto const & token = reader->tokens[index];
+	return const_iterator{ reader, token.end, token.type == nano::json_reader::token_type::array };
+}
+
+nano::json_value nano::json_value::get_child (std::string_view path) const
+{
+	auto result = find (path);
+	if (!result)
+	{
+		throw boost::property_tree::ptree_bad_path ("No such node", boost::property_tree::ptree::path_type{ std::string{ path } });
+	}
+	return *result;
+}
+
+boost::optional<nano::json_value> nano::json_value::get_child_optional (std::string_view path) const
+{
+	return find (path);
+}
+
+boost::optional<nano::json_value> nano::json_value::find (std::string_view path) const
+{
+	boost::optional<nano::json_value> result{ *this };
+	if (!path.empty ())
+	{
+		std::size_t start{ 0 };
+		while (true)
+		{
+			auto const dot = path.find ('.', start);
+			auto const child = result->find_child (path.substr (start, dot == std::string_view::npos ? dot : dot - start));
+			if (!child.valid ())
+			{
+				result = boost::none;
+				break;
+			}
+			result = child;
+			if (dot == std::string_view::npos)
+			{
+				break;
+			}
+			start = dot + 1;
+		}
+	}
+	return result;
+}
+
+nano::json_value nano::json_value::find_child (std::string_view key) const
+{
+	for (auto const & [key_l, value] : *this)
+	{
+		if (key_l == key)
+		{
+			return value;
+		}
+	}
+	return {};
+}
+
+boost::property_tree::ptree nano::json_value::to_ptree () const
+{
+	boost::property_tree::ptree result;
+	if (valid ())
+	{
+		result.data () = std::string{ data () };
+		for (auto const & [key, value] : *this)
+		{
+			result.push_back (std::make_pair (std::string{ key }, value.to_ptree ()));
+		}
+	}
+	return result;
+}
+
+nano::json_value::const_iterator::const_iterator (nano::json_reader const * reader_a, uint32_t index_a, bool array_a) :
+	reader{ reader_a },
+	index{ index_a },
+	array{ array_a }
+{
+	load ();
+}
+
+void nano::json_value::const_iterator::load ()
+{
+	// Past the end of the container the token is unrelated or out of range, but also never dereferenced
+	if (index < reader->tokens.size ())
+	{
+		if (array)
+		{
+			current = { std::string_view{}, nano::json_value{ *reader, index } };
+		}
+		else if (index + 1 < reader->tokens.size ())
+		{
+			current = { reader->text_of (reader->tokens[index]), nano::json_value{ *reader, index + 1 } };
+		}
+	}
+}
+
+nano::json_value::const_iterator::reference nano::json_value::const_iterator::operator* () const
+{
+	return current;
+}
+
+nano::json_value::const_iterator::pointer nano::json_value::const_iterator::operator->() const
+{
+	return &current;
+}
+
+nano::json_value::const_iterator & nano::json_value::const_iterator::operator++ ()
+{
+	index = reader->tokens[array ? index : index + 1].end;
+	load ();
+	return *this;
+}
+
+nano::json_value::const_iterator nano::json_value::const_iterator::operator++ (int)
+{
+	auto result = *this;
+	++*this;
+	return result;
+}
+
+bool nano::json_value::const_iterator::operator== (const_iterator const & other) const
+{
+	return reader == other.reader && index == other.index;
+}
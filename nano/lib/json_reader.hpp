@@ -0,0 +1,189 @@
+#pragma once
+
+#include <boost/optional.hpp>
+#include <boost/property_tree/exceptions.hpp>
+#include <boost/property_tree/ptree_fwd.hpp>
+#include <boost/property_tree/stream_translator.hpp>
+
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace nano
+{
+class json_reader;
+
+/**
+ * Read only view of a value parsed by json_reader, with the subset of the boost::property_tree::ptree interface used by request handlers.
+ * Values are seen the way read_json stores them: numbers, booleans and null as their text, array elements as children with an empty key.
+ * A view is only valid as long as the reader it came from.
+ */
+class json_value final
+{
+public:
+	using value_type = std::pair<std::string_view, json_value>;
+
+	class const_iterator;
+
+	/** An empty value, the same as a default constructed ptree */
+	json_value () = default;
+
+	/** Text of a string, number, boolean or null, empty for objects and arrays */
+	std::string_view data () const;
+	/** Whether there are no children */
+	bool empty () const;
+	/** Whether this value is a JSON array, which a ptree cannot tell apart from an object */
+	bool is_array () const;
+	std::size_t size () const;
+	/** Number of children named `key`, without path splitting */
+	std::size_t count (std::string_view key) const;
+	const_iterator begin () const;
+	const_iterator end () const;
+
+	/** Paths are split on '.' like ptree paths, the first child of a given name is used */
+	json_value get_child (std::string_view path) const;
+	boost::optional<json_value> get_child_optional (std::string_view path) const;
+
+	template <typename T>
+	T get (std::string_view path) const
+	{
+		auto const child = get_child (path);
+		auto result = child.get_value_optional<T> ();
+		if (!result)
+		{
+			throw boost::property_tree::ptree_bad_data ("conversion of data to type failed", std::string{ path });
+		}
+		return std::move (*result);
+	}
+	template <typename T>
+	T get (std::string_view path, T const & default_value) const
+	{
+		return get_optional<T> (path).value_or (default_value);
+	}
+	template <typename T>
+	boost::optional<T> get_optional (std::string_view path) const
+	{
+		auto const child = find (path);
+		return child ? child->get_value_optional<T> () : boost::none;
+	}
+	/** Converts the text of this value the same way ptree::get_value_optional does */
+	template <typename T>
+	boost::optional<T> get_value_optional () const
+	{
+		auto const text = data ();
+		if constexpr (std::is_same_v<T, std::string>)
+		{
+			return std::string{ text };
+		}
+		else
+		{
+			if constexpr (std::is_same_v<T, bool>)
+			{
+				// The spellings read_json produces, anything else goes through the stream translator
+				if (text == "true" || text == "1")
+				{
+					return true;
+				}
+				if (text == "false" || text == "0")
+				{
+					return false;
+				}
+			}
+			return boost::property_tree::stream_translator<char, std::char_traits<char>, std::allocator<char>, T>{}.get_value (std::string{ text });
+		}
+	}
+
+	/** Copies this value into the tree read_json would have produced */
+	boost::property_tree::ptree to_ptree () const;
+
+private:
+	json_value (nano::json_reader const &, uint32_t index);
+	boost::optional<json_value> find (std::string_view path) const;
+	json_value find_child (std::string_view key) const;
+	bool valid () const;
+
+	nano::json_reader const * reader{ nullptr };
+	uint32_t index{ 0 };
+
+	friend class json_reader;
+};
+
+class json_value::const_iterator final
+{
+public:
+	using iterator_category = std::forward_iterator_tag;
+	using value_type = json_value::value_type;
+	using difference_type = std::ptrdiff_t;
+	using pointer = value_type const *;
+	using reference = value_type const &;
+
+	const_iterator () = default;
+	reference operator* () const;
+	pointer operator->() const;
+	const_iterator & operator++ ();
+	const_iterator operator++ (int);
+	bool operator== (const_iterator const &) const;
+
+private:
+	const_iterator (nano::json_reader const *, uint32_t index, bool array);
+	void load ();
+
+	nano::json_reader const * reader{ nullptr };
+	uint32_t index{ 0 };
+	bool array{ false };
+	value_type current;
+
+	friend class json_value;
+};
+
+/**
+ * Parses JSON text in place, strings are unescaped inside the buffer so no memory is allocated per field.
+ * The result is a flat list of tokens in document order which json_value navigates, accepting and rejecting the same documents as boost::property_tree::read_json.
+ */
+class json_reader final
+{
+public:
+	/**
+	 * Takes ownership of `text` and parses it, replacing any previous document
+	 * @return true on error
+	 */
+	bool parse (std::string text);
+	/** The top level value, empty if nothing was parsed successfully */
+	json_value root () const;
+
+private:
+	enum class token_type : uint8_t
+	{
+		object,
+		array,
+		string,
+		/** Numbers, booleans and null, kept as text */
+		literal
+	};
+	class token final
+	{
+	public:
+		token_type type;
+		uint32_t offset;
+		uint32_t size;
+		/** Index one past the last token of this value, object members are a key token followed by the value */
+		uint32_t end;
+	};
+
+	bool parse_value (std::size_t & position, std::vector<uint32_t> & open);
+	bool parse_string (std::size_t & position);
+	bool parse_literal (std::size_t & position, std::string_view literal);
+	bool parse_number (std::size_t & position);
+	void skip_whitespace (std::size_t & position) const;
+	std::string_view text_of (token const &) const;
+
+	std::string text;
+	std::vector<token> tokens;
+
+	friend class json_value;
+};
+}
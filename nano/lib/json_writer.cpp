@@ -0,0 +1,217 @@
+#include <nano/lib/json_writer.hpp>
+#include <nano/lib/utility.hpp>
+
+#include <boost/property_tree/ptree.hpp>
+
+nano::json_writer::json_writer ()
+{
+	buffer.reserve (4096);
+	frames.push_back ({ false, 0, 0 });
+	buffer += '{';
+}
+
+nano::json_writer::json_writer (boost::property_tree::ptree const & initial) :
+	json_writer ()
+{
+	for (auto const & [key, value] : initial)
+	{
+		put (key, value);
+	}
+}
+
+void nano::json_writer::begin_object (std::string_view key)
+{
+	next_entry ();
+	if (!frames.back ().array)
+	{
+		write_key (key);
+	}
+	open (false);
+}
+
+void nano::json_writer::end_object ()
+{
+	debug_assert (frames.size () > 1 && !frames.back ().array);
+	close ();
+}
+
+void nano::json_writer::begin_array (std::string_view key)
+{
+	next_entry ();
+	if (!frames.back ().array)
+	{
+		write_key (key);
+	}
+	open (true);
+}
+
+void nano::json_writer::end_array ()
+{
+	debug_assert (frames.size () > 1 && frames.back ().array);
+	close ();
+}
+
+void nano::json_writer::put (std::string_view key, std::string_view value)
+{
+	debug_assert (!frames.back ().array);
+	next_entry ();
+	write_key (key);
+	write_string (value);
+}
+
+void nano::json_writer::put (std::string_view key, char const * value)
+{
+	put (key, std::string_view{ value });
+}
+
+void nano::json_writer::put (std::string_view key, bool value)
+{
+	put (key, std::string_view{ value ? "true" : "false" });
+}
+
+void nano::json_writer::put (std::string_view key, boost::property_tree::ptree const & tree)
+{
+	debug_assert (!frames.back ().array);
+	next_entry ();
+	write_key (key);
+	write_tree (tree);
+}
+
+void nano::json_writer::push_back (std::string_view value)
+{
+	debug_assert (frames.back ().array);
+	next_entry ();
+	write_string (value);
+}
+
+void nano::json_writer::push_back (boost::property_tree::ptree const & tree)
+{
+	debug_assert (frames.back ().array);
+	next_entry ();
+	write_tree (tree);
+}
+
+std::size_t nano::json_writer::size () const
+{
+	return frames.back ().count;
+}
+
+bool nano::json_writer::empty () const
+{
+	return frames.front ().count == 0;
+}
+
+std::string nano::json_writer::str ()
+{
+	debug_assert (frames.size () == 1);
+	// The top level object is never collapsed to a string, write_json ends the document with a newline
+	buffer += "\n}\n";
+	frames.clear ();
+	return std::move (buffer);
+}
+
+void nano::json_writer::next_entry ()
+{
+	auto & frame = frames.back ();
+	buffer += frame.count++ == 0 ? "\n" : ",\n";
+	buffer.append (4 * frames.size (), ' ');
+}
+
+void nano::json_writer::write_key (std::string_view key)
+{
+	write_string (key);
+	buffer += ": ";
+}
+
+void nano::json_writer::write_string (std::string_view value)
+{
+	// Same escaping as boost::property_tree::json_parser::create_escapes, bytes above 0x7F are copied unchanged
+	static char const * hex_digits = "0123456789ABCDEF";
+	buffer += '"';
+	for (auto c : value)
+	{
+		auto const u = static_cast<unsigned char> (c);
+		if (u == 0x20 || u == 0x21 || (u >= 0x23 && u <= 0x2E) || (u >= 0x30 && u <= 0x5B) || u >= 0x5D)
+		{
+			buffer += c;
+			continue;
+		}
+		buffer += '\\';
+		switch (c)
+		{
+			case '\b':
+				buffer += 'b';
+				break;
+			case '\f':
+				buffer += 'f';
+				break;
+			case '\n':
+				buffer += 'n';
+				break;
+			case '\r':
+				buffer += 'r';
+				break;
+			case '\t':
+				buffer += 't';
+				break;
+			case '/':
+			case '"':
+			case '\\':
+				buffer += c;
+				break;
+			default:
+				buffer += "u00";
+				buffer += hex_digits[u >> 4];
+				buffer += hex_digits[u & 0xF];
+				break;
+		}
+	}
+	buffer += '"';
+}
+
+void nano::json_writer::write_tree (boost::property_tree::ptree const & tree)
+{
+	if (tree.empty ())
+	{
+		write_string (tree.data ());
+	}
+	else
+	{
+		// A tree whose children all have empty keys is an array
+		auto const array = tree.count ("") == tree.size ();
+		open (array);
+		for (auto const & [key, child] : tree)
+		{
+			next_entry ();
+			if (!array)
+			{
+				write_key (key);
+			}
+			write_tree (child);
+		}
+		close ();
+	}
+}
+
+void nano::json_writer::open (bool array)
+{
+	frames.push_back ({ array, 0, buffer.size () });
+	buffer += array ? '[' : '{';
+}
+
+void nano::json_writer::close ()
+{
+	auto const frame = frames.back ();
+	frames.pop_back ();
+	if (frame.count == 0)
+	{
+		buffer.resize (frame.start);
+		buffer += "\"\"";
+	}
+	else
+	{
+		buffer += '\n';
+		buffer.append (4 * frames.size (), ' ');
+		buffer += frame.array ? ']' : '}';
+	}
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <boost/property_tree/ptree_fwd.hpp>
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace nano
+{
+/**
+ * Writes JSON straight into a string, producing the same bytes as boost::property_tree::write_json on the equivalent tree.
+ * As with a ptree all values are written as strings, and objects or arrays left empty are written as an empty string.
+ * Keys passed to object members are written verbatim, there is no path splitting on '.' like ptree::put.
+ */
+class json_writer final
+{
+public:
+	json_writer ();
+	/** Starts the document with the top level entries of `initial`, for responses partially built as a tree */
+	explicit json_writer (boost::property_tree::ptree const & initial);
+
+	/** Opens an object, `key` names it inside an object and is ignored inside an array */
+	void begin_object (std::string_view key = {});
+	void end_object ();
+	/** Opens an array, `key` names it inside an object and is ignored inside an array */
+	void begin_array (std::string_view key = {});
+	void end_array ();
+
+	void put (std::string_view key, std::string_view value);
+	void put (std::string_view key, char const * value);
+	void put (std::string_view key, bool value);
+	template <typename T>
+		requires (std::is_integral_v<T> && !std::is_same_v<T, bool>)
+	void put (std::string_view key, T value)
+	{
+		put (key, std::string_view{ std::to_string (value) });
+	}
+	/** Writes a subtree the way write_json would */
+	void put (std::string_view key, boost::property_tree::ptree const & tree);
+
+	/** Array elements */
+	void push_back (std::string_view value);
+	void push_back (boost::property_tree::ptree const & tree);
+
+	/** Number of entries written to the innermost open object or array */
+	std::size_t size () const;
+	/** Whether nothing was written to the top level object */
+	bool empty () const;
+	/** Closes the top level object and returns the document, the writer must not be used afterwards */
+	std::string str ();
+
+private:
+	class frame final
+	{
+	public:
+		bool array;
+		std::size_t count;
+		/** Position of the opening bracket, an empty container is rewritten from here */
+		std::size_t start;
+	};
+
+	void next_entry ();
+	void write_key (std::string_view key);
+	void write_string (std::string_view value);
+	void write_tree (boost::property_tree::ptree const & tree);
+	void open (bool array);
+	void close ();
+
+	std::string buffer;
+	std::vector<frame> frames;
+};
+}
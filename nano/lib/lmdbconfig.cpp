@@ -26,6 +26,7 @@ nano::error nano::lmdb_config::serialize_toml (nano::tomlconfig & toml) const
 	toml.put ("sync", sync_string, "Sync strategy for flushing commits to the ledger database. This does not affect the wallet database.\ntype:string,{always, nosync_safe, nosync_unsafe, nosync_unsafe_large_memory}");
 	toml.put ("max_databases", max_databases, "Maximum open lmdb databases. Increase default if more than 100 wallets is required.\nNote: external management is recommended when a large amounts of wallets are required (see https://docs.nano.org/integration-guides/key-management/).\ntype:uin32");
 	toml.put ("map_size", map_size, "Maximum ledger database map size in bytes.\ntype:uint64");
+	toml.put ("read_transaction_pool_size", read_transaction_pool_size, "Number of finished read transactions kept for reuse by the ledger database. Reusing them avoids allocating a transaction and acquiring a reader slot for every read, 0 disables reuse.\ntype:uint64");
 	return toml.get_error ();
 }
 
@@ -34,6 +35,7 @@ nano::error nano::lmdb_config::deserialize_toml (nano::tomlconfig & toml)
 	auto default_max_databases = max_databases;
 	toml.get_optional<uint32_t> ("max_databases", max_databases);
 	toml.get_optional<size_t> ("map_size", map_size);
+	toml.get_optional<std::size_t> ("read_transaction_pool_size", read_transaction_pool_size);
 
 	if (!toml.get_error ())
 	{
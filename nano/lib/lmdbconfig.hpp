@@ -46,5 +46,7 @@ public:
 	sync_strategy sync{ always };
 	uint32_t max_databases{ 128 };
 	size_t map_size{ 256ULL * 1024 * 1024 * 1024 };
+	/** Finished read transactions kept for reuse by the ledger database, each holds on to a reader slot */
+	std::size_t read_transaction_pool_size{ 16 };
 };
 }
@@ -0,0 +1,153 @@
+#pragma once
+
+#include <nano/lib/utility.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <optional>
+
+namespace nano
+{
+/**
+ * Bounded lock-free multi-producer multi-consumer ring buffer
+ * Each slot carries a sequence number which tells producers and consumers whether the slot is ready for them,
+ * so neither side ever takes a lock. Capacity is rounded up to the next power of two.
+ */
+template <typename T>
+class mpmc_queue final
+{
+public:
+	using value_t = T;
+
+	explicit mpmc_queue (std::size_t capacity_a) :
+		capacity_m{ round_up (capacity_a) },
+		mask{ capacity_m - 1 },
+		slots{ std::make_unique<slot[]> (capacity_m) }
+	{
+		debug_assert (capacity_a > 0);
+		for (std::size_t i = 0; i < capacity_m; ++i)
+		{
+			slots[i].sequence.store (i, std::memory_order_relaxed);
+		}
+	}
+
+	mpmc_queue (mpmc_queue const &) = delete;
+	mpmc_queue & operator= (mpmc_queue const &) = delete;
+
+	/**
+	 * Tries to enqueue `value`, the value is only moved from on success
+	 * @return true if the value was enqueued, false if the queue is full
+	 */
+	bool try_push (value_t & value)
+	{
+		auto position = enqueue_position.load (std::memory_order_relaxed);
+		while (true)
+		{
+			auto & cell = slots[position & mask];
+			auto sequence = cell.sequence.load (std::memory_order_acquire);
+			auto diff = static_cast<std::ptrdiff_t> (sequence) - static_cast<std::ptrdiff_t> (position);
+			if (diff == 0)
+			{
+				if (enqueue_position.compare_exchange_weak (position, position + 1, std::memory_order_relaxed))
+				{
+					cell.value = std::move (value);
+					cell.sequence.store (position + 1, std::memory_order_release);
+					return true;
+				}
+			}
+			else if (diff < 0)
+			{
+				return false; // Full
+			}
+			else
+			{
+				position = enqueue_position.load (std::memory_order_relaxed);
+			}
+		}
+	}
+
+	bool try_push (value_t && value)
+	{
+		return try_push (value);
+	}
+
+	/**
+	 * Tries to dequeue the oldest element
+	 * @return empty optional if the queue is empty or the next element is still being published by a producer
+	 */
+	std::optional<value_t> try_pop ()
+	{
+		auto position = dequeue_position.load (std::memory_order_relaxed);
+		while (true)
+		{
+			auto & cell = slots[position & mask];
+			auto sequence = cell.sequence.load (std::memory_order_acquire);
+			auto diff = static_cast<std::ptrdiff_t> (sequence) - static_cast<std::ptrdiff_t> (position + 1);
+			if (diff == 0)
+			{
+				if (dequeue_position.compare_exchange_weak (position, position + 1, std::memory_order_relaxed))
+				{
+					std::optional<value_t> result{ std::move (cell.value) };
+					cell.value = value_t{};
+					cell.sequence.store (position + mask + 1, std::memory_order_release);
+					return result;
+				}
+			}
+			else if (diff < 0)
+			{
+				return std::nullopt; // Empty
+			}
+			else
+			{
+				position = dequeue_position.load (std::memory_order_relaxed);
+			}
+		}
+	}
+
+	/** Approximate number of queued elements, exact only when there are no concurrent operations */
+	std::size_t size () const
+	{
+		auto enqueued = enqueue_position.load (std::memory_order_relaxed);
+		auto dequeued = dequeue_position.load (std::memory_order_relaxed);
+		return enqueued > dequeued ? enqueued - dequeued : 0;
+	}
+
+	bool empty () const
+	{
+		return size () == 0;
+	}
+
+	std::size_t capacity () const
+	{
+		return capacity_m;
+	}
+
+private:
+	static std::size_t round_up (std::size_t value)
+	{
+		std::size_t result = 1;
+		while (result < value)
+		{
+			result <<= 1;
+		}
+		return result;
+	}
+
+	// Keep producer and consumer positions on separate cache lines to avoid false sharing
+	static std::size_t constexpr cache_line_size = 64;
+
+	struct slot
+	{
+		std::atomic<std::size_t> sequence;
+		value_t value;
+	};
+
+	std::size_t const capacity_m;
+	std::size_t const mask;
+	std::unique_ptr<slot[]> slots;
+	alignas (cache_line_size) std::atomic<std::size_t> enqueue_position{ 0 };
+	alignas (cache_line_size) std::atomic<std::size_t> dequeue_position{ 0 };
+};
+}
@@ -30,6 +30,12 @@ bool nano::rate::token_bucket::try_consume (unsigned tokens_required_a)
 	return possible || refill_rate == unlimited_rate_sentinel;
 }
 
+void nano::rate::token_bucket::refund (unsigned tokens_a)
+{
+	nano::lock_guard<nano::mutex> guard{ mutex };
+	current_size = std::min<std::size_t> (current_size + tokens_a, max_token_count);
+}
+
 void nano::rate::token_bucket::refill ()
 {
 	auto now (std::chrono::steady_clock::now ());
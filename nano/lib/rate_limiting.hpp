@@ -38,6 +38,9 @@ namespace rate
 		 */
 		bool try_consume (unsigned tokens_required = 1);
 
+		/** Returns tokens consumed by an operation which did not take place, up to the bucket capacity */
+		void refund (unsigned tokens);
+
 		/** Returns the largest burst observed */
 		std::size_t largest_burst () const;
 
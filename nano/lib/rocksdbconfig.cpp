@@ -7,6 +7,9 @@ nano::error nano::rocksdb_config::serialize_toml (nano::tomlconfig & toml) const
 	toml.put ("enable", enable, "Whether to use the RocksDB backend for the ledger database.\ntype:bool");
 	toml.put ("memory_multiplier", memory_multiplier, "This will modify how much memory is used represented by 1 (low), 2 (medium), 3 (high). Default is 2.\ntype:uint8");
 	toml.put ("io_threads", io_threads, "Number of threads to use with the background compaction and flushing. Number of hardware threads is recommended.\ntype:uint32");
+	toml.put ("bloom_filter_bits", bloom_filter_bits, "Bits per key used by the bloom filters of the ledger tables, 0 disables the filters. Default is 10.\ntype:uint32");
+	toml.put ("pending_prefix_bloom", pending_prefix_bloom, "Whether to index the account prefix of receivable entries in the bloom filters, speeding up lookups of accounts without receivable entries.\ntype:bool");
+	toml.put ("partitioned_index_filters", partitioned_index_filters, "Whether to partition index and filter blocks and cache them in a shared block cache. Reduces memory use on large ledgers.\ntype:bool");
 	return toml.get_error ();
 }
 
@@ -15,6 +18,9 @@ nano::error nano::rocksdb_config::deserialize_toml (nano::tomlconfig & toml)
 	toml.get_optional<bool> ("enable", enable);
 	toml.get_optional<uint8_t> ("memory_multiplier", memory_multiplier);
 	toml.get_optional<unsigned> ("io_threads", io_threads);
+	toml.get_optional<unsigned> ("bloom_filter_bits", bloom_filter_bits);
+	toml.get_optional<bool> ("pending_prefix_bloom", pending_prefix_bloom);
+	toml.get_optional<bool> ("partitioned_index_filters", partitioned_index_filters);
 
 	// Validate ranges
 	if (io_threads == 0)
@@ -25,6 +31,10 @@ nano::error nano::rocksdb_config::deserialize_toml (nano::tomlconfig & toml)
 	{
 		toml.get_error ().set ("memory_multiplier must be either 1, 2 or 3");
 	}
+	if (bloom_filter_bits > 64)
+	{
+		toml.get_error ().set ("bloom_filter_bits must be at most 64");
+	}
 
 	return toml.get_error ();
 }
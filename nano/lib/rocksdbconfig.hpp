@@ -26,5 +26,11 @@ public:
 	bool enable{ false };
 	uint8_t memory_multiplier{ 2 };
 	unsigned io_threads{ nano::hardware_concurrency () };
+	/** Bits per key of the bloom filters in the block based tables, 0 disables them */
+	unsigned bloom_filter_bits{ 10 };
+	/** Bloom filters on the account prefix of pending keys so lookups for accounts without receivables skip table files */
+	bool pending_prefix_bloom{ true };
+	/** Partition index and filter blocks and keep them in a shared cache instead of loading whole per file */
+	bool partitioned_index_filters{ false };
 };
 }
@@ -75,6 +75,8 @@ public:
 	rpc_secure_config secure;
 	uint8_t max_json_depth{ 20 };
 	uint64_t max_request_size{ 32 * 1024 * 1024 };
+	/** Maximum number of actions in a batch request, an array of action objects */
+	uint32_t max_batch_size{ 1024 };
 	nano::rpc_logging_config rpc_logging;
 	/** Optional TLS config */
 	std::shared_ptr<nano::tls_config> tls_config;
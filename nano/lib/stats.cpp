@@ -252,6 +252,15 @@ std::vector<nano::stat_histogram::bin> nano::stat_histogram::get_bins () const
 	return bins;
 }
 
+void nano::stat_histogram::clear ()
+{
+	nano::lock_guard<nano::mutex> lk{ histogram_mutex };
+	for (auto & bin : bins)
+	{
+		bin.value = 0;
+	}
+}
+
 /*
  * stats
  */
@@ -488,7 +497,20 @@ std::string nano::stats::to_string (std::string type)
 void nano::stats::clear ()
 {
 	nano::unique_lock<nano::mutex> lock{ stat_mutex };
-	entries.clear ();
+	// Histogram definitions belong to their owners, which keep updating them, so only their values are reset
+	for (auto it = entries.begin (); it != entries.end ();)
+	{
+		if (it->second->histogram != nullptr)
+		{
+			it->second->counter.set_value (0);
+			it->second->histogram->clear ();
+			++it;
+		}
+		else
+		{
+			it = entries.erase (it);
+		}
+	}
 	timestamp = std::chrono::steady_clock::now ();
 }
 
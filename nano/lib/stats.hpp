@@ -110,6 +110,9 @@ public:
 	};
 	std::vector<bin> get_bins () const;
 
+	/** Resets all bin values, keeping the intervals */
+	void clear ();
+
 private:
 	mutable nano::mutex histogram_mutex;
 	std::vector<bin> bins;
@@ -43,6 +43,12 @@ enum class type : uint8_t
 	election_scheduler,
 	optimistic_scheduler,
 	handshake,
+	tcp_message_manager,
+	store_get,
+	store_put,
+	store_del,
+	store_iterate,
+	rpc_read,
 
 	bootstrap_ascending,
 	bootstrap_ascending_accounts,
@@ -68,6 +74,7 @@ enum class detail : uint8_t
 	queue,
 	overfill,
 	batch,
+	peer_overfill,
 
 	// error specific
 	insufficient_work,
@@ -176,6 +183,7 @@ enum class detail : uint8_t
 	tcp_accept_failure,
 	tcp_write_drop,
 	tcp_write_no_socket_drop,
+	flood_congested,
 	tcp_excluded,
 	tcp_max_per_ip,
 	tcp_max_per_subnetwork,
@@ -218,6 +226,7 @@ enum class detail : uint8_t
 	failed_send_telemetry_req,
 	empty_payload,
 	cleanup_outdated,
+	rtt_probe,
 
 	// vote generator
 	generator_broadcasts,
@@ -252,6 +261,9 @@ enum class detail : uint8_t
 	put,
 	satisfied,
 	trigger,
+	spill,
+	spill_overflow,
+	spill_error,
 
 	// election scheduler
 	insert_manual,
@@ -264,6 +276,12 @@ enum class detail : uint8_t
 	missing_cookie,
 	invalid_genesis,
 
+	// bootstrap server
+	queue_time,
+	build_time,
+	cache_hit,
+	cache_miss,
+
 	// bootstrap ascending
 	missing_tag,
 	reply,
@@ -271,6 +289,10 @@ enum class detail : uint8_t
 	track,
 	timeout,
 	nothing_new,
+	snapshot_save,
+	snapshot_save_failed,
+	snapshot_load,
+	snapshot_load_failed,
 
 	// bootstrap ascending accounts
 	prioritize,
@@ -292,6 +314,37 @@ enum class detail : uint8_t
 	deprioritize,
 	deprioritize_failed,
 
+	// store tables
+	accounts,
+	confirmation_height,
+	delegators,
+	final_votes,
+	frontiers,
+	meta,
+	online_weight,
+	peers,
+	pending,
+	pruned,
+	receivable_amounts,
+
+	// rpc read actions
+	account_balance,
+	account_block_count,
+	account_history,
+	account_info,
+	accounts_balances,
+	accounts_frontiers,
+	accounts_receivable,
+	block_account,
+	block_info,
+	blocks_info,
+	delegators_count,
+	ledger,
+	receivable,
+	receivable_exists,
+	representatives,
+	unopened,
+
 	_last // Must be the last enum
 };
 
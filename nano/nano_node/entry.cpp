@@ -10,6 +10,7 @@
 #include <nano/node/node.hpp>
 #include <nano/node/transport/inproc.hpp>
 #include <nano/store/pending.hpp>
+#include <nano/store/views.hpp>
 
 #include <boost/dll/runtime_symbol_info.hpp>
 #include <boost/format.hpp>
@@ -421,19 +422,21 @@ int main (int argc, char * const * argv)
 			// Cache the account heads to make searching quicker against unchecked keys.
 			auto transaction (node->store.tx_begin_read ());
 			std::unordered_set<nano::block_hash> frontier_hashes;
-			for (auto i (node->store.account.begin (transaction)), n (node->store.account.end ()); i != n; ++i)
+			nano::store::view_iterator<nano::account, nano::account_info> i{ node->store.account.begin (transaction) };
+			for (auto n (node->store.account.end ()); i != n; ++i)
 			{
-				frontier_hashes.insert (i->second.head);
+				frontier_hashes.insert (nano::store::account_info_view{ i.view ().value }.head ());
 			}
 
 			// Check all unchecked keys for matching frontier hashes. Indicates an issue with process_batch algorithm
-			node->unchecked.for_each ([&frontier_hashes] (nano::unchecked_key const & key, nano::unchecked_info const & info) {
+			for (auto const & [key, info] : node->unchecked.list ())
+			{
 				auto it = frontier_hashes.find (key.key ());
 				if (it != frontier_hashes.cend ())
 				{
 					std::cout << it->to_string () << "\n";
 				}
-			});
+			}
 		}
 		else if (vm.count ("debug_account_count"))
 		{
@@ -1918,14 +1921,12 @@ int main (int argc, char * const * argv)
 			[&opened_account_versions_shared, epoch_count] (nano::store::read_transaction const & /*unused*/, nano::store::iterator<nano::account, nano::account_info> i, nano::store::iterator<nano::account, nano::account_info> n) {
 				// First cache locally
 				opened_account_versions_t opened_account_versions_l (epoch_count);
-				for (; i != n; ++i)
+				for (nano::store::view_iterator<nano::account, nano::account_info> j{ std::move (i) }; j != n; ++j)
 				{
-					auto const & account (i->first);
-					auto const & account_info (i->second);
-
+					auto const view (j.view ());
 					// Epoch 0 will be index 0 for instance
-					auto epoch_idx = nano::normalized_epoch (account_info.epoch ());
-					opened_account_versions_l[epoch_idx].emplace (account);
+					auto epoch_idx = nano::normalized_epoch (nano::store::account_info_view{ view.value }.epoch ());
+					opened_account_versions_l[epoch_idx].emplace (view.key_as<nano::account> ());
 				}
 				// Now merge
 				auto opened_account_versions = opened_account_versions_shared.lock ();
@@ -1955,16 +1956,15 @@ int main (int argc, char * const * argv)
 			[&unopened_highest_pending_shared, &opened_accounts] (nano::store::read_transaction const & /*unused*/, nano::store::iterator<nano::pending_key, nano::pending_info> i, nano::store::iterator<nano::pending_key, nano::pending_info> n) {
 				// First cache locally
 				unopened_highest_pending_t unopened_highest_pending_l;
-				for (; i != n; ++i)
+				for (nano::store::view_iterator<nano::pending_key, nano::pending_info> j{ std::move (i) }; j != n; ++j)
 				{
-					nano::pending_key const & key (i->first);
-					nano::pending_info const & info (i->second);
-					auto & account = key.account;
-					auto exists = opened_accounts.find (account) != opened_accounts.end ();
+					auto const view (j.view ());
+					auto const key (view.key_as<nano::pending_key> ());
+					auto exists = opened_accounts.find (key.account) != opened_accounts.end ();
 					if (!exists)
 					{
 						// This is an unopened account, store the lowest pending version
-						auto epoch = nano::normalized_epoch (info.epoch);
+						auto epoch = nano::normalized_epoch (nano::store::pending_info_view{ view.value }.epoch ());
 						auto & existing_or_new = unopened_highest_pending_l[key.account];
 						existing_or_new = std::max (epoch, existing_or_new);
 					}
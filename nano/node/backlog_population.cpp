@@ -91,13 +91,13 @@ void nano::backlog_population::populate_backlog (nano::unique_lock<nano::mutex>
 			auto transaction = store.tx_begin_read ();
 
 			auto count = 0u;
-			auto i = store.account.begin (transaction, next);
+			store::view_iterator<nano::account, nano::account_info> i{ store.account.begin (transaction, next) };
 			auto const end = store.account.end ();
 			for (; i != end && count < chunk_size; ++i, ++count, ++total)
 			{
 				stats.inc (nano::stat::type::backlog, nano::stat::detail::total);
 
-				auto const & account = i->first;
+				auto const account = i.view ().key_as<nano::account> ();
 				activate (transaction, account);
 				next = account.number () + 1;
 			}
@@ -15,6 +15,11 @@ bool nano::bandwidth_limiter::should_pass (std::size_t message_size_a)
 	return bucket.try_consume (nano::narrow_cast<unsigned int> (message_size_a));
 }
 
+void nano::bandwidth_limiter::refund (std::size_t message_size_a)
+{
+	bucket.refund (nano::narrow_cast<unsigned int> (message_size_a));
+}
+
 void nano::bandwidth_limiter::reset (std::size_t limit_a, double burst_ratio_a)
 {
 	bucket.reset (static_cast<std::size_t> (limit_a * burst_ratio_a), limit_a);
@@ -28,6 +28,8 @@ public:
 	bandwidth_limiter (std::size_t limit, double burst_ratio);
 
 	bool should_pass (std::size_t buffer_size);
+	/** Returns the budget taken by a buffer which passed but was not sent */
+	void refund (std::size_t buffer_size);
 	void reset (std::size_t limit, double burst_ratio);
 
 private:
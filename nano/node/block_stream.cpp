@@ -0,0 +1,388 @@
+#include <nano/lib/blocks.hpp>
+#include <nano/lib/stream.hpp>
+#include <nano/lib/thread_pool.hpp>
+#include <nano/node/block_stream.hpp>
+#include <nano/secure/ledger.hpp>
+#include <nano/store/account.hpp>
+#include <nano/store/block.hpp>
+#include <nano/store/component.hpp>
+#include <nano/store/pending.hpp>
+
+#include <algorithm>
+#include <array>
+#include <fstream>
+#include <future>
+#include <unordered_map>
+
+namespace
+{
+/** Flush the output file once this many bytes are buffered */
+std::size_t constexpr write_buffer_size = 1024 * 1024;
+
+class chain_position final
+{
+public:
+	uint64_t height{ 0 };
+	nano::block_hash hash{ 0 };
+};
+
+/** Returns the source block this block receives from, or zero if it is not a receive */
+nano::block_hash receive_source (nano::block const & block)
+{
+	switch (block.type ())
+	{
+		case nano::block_type::receive:
+		case nano::block_type::open:
+			return block.source ();
+		case nano::block_type::state:
+			return block.sideband ().details.is_receive ? block.link ().as_block_hash () : nano::block_hash{ 0 };
+		default:
+			return nano::block_hash{ 0 };
+	}
+}
+
+/**
+ * Returns a send to `account` which is still receivable when its epoch open is applied, the ledger only accepts the open once such a send exists
+ * That is the source of the first receive of the account, or any send still receivable if it never received
+ */
+nano::block_hash epoch_open_source (nano::ledger const & ledger, nano::store::transaction const & transaction, nano::account const & account, nano::block_hash const & open)
+{
+	for (auto hash = ledger.store.block.successor (transaction, open); !hash.is_zero (); hash = ledger.store.block.successor (transaction, hash))
+	{
+		auto block = ledger.store.block.get (transaction, hash);
+		if (block == nullptr)
+		{
+			break;
+		}
+		auto const source = receive_source (*block);
+		if (!source.is_zero ())
+		{
+			return source;
+		}
+	}
+	auto i = ledger.store.pending.begin (transaction, nano::pending_key{ account, 0 });
+	if (i != ledger.store.pending.end () && i->first.account == account)
+	{
+		return i->first.hash;
+	}
+	return 0;
+}
+
+bool write_buffer (std::ofstream & file, std::vector<uint8_t> & buffer)
+{
+	file.write (reinterpret_cast<char const *> (buffer.data ()), buffer.size ());
+	buffer.clear ();
+	return !file;
+}
+
+/**
+ * Reads the next block from the stream
+ * @return nullptr once the terminator is reached or on error, `error` tells the two apart
+ */
+std::shared_ptr<nano::block> read_block (std::ifstream & file, std::vector<uint8_t> & buffer, bool & error)
+{
+	uint8_t type_byte{ 0 };
+	if (!file.read (reinterpret_cast<char *> (&type_byte), sizeof (type_byte)))
+	{
+		error = true; // Truncated file, the stream must end with a terminator
+		return nullptr;
+	}
+	auto const type = static_cast<nano::block_type> (type_byte);
+	if (type == nano::block_type::not_a_block)
+	{
+		return nullptr;
+	}
+	if (type < nano::block_type::send || type > nano::block_type::state)
+	{
+		error = true;
+		return nullptr;
+	}
+	buffer.resize (nano::block::size (type));
+	if (!file.read (reinterpret_cast<char *> (buffer.data ()), buffer.size ()))
+	{
+		error = true;
+		return nullptr;
+	}
+	nano::bufferstream stream{ buffer.data (), buffer.size () };
+	auto block = nano::deserialize_block (stream, type);
+	error = block == nullptr;
+	return block;
+}
+
+/**
+ * Signer of each block as far as it is known before the batch is applied, zero where only the ledger can tell.
+ * Legacy send, receive and change blocks are signed by the account of their previous block, which is looked up in the batch or the store.
+ */
+std::vector<nano::account> resolve_signers (nano::ledger const & ledger, std::vector<std::shared_ptr<nano::block>> const & blocks)
+{
+	std::vector<nano::account> result;
+	result.reserve (blocks.size ());
+	std::unordered_map<nano::block_hash, nano::account> batch_accounts;
+	auto transaction = ledger.store.tx_begin_read ();
+	for (auto const & block : blocks)
+	{
+		nano::account signer{ 0 };
+		switch (block->type ())
+		{
+			case nano::block_type::state:
+			case nano::block_type::open:
+				signer = block->account ();
+				break;
+			default:
+			{
+				auto const previous = block->previous ();
+				if (auto existing = batch_accounts.find (previous); existing != batch_accounts.end ())
+				{
+					signer = existing->second;
+				}
+				else if (auto previous_block = ledger.store.block.get (transaction, previous); previous_block != nullptr)
+				{
+					signer = ledger.account (*previous_block);
+				}
+				break;
+			}
+		}
+		if (!signer.is_zero ())
+		{
+			batch_accounts[block->hash ()] = signer;
+		}
+		result.push_back (signer);
+	}
+	return result;
+}
+
+/**
+ * Checks the work of the block against the entry threshold and its signature against `signer`, recording what passed in `verification` for ledger::process.
+ * A state block with an epoch link may be signed by the account or by the epoch signer, both are tried.
+ * @return false if the block is invalid
+ */
+bool pre_verify (nano::ledger const & ledger, nano::block const & block, nano::account const & signer, nano::block_verification & verification)
+{
+	verification.difficulty = ledger.constants.work.difficulty (block);
+	if (verification.difficulty < ledger.constants.work.threshold_entry (block.work_version (), block.type ()))
+	{
+		return false;
+	}
+	if (signer.is_zero ())
+	{
+		return true;
+	}
+	auto const hash = block.hash ();
+	auto const & signature = block.block_signature ();
+	if (!nano::validate_message (signer, hash, signature))
+	{
+		verification.signer = signer;
+		return true;
+	}
+	if (block.type () == nano::block_type::state && !block.link ().is_zero () && ledger.is_epoch_link (block.link ()) && !nano::validate_message (ledger.epoch_signer (block.link ()), hash, signature))
+	{
+		verification.signer = ledger.epoch_signer (block.link ());
+		return true;
+	}
+	// The signer of a legacy block is only a guess until its previous block is applied, the ledger has the final word on those
+	return block.type () != nano::block_type::state && block.type () != nano::block_type::open;
+}
+
+/** Splits the batch evenly over the thread pool, returning what was verified per block and a flag per block which is set if the block is invalid */
+std::vector<uint8_t> verify_batch (nano::ledger const & ledger, nano::thread_pool & pool, std::vector<std::shared_ptr<nano::block>> const & blocks, std::vector<nano::block_verification> & verifications)
+{
+	auto const signers = resolve_signers (ledger, blocks);
+	std::vector<uint8_t> invalid (blocks.size (), 0);
+	verifications.assign (blocks.size (), nano::block_verification{});
+	auto const threads = std::max<std::size_t> (pool.get_num_threads (), 1);
+	auto const per_task = (blocks.size () + threads - 1) / threads;
+	std::vector<std::future<void>> tasks;
+	for (std::size_t begin = 0; begin < blocks.size (); begin += per_task)
+	{
+		auto const end = std::min (begin + per_task, blocks.size ());
+		auto promise = std::make_shared<std::promise<void>> ();
+		tasks.push_back (promise->get_future ());
+		pool.push_task ([&ledger, &blocks, &signers, &invalid, &verifications, begin, end, promise] () {
+			for (auto i = begin; i < end; ++i)
+			{
+				invalid[i] = !pre_verify (ledger, *blocks[i], signers[i], verifications[i]);
+			}
+			promise->set_value ();
+		});
+	}
+	for (auto & task : tasks)
+	{
+		task.wait ();
+	}
+	return invalid;
+}
+}
+
+bool nano::block_stream::export_ledger (nano::ledger const & ledger, nano::networks network, std::filesystem::path const & path, uint64_t & count)
+{
+	count = 0;
+	std::ofstream file (path, std::ios::binary | std::ios::trunc);
+	if (!file)
+	{
+		return true;
+	}
+	std::vector<uint8_t> buffer;
+	{
+		nano::vectorstream stream{ buffer };
+		nano::write (stream, version);
+		nano::write_big_endian (stream, static_cast<uint16_t> (network));
+	}
+
+	bool error = false;
+	auto transaction = ledger.store.tx_begin_read ();
+	// Every target node already has genesis, start its chain after it
+	std::unordered_map<nano::account, chain_position> exported;
+	auto const & genesis = *ledger.constants.genesis;
+	exported[genesis.account ()] = { 1, genesis.hash () };
+	// Chains which have to be exported up to a height, a receive pushes the chain of its source on top of its own
+	std::vector<std::pair<nano::account, uint64_t>> pending;
+	for (auto i = ledger.store.account.begin (transaction), n = ledger.store.account.end (); i != n && !error; ++i)
+	{
+		pending.emplace_back (i->first, i->second.block_count);
+		while (!pending.empty () && !error)
+		{
+			auto const [account, target] = pending.back ();
+			auto const position = exported[account];
+			if (position.height >= target)
+			{
+				pending.pop_back ();
+				continue;
+			}
+			nano::block_hash next{ 0 };
+			if (position.height == 0)
+			{
+				auto info = ledger.account_info (transaction, account);
+				next = info ? info->open_block : nano::block_hash{ 0 };
+			}
+			else
+			{
+				next = ledger.store.block.successor (transaction, position.hash);
+			}
+			auto block = ledger.store.block.get (transaction, next);
+			if (block == nullptr)
+			{
+				error = true; // Pruned ledgers cannot be exported
+				break;
+			}
+			auto source = receive_source (*block);
+			if (block->type () == nano::block_type::state && block->previous ().is_zero () && block->sideband ().details.is_epoch)
+			{
+				source = epoch_open_source (ledger, transaction, account, next);
+			}
+			if (!source.is_zero ())
+			{
+				auto source_block = ledger.store.block.get (transaction, source);
+				if (source_block != nullptr)
+				{
+					auto const source_account = ledger.account (*source_block);
+					auto existing = exported.find (source_account);
+					if (existing == exported.end () || existing->second.height < source_block->sideband ().height)
+					{
+						pending.emplace_back (source_account, source_block->sideband ().height);
+						continue;
+					}
+				}
+			}
+			{
+				nano::vectorstream stream{ buffer };
+				nano::serialize_block (stream, *block);
+			}
+			exported[account] = { position.height + 1, next };
+			++count;
+			if (buffer.size () >= write_buffer_size)
+			{
+				error = write_buffer (file, buffer);
+			}
+		}
+	}
+	if (!error)
+	{
+		{
+			nano::vectorstream stream{ buffer };
+			nano::serialize_block_type (stream, nano::block_type::not_a_block);
+		}
+		error = write_buffer (file, buffer);
+	}
+	return error;
+}
+
+nano::block_stream::import_result nano::block_stream::import_ledger (nano::ledger & ledger, nano::networks network, std::filesystem::path const & path, unsigned threads, std::size_t batch_size)
+{
+	debug_assert (batch_size > 0);
+	import_result result;
+	std::ifstream file (path, std::ios::binary);
+	std::array<uint8_t, sizeof (version) + sizeof (uint16_t)> header{};
+	if (!file.read (reinterpret_cast<char *> (header.data ()), header.size ()))
+	{
+		result.error = true;
+		return result;
+	}
+	try
+	{
+		nano::bufferstream stream{ header.data (), header.size () };
+		uint8_t version_l{ 0 };
+		uint16_t network_l{ 0 };
+		nano::read (stream, version_l);
+		nano::read_big_endian (stream, network_l);
+		result.error = version_l != version || static_cast<nano::networks> (network_l) != network;
+	}
+	catch (std::runtime_error const &)
+	{
+		result.error = true;
+	}
+	if (result.error)
+	{
+		return result;
+	}
+
+	nano::thread_pool pool (std::max (threads, 1u), nano::thread_role::name::signature_checking);
+	std::vector<uint8_t> buffer;
+	std::vector<std::shared_ptr<nano::block>> batch;
+	batch.reserve (batch_size);
+	std::vector<nano::block_verification> verifications;
+	bool end = false;
+	while (!end && !result.error)
+	{
+		batch.clear ();
+		while (batch.size () < batch_size)
+		{
+			auto block = read_block (file, buffer, result.error);
+			if (block == nullptr)
+			{
+				end = true;
+				break;
+			}
+			batch.push_back (std::move (block));
+		}
+		if (batch.empty ())
+		{
+			continue;
+		}
+		// Verification of the whole batch is spread over all threads, only ledger updates are serialized
+		auto const invalid = verify_batch (ledger, pool, batch, verifications);
+		auto transaction = ledger.store.tx_begin_write ({ tables::accounts, tables::blocks, tables::delegators, tables::frontiers, tables::pending, tables::receivable_amounts });
+		for (std::size_t i = 0; i < batch.size (); ++i)
+		{
+			++result.processed;
+			if (invalid[i])
+			{
+				++result.invalid;
+				continue;
+			}
+			// Signatures and work checked above are not checked again while the write transaction is held
+			switch (ledger.process (transaction, *batch[i], verifications[i]).code)
+			{
+				case nano::process_result::progress:
+					++result.progress;
+					break;
+				case nano::process_result::old:
+					++result.old;
+					break;
+				default:
+					++result.rejected;
+					break;
+			}
+		}
+	}
+	return result;
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <nano/lib/config.hpp>
+#include <nano/secure/common.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+
+namespace nano
+{
+class ledger;
+
+/**
+ * Compact binary block stream used to provision a node from a trusted ledger without going through the network.
+ * Layout: version byte, network id (big endian) and a sequence of blocks in network serialization terminated by `not_a_block`.
+ * Blocks are ordered so that every block follows its previous and source blocks, and every epoch open follows a send to its account, which lets the stream be applied in a single pass.
+ */
+class block_stream final
+{
+public:
+	static uint8_t constexpr version = 1;
+
+	class import_result final
+	{
+	public:
+		uint64_t processed{ 0 };
+		uint64_t progress{ 0 };
+		uint64_t old{ 0 };
+		/** Blocks that failed work or signature pre-verification */
+		uint64_t invalid{ 0 };
+		/** Blocks that passed pre-verification but were rejected by the ledger */
+		uint64_t rejected{ 0 };
+		bool error{ false };
+	};
+
+	/**
+	 * Writes every block in the ledger except genesis to `path` in topological order
+	 * @return true on error
+	 */
+	static bool export_ledger (nano::ledger const &, nano::networks, std::filesystem::path const & path, uint64_t & count);
+
+	/**
+	 * Reads blocks from `path` in batches of `batch_size`, verifies work and signatures of each batch on `threads` threads and applies it through `ledger::process` in a single write transaction.
+	 * The ledger trusts the signatures and work verified on those threads and does not check them again.
+	 * Bypasses the block processor and the unchecked table, blocks out of order are rejected instead of being queued.
+	 */
+	static import_result import_ledger (nano::ledger &, nano::networks, std::filesystem::path const & path, unsigned threads, std::size_t batch_size = 64 * 1024);
+};
+}
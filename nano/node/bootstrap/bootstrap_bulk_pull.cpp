@@ -443,18 +443,30 @@ void nano::bulk_pull_server::send_next ()
 	{
 		return;
 	}
-	auto block = get_next ();
-	if (block != nullptr)
+	std::vector<uint8_t> send_buffer;
+	std::size_t batch_count = 0;
 	{
-		std::vector<uint8_t> send_buffer;
-		{
-			nano::vectorstream stream (send_buffer);
-			nano::serialize_block (stream, *block);
-		}
-		if (node->config.logging.bulk_pull_logging ())
+		auto transaction (node->store.tx_begin_read ());
+		while (batch_count < max_batch_blocks && send_buffer.size () < max_batch_bytes)
 		{
-			node->logger.try_log (boost::str (boost::format ("Sending block: %1%") % block->hash ().to_string ()));
+			auto block = get_next (transaction);
+			if (block == nullptr)
+			{
+				break;
+			}
+			{
+				nano::vectorstream stream (send_buffer);
+				nano::serialize_block (stream, *block);
+			}
+			++batch_count;
+			if (node->config.logging.bulk_pull_logging ())
+			{
+				node->logger.try_log (boost::str (boost::format ("Sending block: %1%") % block->hash ().to_string ()));
+			}
 		}
+	}
+	if (batch_count > 0)
+	{
 		connection->socket->async_write (nano::shared_const_buffer (std::move (send_buffer)), [this_l = shared_from_this ()] (boost::system::error_code const & ec, std::size_t size_a) {
 			this_l->sent_action (ec, size_a);
 		});
@@ -466,6 +478,16 @@ void nano::bulk_pull_server::send_next ()
 }
 
 std::shared_ptr<nano::block> nano::bulk_pull_server::get_next ()
+{
+	auto node = connection->node.lock ();
+	if (!node)
+	{
+		return nullptr;
+	}
+	return get_next (node->store.tx_begin_read ());
+}
+
+std::shared_ptr<nano::block> nano::bulk_pull_server::get_next (store::transaction const & transaction)
 {
 	auto node = connection->node.lock ();
 	if (!node)
@@ -511,7 +533,7 @@ std::shared_ptr<nano::block> nano::bulk_pull_server::get_next ()
 
 	if (send_current)
 	{
-		result = node->block (current);
+		result = node->store.block.get (transaction, current);
 		if (result != nullptr && set_current_to_end == false)
 		{
 			auto next = ascending () ? result->sideband ().successor : result->previous ();
@@ -5,6 +5,11 @@
 
 #include <unordered_set>
 
+namespace nano::store
+{
+class transaction;
+}
+
 namespace nano
 {
 class bootstrap_attempt;
@@ -104,6 +109,11 @@ public:
 	bulk_pull_server (std::shared_ptr<nano::transport::tcp_server> const &, std::unique_ptr<nano::bulk_pull>);
 	void set_current_end ();
 	std::shared_ptr<nano::block> get_next ();
+	std::shared_ptr<nano::block> get_next (store::transaction const &);
+	/**
+	 * Reads up to `max_batch_blocks` successive blocks in a single read transaction and sends them as one write
+	 * Only one batch is in flight at a time, so the socket write queue holds at most one buffer for this connection
+	 */
 	void send_next ();
 	void sent_action (boost::system::error_code const &, std::size_t);
 	void send_finished ();
@@ -115,6 +125,10 @@ public:
 	bool include_start;
 	nano::bulk_pull::count_t max_count;
 	nano::bulk_pull::count_t sent_count;
+
+public:
+	static std::size_t constexpr max_batch_blocks = 256;
+	static std::size_t constexpr max_batch_bytes = 64 * 1024;
 };
 class bulk_pull_account;
 class bulk_pull_account_server final : public std::enable_shared_from_this<nano::bulk_pull_account_server>
@@ -30,11 +30,14 @@ nano::error nano::account_sets_config::serialize (nano::tomlconfig & toml) const
 nano::error nano::bootstrap_ascending_config::deserialize (nano::tomlconfig & toml)
 {
 	toml.get ("requests_limit", requests_limit);
+	toml.get ("requests_window_min", requests_window_min);
+	toml.get ("requester_threads", requester_threads);
 	toml.get ("database_requests_limit", database_requests_limit);
 	toml.get ("pull_count", pull_count);
 	toml.get ("timeout", timeout);
 	toml.get ("throttle_coefficient", throttle_coefficient);
 	toml.get ("throttle_wait", throttle_wait);
+	toml.get ("snapshot_interval", snapshot_interval);
 
 	if (toml.has_key ("account_sets"))
 	{
@@ -48,11 +51,14 @@ nano::error nano::bootstrap_ascending_config::deserialize (nano::tomlconfig & to
 nano::error nano::bootstrap_ascending_config::serialize (nano::tomlconfig & toml) const
 {
 	toml.put ("requests_limit", requests_limit, "Request limit to ascending bootstrap after which requests will be dropped.\nNote: changing to unlimited (0) is not recommended.\ntype:uint64");
+	toml.put ("requests_window_min", requests_window_min, "Minimum number of un-responded requests per channel. The window grows up to requests_limit based on the measured throughput of each peer.\ntype:uint64");
+	toml.put ("requester_threads", requester_threads, "Number of threads sending ascending bootstrap requests.\ntype:uint64");
 	toml.put ("database_requests_limit", database_requests_limit, "Request limit for accounts from database after which requests will be dropped.\nNote: changing to unlimited (0) is not recommended as this operation competes for resources on querying the database.\ntype:uint64");
 	toml.put ("pull_count", pull_count, "Number of requested blocks for ascending bootstrap request.\ntype:uint64");
 	toml.put ("timeout", timeout, "Timeout in milliseconds for incoming ascending bootstrap messages to be processed.\ntype:milliseconds");
 	toml.put ("throttle_coefficient", throttle_coefficient, "Scales the number of samples to track for bootstrap throttling.\ntype:uint64");
 	toml.put ("throttle_wait", throttle_wait, "Length of time to wait between requests when throttled.\ntype:milliseconds");
+	toml.put ("snapshot_interval", snapshot_interval, "Interval between saving account priorities and blocked accounts to disk, they are also saved on shutdown and reloaded on startup. 0 disables persistence.\ntype:milliseconds");
 
 	nano::tomlconfig account_sets_l;
 	account_sets.serialize (account_sets_l);
@@ -28,11 +28,17 @@ public:
 
 	// Maximum number of un-responded requests per channel
 	std::size_t requests_limit{ 64 };
+	// Minimum request window per channel, the window grows from here up to `requests_limit` with the measured throughput of the peer
+	std::size_t requests_window_min{ 4 };
+	// Number of threads picking accounts and sending requests
+	std::size_t requester_threads{ 2 };
 	std::size_t database_requests_limit{ 1024 };
 	std::size_t pull_count{ nano::bootstrap_server::max_blocks };
 	nano::millis_t timeout{ 1000 * 3 };
 	std::size_t throttle_coefficient{ 16 };
 	nano::millis_t throttle_wait{ 100 };
+	// How often account sets are saved to disk, zero disables persistence
+	nano::millis_t snapshot_interval{ 1000 * 60 };
 
 	nano::account_sets_config account_sets;
 };
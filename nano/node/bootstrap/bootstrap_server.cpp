@@ -1,3 +1,4 @@
+#include <nano/lib/tomlconfig.hpp>
 #include <nano/node/bootstrap/bootstrap_server.hpp>
 #include <nano/node/transport/channel.hpp>
 #include <nano/node/transport/transport.hpp>
@@ -6,14 +7,21 @@
 #include <nano/store/component.hpp>
 #include <nano/store/confirmation_height.hpp>
 
-// TODO: Make threads configurable
-nano::bootstrap_server::bootstrap_server (nano::store::component & store_a, nano::ledger & ledger_a, nano::network_constants const & network_constants_a, nano::stats & stats_a) :
+#include <algorithm>
+
+nano::bootstrap_server::bootstrap_server (nano::bootstrap_server_config const & config_a, nano::store::component & store_a, nano::ledger & ledger_a, nano::network_constants const & network_constants_a, nano::stats & stats_a) :
+	config{ config_a },
 	store{ store_a },
 	ledger{ ledger_a },
 	network_constants{ network_constants_a },
 	stats{ stats_a },
-	request_queue{ stats, nano::stat::type::bootstrap_server, nano::thread_role::name::bootstrap_server, /* threads */ 1, /* max size */ 1024 * 16, /* max batch */ 128 }
+	cache{ config.cache_size, config.cache_timeout },
+	request_queue{ stats, nano::stat::type::bootstrap_server, nano::thread_role::name::bootstrap_server, std::max<std::size_t> (config.threads, 1), /* max size */ 1024 * 16, /* max batch */ 128 }
 {
+	// Microseconds, logarithmic bins
+	stats.define_histogram (nano::stat::type::bootstrap_server, nano::stat::detail::queue_time, nano::stat::dir::in, { 0, 10, 100, 1000, 10000, 100000, 1000000 });
+	stats.define_histogram (nano::stat::type::bootstrap_server, nano::stat::detail::build_time, nano::stat::dir::out, { 0, 10, 100, 1000, 10000, 100000, 1000000 });
+
 	request_queue.process_batch = [this] (auto & batch) {
 		process_batch (batch);
 	};
@@ -89,7 +97,7 @@ bool nano::bootstrap_server::request (nano::asc_pull_req const & message, std::s
 		return false;
 	}
 
-	request_queue.add (std::make_pair (message, channel));
+	request_queue.add (std::make_tuple (message, channel, std::chrono::steady_clock::now ()));
 	return true;
 }
 
@@ -109,7 +117,7 @@ void nano::bootstrap_server::respond (nano::asc_pull_ack & response, std::shared
 		void operator() (nano::asc_pull_ack::blocks_payload const & pld)
 		{
 			stats.inc (nano::stat::type::bootstrap_server, nano::stat::detail::response_blocks, nano::stat::dir::out);
-			stats.add (nano::stat::type::bootstrap_server, nano::stat::detail::blocks, nano::stat::dir::out, pld.blocks.size ());
+			stats.add (nano::stat::type::bootstrap_server, nano::stat::detail::blocks, nano::stat::dir::out, pld.size ());
 		}
 		void operator() (nano::asc_pull_ack::account_info_payload const & pld)
 		{
@@ -138,11 +146,15 @@ void nano::bootstrap_server::process_batch (std::deque<request_t> & batch)
 {
 	auto transaction = store.tx_begin_read ();
 
-	for (auto & [request, channel] : batch)
+	for (auto & [request, channel, arrival] : batch)
 	{
+		auto const start = std::chrono::steady_clock::now ();
+		stats.update_histogram (nano::stat::type::bootstrap_server, nano::stat::detail::queue_time, nano::stat::dir::in, std::chrono::duration_cast<std::chrono::microseconds> (start - arrival).count ());
+
 		if (!channel->max (nano::transport::traffic_type::bootstrap))
 		{
 			auto response = process (transaction, request);
+			stats.update_histogram (nano::stat::type::bootstrap_server, nano::stat::detail::build_time, nano::stat::dir::out, std::chrono::duration_cast<std::chrono::microseconds> (std::chrono::steady_clock::now () - start).count ());
 			respond (response, channel);
 		}
 		else
@@ -205,16 +217,25 @@ nano::asc_pull_ack nano::bootstrap_server::prepare_response (store::transaction
 {
 	debug_assert (count <= max_blocks);
 
-	auto blocks = prepare_blocks (transaction, start_block, count);
-	debug_assert (blocks.size () <= count);
+	auto cached = cache.get (start_block, count);
+	stats.inc (nano::stat::type::bootstrap_server, cached ? nano::stat::detail::cache_hit : nano::stat::detail::cache_miss);
+
+	nano::asc_pull_ack::blocks_payload response_payload;
+	if (cached)
+	{
+		response_payload = std::move (*cached);
+	}
+	else
+	{
+		prepare_blocks (transaction, start_block, count, response_payload);
+		cache.put (start_block, count, response_payload);
+	}
+	debug_assert (response_payload.size () <= count);
 
 	nano::asc_pull_ack response{ network_constants };
 	response.id = id;
 	response.type = nano::asc_pull_type::blocks;
-
-	nano::asc_pull_ack::blocks_payload response_payload;
-	response_payload.blocks = blocks;
-	response.payload = response_payload;
+	response.payload = std::move (response_payload);
 
 	response.update_header ();
 	return response;
@@ -233,23 +254,22 @@ nano::asc_pull_ack nano::bootstrap_server::prepare_empty_blocks_response (nano::
 	return response;
 }
 
-std::vector<std::shared_ptr<nano::block>> nano::bootstrap_server::prepare_blocks (store::transaction const & transaction, nano::block_hash start_block, std::size_t count) const
+void nano::bootstrap_server::prepare_blocks (store::transaction const & transaction, nano::block_hash start_block, std::size_t count, nano::asc_pull_ack::blocks_payload & payload) const
 {
 	debug_assert (count <= max_blocks);
 
-	std::vector<std::shared_ptr<nano::block>> result;
-	if (!start_block.is_zero ())
+	payload.serialized_blocks.reserve (count * (sizeof (nano::block_type) + nano::state_block::size));
+	auto current = start_block;
+	while (!current.is_zero () && payload.serialized_count < count)
 	{
-		std::shared_ptr<nano::block> current = store.block.get (transaction, start_block);
-		while (current && result.size () < count)
+		auto successor = store.block.get_serialized (transaction, current, payload.serialized_blocks);
+		if (!successor)
 		{
-			result.push_back (current);
-
-			auto successor = current->sideband ().successor;
-			current = store.block.get (transaction, successor);
+			break;
 		}
+		++payload.serialized_count;
+		current = *successor;
 	}
-	return result;
 }
 
 /*
@@ -301,3 +321,84 @@ nano::asc_pull_ack nano::bootstrap_server::process (const store::transaction & t
 	response.update_header ();
 	return response;
 }
+
+std::unique_ptr<nano::container_info_component> nano::bootstrap_server::collect_container_info (std::string const & name)
+{
+	auto composite = std::make_unique<container_info_composite> (name);
+	composite->add_component (request_queue.collect_container_info ("request_queue"));
+	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "cache", cache.size (), sizeof (nano::asc_pull_ack::blocks_payload) }));
+	return composite;
+}
+
+/*
+ * response_cache
+ */
+
+nano::bootstrap_server::response_cache::response_cache (std::size_t max_size_a, nano::millis_t timeout_a) :
+	max_size{ max_size_a },
+	timeout{ timeout_a }
+{
+}
+
+std::optional<nano::asc_pull_ack::blocks_payload> nano::bootstrap_server::response_cache::get (nano::block_hash const & start, std::size_t count)
+{
+	nano::lock_guard<nano::mutex> lock{ mutex };
+	auto & entries_by_start = entries.get<tag_start> ();
+	auto existing = entries_by_start.find (start);
+	if (existing == entries_by_start.end () || existing->count != count)
+	{
+		return std::nullopt;
+	}
+	if (std::chrono::steady_clock::now () - existing->time > timeout)
+	{
+		entries_by_start.erase (existing);
+		return std::nullopt;
+	}
+	// Move to the back of the eviction order
+	entries.relocate (entries.end (), entries.project<tag_sequenced> (existing));
+	return existing->payload;
+}
+
+void nano::bootstrap_server::response_cache::put (nano::block_hash const & start, std::size_t count, nano::asc_pull_ack::blocks_payload const & payload)
+{
+	if (max_size == 0)
+	{
+		return;
+	}
+	nano::lock_guard<nano::mutex> lock{ mutex };
+	auto & entries_by_start = entries.get<tag_start> ();
+	entries_by_start.erase (start);
+	entries.push_back ({ start, count, std::chrono::steady_clock::now (), payload });
+	while (entries.size () > max_size)
+	{
+		entries.pop_front ();
+	}
+}
+
+std::size_t nano::bootstrap_server::response_cache::size () const
+{
+	nano::lock_guard<nano::mutex> lock{ mutex };
+	return entries.size ();
+}
+
+/*
+ * bootstrap_server_config
+ */
+
+nano::error nano::bootstrap_server_config::serialize (nano::tomlconfig & toml) const
+{
+	toml.put ("threads", threads, "Number of threads processing bootstrap requests from other peers.\ntype:uint64");
+	toml.put ("cache_size", cache_size, "Maximum number of recently served block responses to cache. 0 disables the cache.\ntype:uint64");
+	toml.put ("cache_timeout", cache_timeout, "Age after which a cached block response is rebuilt from the ledger.\ntype:milliseconds");
+
+	return toml.get_error ();
+}
+
+nano::error nano::bootstrap_server_config::deserialize (nano::tomlconfig & toml)
+{
+	toml.get ("threads", threads);
+	toml.get ("cache_size", cache_size);
+	toml.get ("cache_timeout", cache_timeout);
+
+	return toml.get_error ();
+}
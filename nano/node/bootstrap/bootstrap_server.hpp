@@ -1,12 +1,25 @@
 #pragma once
 
+#include <nano/lib/errors.hpp>
+#include <nano/lib/locks.hpp>
 #include <nano/lib/observer_set.hpp>
 #include <nano/lib/processing_queue.hpp>
+#include <nano/lib/timer.hpp>
 #include <nano/node/messages.hpp>
 
+#include <boost/multi_index/hashed_index.hpp>
+#include <boost/multi_index/member.hpp>
+#include <boost/multi_index/sequenced_index.hpp>
+#include <boost/multi_index_container.hpp>
+
+#include <chrono>
 #include <memory>
+#include <optional>
+#include <tuple>
 #include <utility>
 
+namespace mi = boost::multi_index;
+
 namespace nano::store
 {
 class transaction;
@@ -15,26 +28,44 @@ class transaction;
 namespace nano
 {
 class ledger;
+class tomlconfig;
 namespace transport
 {
 	class channel;
 }
 
+class bootstrap_server_config final
+{
+public:
+	nano::error deserialize (nano::tomlconfig &);
+	nano::error serialize (nano::tomlconfig &) const;
+
+public:
+	/** Number of threads doing ledger lookups and preparing responses */
+	std::size_t threads{ 2 };
+	/** Maximum number of recently built blocks responses to keep, 0 disables the cache */
+	std::size_t cache_size{ 1024 };
+	/** Cached responses older than this are rebuilt so newly inserted blocks are served */
+	nano::millis_t cache_timeout{ 1000 * 3 };
+};
+
 /**
  * Processes bootstrap requests (`asc_pull_req` messages) and replies with bootstrap responses (`asc_pull_ack`)
  *
  * In order to ensure maximum throughput, there are two internal processing queues:
  * - One for doing ledger lookups and preparing responses (`request_queue`)
  * - One for sending back those responses over the network (`response_queue`)
+ *
+ * Requests are processed by multiple threads, many syncing peers ask for the same chains so recently built blocks responses are cached
  */
 class bootstrap_server final
 {
 public:
 	// `asc_pull_req` message is small, store by value
-	using request_t = std::pair<nano::asc_pull_req, std::shared_ptr<nano::transport::channel>>; // <request, response channel>
+	using request_t = std::tuple<nano::asc_pull_req, std::shared_ptr<nano::transport::channel>, std::chrono::steady_clock::time_point>; // <request, response channel, arrival time>
 
 public:
-	bootstrap_server (nano::store::component &, nano::ledger &, nano::network_constants const &, nano::stats &);
+	bootstrap_server (nano::bootstrap_server_config const &, nano::store::component &, nano::ledger &, nano::network_constants const &, nano::stats &);
 	~bootstrap_server ();
 
 	void start ();
@@ -46,6 +77,8 @@ public:
 	 */
 	bool request (nano::asc_pull_req const & message, std::shared_ptr<nano::transport::channel> channel);
 
+	std::unique_ptr<nano::container_info_component> collect_container_info (std::string const & name);
+
 public: // Events
 	nano::observer_set<nano::asc_pull_ack &, std::shared_ptr<nano::transport::channel> &> on_response;
 
@@ -62,7 +95,11 @@ private:
 	nano::asc_pull_ack process (store::transaction const &, nano::asc_pull_req::id_t id, nano::asc_pull_req::blocks_payload const & request);
 	nano::asc_pull_ack prepare_response (store::transaction const &, nano::asc_pull_req::id_t id, nano::block_hash start_block, std::size_t count);
 	nano::asc_pull_ack prepare_empty_blocks_response (nano::asc_pull_req::id_t id);
-	std::vector<std::shared_ptr<nano::block>> prepare_blocks (store::transaction const &, nano::block_hash start_block, std::size_t count) const;
+	/**
+	 * Copies up to `count` successive blocks into the payload as they are serialized in the store, following successors from sideband bytes
+	 * Blocks are never deserialized, serving a block is a single copy from the database page into the response
+	 */
+	void prepare_blocks (store::transaction const &, nano::block_hash start_block, std::size_t count, nano::asc_pull_ack::blocks_payload &) const;
 
 	/*
 	 * Account info response
@@ -76,12 +113,54 @@ private:
 	bool verify_request_type (nano::asc_pull_type) const;
 
 private: // Dependencies
+	nano::bootstrap_server_config const & config;
 	nano::store::component & store;
 	nano::ledger & ledger;
 	nano::network_constants const & network_constants;
 	nano::stats & stats;
 
 private:
+	/**
+	 * Bounded LRU of blocks payloads keyed by start block, shared by all processing threads
+	 */
+	class response_cache final
+	{
+	public:
+		response_cache (std::size_t max_size, nano::millis_t timeout);
+
+		/** Returns a copy of the payload if one was built for the same start and count within the timeout */
+		std::optional<nano::asc_pull_ack::blocks_payload> get (nano::block_hash const & start, std::size_t count);
+		void put (nano::block_hash const & start, std::size_t count, nano::asc_pull_ack::blocks_payload const &);
+		std::size_t size () const;
+
+	private:
+		struct entry
+		{
+			nano::block_hash start;
+			std::size_t count;
+			std::chrono::steady_clock::time_point time;
+			nano::asc_pull_ack::blocks_payload payload;
+		};
+
+		// clang-format off
+		class tag_sequenced {};
+		class tag_start {};
+
+		using ordered_entries = boost::multi_index_container<entry,
+		mi::indexed_by<
+			mi::sequenced<mi::tag<tag_sequenced>>,
+			mi::hashed_unique<mi::tag<tag_start>,
+				mi::member<entry, nano::block_hash, &entry::start>>
+		>>;
+		// clang-format on
+
+		ordered_entries entries;
+		std::size_t const max_size;
+		std::chrono::milliseconds const timeout;
+		mutable nano::mutex mutex;
+	};
+
+	response_cache cache;
 	processing_queue<request_t> request_queue;
 
 public: // Config
@@ -5,6 +5,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <tuple>
 #include <vector>
 
 /*
@@ -234,6 +235,112 @@ auto nano::bootstrap_ascending::account_sets::info () const -> nano::bootstrap_a
 	return { blocking, priorities };
 }
 
+void nano::bootstrap_ascending::account_sets::serialize (nano::stream & stream) const
+{
+	nano::write (stream, serialization_version);
+
+	nano::write_big_endian (stream, static_cast<uint64_t> (priorities.size ()));
+	for (auto const & entry : priorities.get<tag_sequenced> ())
+	{
+		nano::write (stream, entry.account);
+		nano::write (stream, entry.priority);
+	}
+
+	nano::write_big_endian (stream, static_cast<uint64_t> (blocking.size ()));
+	for (auto const & entry : blocking.get<tag_sequenced> ())
+	{
+		nano::write (stream, entry.account);
+		nano::write (stream, entry.dependency);
+		// Zero original priority means the account was blocked before being prioritized
+		nano::write (stream, entry.original_entry.account.is_zero () ? 0.0f : entry.original_entry.priority);
+	}
+}
+
+bool nano::bootstrap_ascending::account_sets::deserialize (nano::stream & stream)
+{
+	std::vector<std::pair<nano::account, float>> priorities_l;
+	std::vector<std::tuple<nano::account, nano::block_hash, float>> blocking_l;
+	try
+	{
+		uint8_t version;
+		nano::read (stream, version);
+		if (version != serialization_version)
+		{
+			return true;
+		}
+
+		uint64_t priorities_count;
+		nano::read_big_endian (stream, priorities_count);
+		for (uint64_t i = 0; i < priorities_count; ++i)
+		{
+			nano::account account;
+			float priority;
+			nano::read (stream, account);
+			nano::read (stream, priority);
+			priorities_l.emplace_back (account, priority);
+		}
+
+		uint64_t blocking_count;
+		nano::read_big_endian (stream, blocking_count);
+		for (uint64_t i = 0; i < blocking_count; ++i)
+		{
+			nano::account account;
+			nano::block_hash dependency;
+			float priority;
+			nano::read (stream, account);
+			nano::read (stream, dependency);
+			nano::read (stream, priority);
+			blocking_l.emplace_back (account, dependency, priority);
+		}
+	}
+	catch (std::runtime_error const &)
+	{
+		return true;
+	}
+
+	for (auto const & [account, priority] : priorities_l)
+	{
+		if (priorities.size () >= config.priorities_max)
+		{
+			break;
+		}
+		if (!account.is_zero () && priority > priority_cutoff && !blocked (account))
+		{
+			priorities.get<tag_account> ().insert ({ account, std::min (priority, priority_max) });
+		}
+	}
+	for (auto const & [account, dependency, priority] : blocking_l)
+	{
+		if (blocking.size () >= config.blocking_max)
+		{
+			break;
+		}
+		if (!account.is_zero () && priorities.get<tag_account> ().count (account) == 0)
+		{
+			auto original = priority > 0.0f ? priority_entry{ account, std::min (priority, priority_max) } : priority_entry{ 0, 0 };
+			blocking.get<tag_account> ().insert ({ account, dependency, original });
+		}
+	}
+	return false;
+}
+
+std::size_t nano::bootstrap_ascending::account_sets::unblock_existing (std::function<bool (nano::block_hash const &)> const & exists)
+{
+	std::vector<std::pair<nano::account, nano::block_hash>> resolved;
+	for (auto const & entry : blocking)
+	{
+		if (exists (entry.dependency))
+		{
+			resolved.emplace_back (entry.account, entry.dependency);
+		}
+	}
+	for (auto const & [account, dependency] : resolved)
+	{
+		unblock (account, dependency);
+	}
+	return resolved.size ();
+}
+
 std::unique_ptr<nano::container_info_component> nano::bootstrap_ascending::account_sets::collect_container_info (const std::string & name)
 {
 	auto composite = std::make_unique<container_info_composite> (name);
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <nano/lib/numbers.hpp>
+#include <nano/lib/stream.hpp>
 #include <nano/node/bootstrap/bootstrap_config.hpp>
 #include <nano/node/bootstrap_ascending/common.hpp>
 
@@ -12,6 +13,7 @@
 #include <boost/multi_index/sequenced_index.hpp>
 #include <boost/multi_index_container.hpp>
 
+#include <functional>
 #include <random>
 
 namespace mi = boost::multi_index;
@@ -55,6 +57,23 @@ namespace bootstrap_ascending
 		 */
 		float priority (nano::account const & account) const;
 
+	public: // Persistence
+		/**
+		 * Writes priorities and blocked accounts so bootstrapping can resume where it left off after a restart
+		 * Timestamps are not saved, every account is immediately available after loading
+		 */
+		void serialize (nano::stream &) const;
+		/**
+		 * Merges entries previously written by `serialize`, entries beyond the configured size limits are skipped
+		 * @return true if the stream is malformed, in which case nothing is loaded
+		 */
+		bool deserialize (nano::stream &);
+		/**
+		 * Unblocks the accounts whose dependency `exists` finds, a loaded snapshot can predate the insertion of those dependencies
+		 * @return number of accounts unblocked
+		 */
+		std::size_t unblock_existing (std::function<bool (nano::block_hash const &)> const & exists);
+
 	public: // Container info
 		std::unique_ptr<nano::container_info_component> collect_container_info (std::string const & name);
 
@@ -133,6 +152,7 @@ namespace bootstrap_ascending
 		static float constexpr priority_decrease = 0.5f;
 		static float constexpr priority_max = 32.0f;
 		static float constexpr priority_cutoff = 1.0f;
+		static uint8_t constexpr serialization_version = 1;
 
 	public:
 		using info_t = std::tuple<decltype (blocking), decltype (priorities)>; // <blocking, priorities>
@@ -2,6 +2,9 @@
 #include <nano/node/bootstrap_ascending/peer_scoring.hpp>
 #include <nano/node/transport/channel.hpp>
 
+#include <algorithm>
+#include <cmath>
+
 /*
  * peer_scoring
  */
@@ -18,11 +21,11 @@ bool nano::bootstrap_ascending::peer_scoring::try_send_message (std::shared_ptr<
 	auto existing = index.find (channel.get ());
 	if (existing == index.end ())
 	{
-		index.emplace (channel, 1, 1, 0);
+		index.emplace (channel, 1, 1, 0, config.requests_window_min);
 	}
 	else
 	{
-		if (existing->outstanding < config.requests_limit)
+		if (existing->outstanding < existing->window)
 		{
 			[[maybe_unused]] auto success = index.modify (existing, [] (auto & score) {
 				++score.outstanding;
@@ -38,23 +41,33 @@ bool nano::bootstrap_ascending::peer_scoring::try_send_message (std::shared_ptr<
 	return false;
 }
 
-void nano::bootstrap_ascending::peer_scoring::received_message (std::shared_ptr<nano::transport::channel> channel)
+void nano::bootstrap_ascending::peer_scoring::received_message (std::shared_ptr<nano::transport::channel> channel, std::chrono::milliseconds latency)
 {
 	auto & index = scoring.get<tag_channel> ();
 	auto existing = index.find (channel.get ());
 	if (existing != index.end ())
 	{
-		if (existing->outstanding > 1)
-		{
-			[[maybe_unused]] auto success = index.modify (existing, [] (auto & score) {
+		[[maybe_unused]] auto success = index.modify (existing, [latency] (auto & score) {
+			if (score.outstanding > 1)
+			{
 				--score.outstanding;
 				++score.response_count_total;
-			});
-			debug_assert (success);
-		}
+			}
+			++score.responses_recent;
+			auto const sample = static_cast<double> (latency.count ());
+			score.latency_ms = score.latency_ms == 0.0 ? sample : score.latency_ms * (1.0 - smoothing) + sample * smoothing;
+		});
+		debug_assert (success);
 	}
 }
 
+std::size_t nano::bootstrap_ascending::peer_scoring::window (std::shared_ptr<nano::transport::channel> const & channel) const
+{
+	auto & index = scoring.get<tag_channel> ();
+	auto existing = index.find (channel.get ());
+	return existing != index.end () ? existing->window : 0;
+}
+
 std::shared_ptr<nano::transport::channel> nano::bootstrap_ascending::peer_scoring::channel ()
 {
 	auto & index = scoring.get<tag_outstanding> ();
@@ -94,10 +107,24 @@ void nano::bootstrap_ascending::peer_scoring::timeout ()
 		}
 		score = index.erase (score);
 	}
+	auto const now = std::chrono::steady_clock::now ();
+	auto const elapsed = std::chrono::duration<double> (now - last_timeout).count ();
+	last_timeout = now;
 	for (auto score = scoring.begin (), n = scoring.end (); score != n; ++score)
 	{
-		scoring.modify (score, [] (auto & score_a) {
+		scoring.modify (score, [this, elapsed] (auto & score_a) {
 			score_a.decay ();
+			if (elapsed > 0.0)
+			{
+				auto const rate = score_a.responses_recent / elapsed;
+				score_a.throughput = score_a.throughput * (1.0 - smoothing) + rate * smoothing;
+				score_a.responses_recent = 0;
+			}
+			// Little's law: the number of requests needed in flight to sustain a throughput is throughput * latency
+			// Headroom lets the window grow when the peer can deliver more than it currently does
+			auto const target = std::ceil (score_a.throughput * score_a.latency_ms / 1000.0 * window_headroom);
+			auto const window_min = std::min (config.requests_window_min, config.requests_limit);
+			score_a.window = std::clamp<uint64_t> (static_cast<uint64_t> (target), window_min, config.requests_limit);
 		});
 	}
 }
@@ -113,7 +140,7 @@ void nano::bootstrap_ascending::peer_scoring::sync (std::deque<std::shared_ptr<n
 			{
 				if (!channel->max (nano::transport::traffic_type::bootstrap))
 				{
-					index.emplace (channel, 1, 1, 0);
+					index.emplace (channel, 1, 1, 0, config.requests_window_min);
 				}
 			}
 		}
@@ -125,11 +152,12 @@ void nano::bootstrap_ascending::peer_scoring::sync (std::deque<std::shared_ptr<n
  */
 
 nano::bootstrap_ascending::peer_scoring::peer_score::peer_score (
-std::shared_ptr<nano::transport::channel> const & channel_a, uint64_t outstanding_a, uint64_t request_count_total_a, uint64_t response_count_total_a) :
+std::shared_ptr<nano::transport::channel> const & channel_a, uint64_t outstanding_a, uint64_t request_count_total_a, uint64_t response_count_total_a, uint64_t window_a) :
 	channel{ channel_a },
 	channel_ptr{ channel_a.get () },
 	outstanding{ outstanding_a },
 	request_count_total{ request_count_total_a },
-	response_count_total{ response_count_total_a }
+	response_count_total{ response_count_total_a },
+	window{ window_a }
 {
 }
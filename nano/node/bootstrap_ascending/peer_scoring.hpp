@@ -7,6 +7,7 @@
 #include <boost/multi_index/ordered_index.hpp>
 #include <boost/multi_index_container.hpp>
 
+#include <chrono>
 #include <deque>
 #include <memory>
 
@@ -29,11 +30,14 @@ namespace bootstrap_ascending
 		peer_scoring (nano::bootstrap_ascending_config & config, nano::network_constants const & network_constants);
 		// Returns true if channel limit has been exceeded
 		bool try_send_message (std::shared_ptr<nano::transport::channel> channel);
-		void received_message (std::shared_ptr<nano::transport::channel> channel);
+		void received_message (std::shared_ptr<nano::transport::channel> channel, std::chrono::milliseconds latency = std::chrono::milliseconds{ 0 });
 		std::shared_ptr<nano::transport::channel> channel ();
 		[[nodiscard]] std::size_t size () const;
+		// Number of requests that can be in flight to the channel at the same time, 0 if the channel is not tracked
+		[[nodiscard]] std::size_t window (std::shared_ptr<nano::transport::channel> const & channel) const;
 		// Cleans up scores for closed channels
 		// Decays scores which become inaccurate over time due to message drops
+		// Resizes request windows from the throughput measured since the previous call
 		void timeout ();
 		void sync (std::deque<std::shared_ptr<nano::transport::channel>> const & list);
 
@@ -41,7 +45,7 @@ namespace bootstrap_ascending
 		class peer_score
 		{
 		public:
-			explicit peer_score (std::shared_ptr<nano::transport::channel> const &, uint64_t, uint64_t, uint64_t);
+			explicit peer_score (std::shared_ptr<nano::transport::channel> const &, uint64_t, uint64_t, uint64_t, uint64_t);
 			std::weak_ptr<nano::transport::channel> channel;
 			// std::weak_ptr does not provide ordering so the naked pointer is also tracked and used for ordering channels
 			// This pointer may be invalid if the channel has been destroyed
@@ -64,10 +68,21 @@ namespace bootstrap_ascending
 			uint64_t outstanding{ 0 };
 			uint64_t request_count_total{ 0 };
 			uint64_t response_count_total{ 0 };
+			// Maximum number of outstanding requests, sized by throughput * latency of the peer
+			uint64_t window{ 0 };
+			// Smoothed responses per second and response latency
+			double throughput{ 0.0 };
+			double latency_ms{ 0.0 };
+			// Responses received since throughput was last updated
+			uint64_t responses_recent{ 0 };
 		};
 		nano::network_constants const & network_constants;
 		nano::bootstrap_ascending_config & config;
 
+		// Gain of the moving averages of throughput and latency
+		static double constexpr smoothing = 0.25;
+		static double constexpr window_headroom = 2.0;
+
 		// clang-format off
 		// Indexes scores by their shared channel pointer
 		class tag_channel {};
@@ -82,6 +97,7 @@ namespace bootstrap_ascending
 				mi::member<peer_score, uint64_t, &peer_score::outstanding>>>>;
 		// clang-format on
 		scoring_t scoring;
+		std::chrono::steady_clock::time_point last_timeout{ std::chrono::steady_clock::now () };
 	};
 }
 }
@@ -9,13 +9,16 @@
 #include <nano/store/account.hpp>
 #include <nano/store/component.hpp>
 
+#include <fstream>
+#include <iterator>
+
 using namespace std::chrono_literals;
 
 /*
  * bootstrap_ascending
  */
 
-nano::bootstrap_ascending::service::service (nano::node_config & config_a, nano::block_processor & block_processor_a, nano::ledger & ledger_a, nano::network & network_a, nano::stats & stat_a) :
+nano::bootstrap_ascending::service::service (nano::node_config & config_a, nano::block_processor & block_processor_a, nano::ledger & ledger_a, nano::network & network_a, nano::stats & stat_a, std::filesystem::path const & application_path_a) :
 	config{ config_a },
 	network_consts{ config.network_params.network },
 	block_processor{ block_processor_a },
@@ -26,7 +29,8 @@ nano::bootstrap_ascending::service::service (nano::node_config & config_a, nano:
 	iterator{ ledger.store },
 	throttle{ compute_throttle_size () },
 	scoring{ config.bootstrap_ascending, config.network_params.network },
-	database_limiter{ config.bootstrap_ascending.database_requests_limit, 1.0 }
+	database_limiter{ config.bootstrap_ascending.database_requests_limit, 1.0 },
+	snapshot_path{ application_path_a / "bootstrap_ascending.dat" }
 {
 	// TODO: This is called from a very congested blockprocessor thread. Offload this work to a dedicated processing thread
 	block_processor.batch_processed.add ([this] (auto const & batch) {
@@ -49,19 +53,26 @@ nano::bootstrap_ascending::service::service (nano::node_config & config_a, nano:
 nano::bootstrap_ascending::service::~service ()
 {
 	// All threads must be stopped before destruction
-	debug_assert (!thread.joinable ());
+	debug_assert (threads.empty ());
 	debug_assert (!timeout_thread.joinable ());
 }
 
 void nano::bootstrap_ascending::service::start ()
 {
-	debug_assert (!thread.joinable ());
+	debug_assert (threads.empty ());
 	debug_assert (!timeout_thread.joinable ());
 
-	thread = std::thread ([this] () {
-		nano::thread_role::set (nano::thread_role::name::ascending_bootstrap);
-		run ();
-	});
+	load ();
+
+	// Requesters only block on the blockprocessor, database reads and channel availability, several of them keep the request windows of all peers filled
+	auto const thread_count = std::max<std::size_t> (config.bootstrap_ascending.requester_threads, 1);
+	for (std::size_t i = 0; i < thread_count; ++i)
+	{
+		threads.emplace_back ([this] () {
+			nano::thread_role::set (nano::thread_role::name::ascending_bootstrap);
+			run ();
+		});
+	}
 
 	timeout_thread = std::thread ([this] () {
 		nano::thread_role::set (nano::thread_role::name::ascending_bootstrap);
@@ -75,8 +86,79 @@ void nano::bootstrap_ascending::service::stop ()
 	stopped = true;
 	lock.unlock ();
 	condition.notify_all ();
-	nano::join_or_pass (thread);
+	for (auto & thread : threads)
+	{
+		nano::join_or_pass (thread);
+	}
+	threads.clear ();
 	nano::join_or_pass (timeout_thread);
+	lock.lock ();
+	auto const save_snapshot = loaded;
+	lock.unlock ();
+	if (save_snapshot)
+	{
+		save ();
+	}
+}
+
+void nano::bootstrap_ascending::service::load ()
+{
+	{
+		nano::lock_guard<nano::mutex> lock{ mutex };
+		last_snapshot = std::chrono::steady_clock::now ();
+		loaded = true;
+	}
+	if (config.bootstrap_ascending.snapshot_interval == 0 || !std::filesystem::exists (snapshot_path))
+	{
+		return;
+	}
+
+	std::ifstream file{ snapshot_path, std::ios::binary };
+	std::vector<uint8_t> bytes{ std::istreambuf_iterator<char> (file), std::istreambuf_iterator<char> () };
+
+	nano::bufferstream stream{ bytes.data (), bytes.size () };
+	nano::lock_guard<nano::mutex> lock{ mutex };
+	bool error = accounts.deserialize (stream);
+	stats.inc (nano::stat::type::bootstrap_ascending, error ? nano::stat::detail::snapshot_load_failed : nano::stat::detail::snapshot_load);
+	if (!error)
+	{
+		// The snapshot can be up to snapshot_interval old and is saved while blocks are still being processed, dependencies inserted since then never unblock their account otherwise
+		auto transaction = ledger.store.tx_begin_read ();
+		accounts.unblock_existing ([this, &transaction] (nano::block_hash const & dependency) {
+			return ledger.block_or_pruned_exists (transaction, dependency);
+		});
+	}
+}
+
+void nano::bootstrap_ascending::service::save ()
+{
+	if (config.bootstrap_ascending.snapshot_interval == 0)
+	{
+		return;
+	}
+
+	std::vector<uint8_t> bytes;
+	{
+		nano::vectorstream stream{ bytes };
+		nano::lock_guard<nano::mutex> lock{ mutex };
+		accounts.serialize (stream);
+		last_snapshot = std::chrono::steady_clock::now ();
+	}
+
+	auto temporary = snapshot_path;
+	temporary += ".tmp";
+	{
+		std::ofstream file{ temporary, std::ios::binary | std::ios::trunc };
+		file.write (reinterpret_cast<char const *> (bytes.data ()), bytes.size ());
+		if (!file)
+		{
+			stats.inc (nano::stat::type::bootstrap_ascending, nano::stat::detail::snapshot_save_failed);
+			return;
+		}
+	}
+	std::error_code ec;
+	std::filesystem::rename (temporary, snapshot_path, ec);
+	stats.inc (nano::stat::type::bootstrap_ascending, ec ? nano::stat::detail::snapshot_save_failed : nano::stat::detail::snapshot_save);
 }
 
 void nano::bootstrap_ascending::service::send (std::shared_ptr<nano::transport::channel> channel, async_tag tag)
@@ -337,32 +419,32 @@ void nano::bootstrap_ascending::service::run_timeouts ()
 		scoring.sync (network.list ());
 		scoring.timeout ();
 		throttle.resize (compute_throttle_size ());
-		auto & tags_by_order = tags.get<tag_sequenced> ();
-		while (!tags_by_order.empty () && nano::time_difference (tags_by_order.front ().time, nano::milliseconds_since_epoch ()) > config.bootstrap_ascending.timeout)
+		bool const snapshot_due = config.bootstrap_ascending.snapshot_interval != 0 && std::chrono::steady_clock::now () - last_snapshot >= std::chrono::milliseconds (config.bootstrap_ascending.snapshot_interval);
+		lock.unlock ();
+		for (auto const & tag : tags.erase_expired (config.bootstrap_ascending.timeout))
 		{
-			auto tag = tags_by_order.front ();
-			tags_by_order.pop_front ();
 			on_timeout.notify (tag);
 			stats.inc (nano::stat::type::bootstrap_ascending, nano::stat::detail::timeout);
 		}
+		if (snapshot_due)
+		{
+			save ();
+		}
+		lock.lock ();
 		condition.wait_for (lock, 1s, [this] () { return stopped; });
 	}
 }
 
 void nano::bootstrap_ascending::service::process (nano::asc_pull_ack const & message, std::shared_ptr<nano::transport::channel> channel)
 {
-	nano::unique_lock<nano::mutex> lock{ mutex };
-
 	// Only process messages that have a known tag
-	auto & tags_by_id = tags.get<tag_id> ();
-	if (tags_by_id.count (message.id) > 0)
+	if (auto existing = tags.erase (message.id))
 	{
-		auto iterator = tags_by_id.find (message.id);
-		auto tag = *iterator;
-		tags_by_id.erase (iterator);
-		scoring.received_message (channel);
-
-		lock.unlock ();
+		auto const & tag = *existing;
+		{
+			nano::lock_guard<nano::mutex> lock{ mutex };
+			scoring.received_message (channel, std::chrono::milliseconds (nano::time_difference (tag.time, nano::milliseconds_since_epoch ())));
+		}
 
 		on_reply.notify (tag);
 		condition.notify_all ();
@@ -481,9 +563,7 @@ void nano::bootstrap_ascending::service::track (async_tag const & tag)
 {
 	stats.inc (nano::stat::type::bootstrap_ascending, nano::stat::detail::track);
 
-	nano::lock_guard<nano::mutex> lock{ mutex };
-	debug_assert (tags.get<tag_id> ().count (tag.id) == 0);
-	tags.get<tag_id> ().insert (tag);
+	tags.insert (tag);
 }
 
 auto nano::bootstrap_ascending::service::info () const -> nano::bootstrap_ascending::account_sets::info_t
@@ -505,7 +585,67 @@ std::unique_ptr<nano::container_info_component> nano::bootstrap_ascending::servi
 	nano::lock_guard<nano::mutex> lock{ mutex };
 
 	auto composite = std::make_unique<container_info_composite> (name);
-	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "tags", tags.size (), sizeof (decltype (tags)::value_type) }));
+	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "tags", tags.size (), sizeof (async_tag) }));
 	composite->add_component (accounts.collect_container_info ("accounts"));
 	return composite;
 }
+
+/*
+ * tag_table
+ */
+
+auto nano::bootstrap_ascending::service::tag_table::select (nano::bootstrap_ascending::id_t id) -> shard &
+{
+	// Ids are random, so the low bits spread tags evenly
+	return shards[id % shard_count];
+}
+
+void nano::bootstrap_ascending::service::tag_table::insert (async_tag const & tag)
+{
+	auto & shard = select (tag.id);
+	nano::lock_guard<nano::mutex> lock{ shard.mutex };
+	debug_assert (shard.tags.get<tag_id> ().count (tag.id) == 0);
+	shard.tags.get<tag_id> ().insert (tag);
+}
+
+auto nano::bootstrap_ascending::service::tag_table::erase (nano::bootstrap_ascending::id_t id) -> std::optional<async_tag>
+{
+	auto & shard = select (id);
+	nano::lock_guard<nano::mutex> lock{ shard.mutex };
+	auto & tags_by_id = shard.tags.get<tag_id> ();
+	if (auto existing = tags_by_id.find (id); existing != tags_by_id.end ())
+	{
+		auto result = *existing;
+		tags_by_id.erase (existing);
+		return result;
+	}
+	return std::nullopt;
+}
+
+auto nano::bootstrap_ascending::service::tag_table::erase_expired (nano::millis_t timeout) -> std::deque<async_tag>
+{
+	std::deque<async_tag> result;
+	auto const now = nano::milliseconds_since_epoch ();
+	for (auto & shard : shards)
+	{
+		nano::lock_guard<nano::mutex> lock{ shard.mutex };
+		auto & tags_by_order = shard.tags.get<tag_sequenced> ();
+		while (!tags_by_order.empty () && nano::time_difference (tags_by_order.front ().time, now) > timeout)
+		{
+			result.push_back (tags_by_order.front ());
+			tags_by_order.pop_front ();
+		}
+	}
+	return result;
+}
+
+std::size_t nano::bootstrap_ascending::service::tag_table::size () const
+{
+	std::size_t result = 0;
+	for (auto const & shard : shards)
+	{
+		nano::lock_guard<nano::mutex> lock{ shard.mutex };
+		result += shard.tags.size ();
+	}
+	return result;
+}
@@ -17,7 +17,12 @@
 #include <boost/multi_index/sequenced_index.hpp>
 #include <boost/multi_index_container.hpp>
 
+#include <array>
+#include <deque>
+#include <filesystem>
+#include <optional>
 #include <thread>
+#include <vector>
 
 namespace mi = boost::multi_index;
 
@@ -38,7 +43,7 @@ namespace bootstrap_ascending
 	class service
 	{
 	public:
-		service (nano::node_config &, nano::block_processor &, nano::ledger &, nano::network &, nano::stats &);
+		service (nano::node_config &, nano::block_processor &, nano::ledger &, nano::network &, nano::stats &, std::filesystem::path const & application_path);
 		~service ();
 
 		void start ();
@@ -90,6 +95,11 @@ namespace bootstrap_ascending
 		/* Inspects a block that has been processed by the block processor */
 		void inspect (store::transaction const &, nano::process_return const & result, nano::block const & block);
 
+		/* Restores account sets saved by a previous run */
+		void load ();
+		/* Saves account sets, written to a temporary file first so a crash never leaves a truncated snapshot behind */
+		void save ();
+
 		void throttle_if_needed (nano::unique_lock<nano::mutex> & lock);
 		void run ();
 		bool run_one ();
@@ -150,17 +160,51 @@ namespace bootstrap_ascending
 				mi::member<async_tag, nano::account , &async_tag::account>>
 		>>;
 		// clang-format on
-		ordered_tags tags;
+
+		/**
+		 * Tags of in-flight requests, sharded by request id.
+		 * Requests are tracked and replies matched without taking the service mutex, so requester threads and reply processing do not serialize on it.
+		 */
+		class tag_table
+		{
+		public:
+			void insert (async_tag const &);
+			/** Removes and returns the tag with the given id, if it is tracked */
+			std::optional<async_tag> erase (nano::bootstrap_ascending::id_t);
+			/** Removes and returns tags sent more than `timeout` milliseconds ago */
+			std::deque<async_tag> erase_expired (nano::millis_t timeout);
+			std::size_t size () const;
+
+		private:
+			class shard
+			{
+			public:
+				ordered_tags tags;
+				mutable nano::mutex mutex;
+			};
+
+			shard & select (nano::bootstrap_ascending::id_t);
+
+			static std::size_t constexpr shard_count = 16;
+			std::array<shard, shard_count> shards;
+		};
+
+		tag_table tags;
 
 		nano::bootstrap_ascending::peer_scoring scoring;
 		// Requests for accounts from database have much lower hitrate and could introduce strain on the network
 		// A separate (lower) limiter ensures that we always reserve resources for querying accounts from priority queue
 		nano::bandwidth_limiter database_limiter;
 
+		std::filesystem::path const snapshot_path;
+		std::chrono::steady_clock::time_point last_snapshot;
+		/* Whether the snapshot was loaded by start (), services that never ran must not overwrite it with empty sets */
+		bool loaded{ false };
+
 		bool stopped{ false };
 		mutable nano::mutex mutex;
 		mutable nano::condition_variable condition;
-		std::thread thread;
+		std::vector<std::thread> threads;
 		std::thread timeout_thread;
 	};
 }
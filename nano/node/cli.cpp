@@ -1,12 +1,15 @@
 #include <nano/lib/cli.hpp>
 #include <nano/lib/tlsconfig.hpp>
 #include <nano/lib/tomlconfig.hpp>
+#include <nano/node/block_stream.hpp>
 #include <nano/node/cli.hpp>
 #include <nano/node/common.hpp>
 #include <nano/node/daemonconfig.hpp>
+#include <nano/node/ledger_snapshot.hpp>
 #include <nano/node/node.hpp>
 
 #include <boost/format.hpp>
+#include <boost/lexical_cast.hpp>
 
 namespace
 {
@@ -57,6 +60,10 @@ void nano::add_node_options (boost::program_options::options_description & descr
 	("final_vote_clear", "Clear final votes")
 	("rebuild_database", "Rebuild LMDB database with vacuum for best compaction")
 	("migrate_database_lmdb_to_rocksdb", "Migrates LMDB database to RocksDB")
+	("block_stream_export", "Export all blocks in the ledger to <file> in topological order, for importing with block_stream_import")
+	("block_stream_import", "Import blocks from <file> created by block_stream_export, verifying them on [threads] threads (defaults to hardware concurrency)")
+	("ledger_snapshot_export", "Write a backend independent snapshot of the ledger tables to <file>")
+	("ledger_snapshot_import", "Restore a snapshot from <file> created by ledger_snapshot_export into an empty ledger, using [threads] threads (defaults to hardware concurrency)")
 	("diagnostics", "Run internal diagnostics")
 	("generate_config", boost::program_options::value<std::string> (), "Write configuration to stdout, populated with defaults suitable for this system. Pass the configuration type node, rpc or tls. See also use_defaults.")
 	("key_create", "Generates a adhoc random keypair and prints it to stdout")
@@ -103,8 +110,12 @@ void nano::add_node_flag_options (boost::program_options::options_description &
 		("disable_providing_telemetry_metrics", "Disable using any node information in the telemetry_ack messages.")
 		("disable_block_processor_unchecked_deletion", "Disable deletion of unchecked blocks after processing")
 		("enable_pruning", "Enable experimental ledger pruning")
+		("enable_delegators_index", "Maintain a representative to delegators index in the ledger, built at startup if missing and removed when started without this flag")
+		("enable_receivable_index", "Maintain an index of receivable entries by amount in the ledger, built at startup if missing and removed when started without this flag")
 		("allow_bootstrap_peers_duplicates", "Allow multiple connections to same peer in bootstrap attempts")
 		("fast_bootstrap", "Increase bootstrap speed for high end nodes with higher limits")
+		("memory_store", "Keep the ledger in memory only, it is lost when the node stops. For benchmarking and ephemeral nodes")
+		("store_instrumentation", "Record operation counts, value bytes and latency per database table and calling thread")
 		("block_processor_batch_size", boost::program_options::value<std::size_t>(), "Increase block processor transaction batch write size, default 0 (limited by config block_processor_batch_max_time), 256k for fast_bootstrap")
 		("block_processor_full_size", boost::program_options::value<std::size_t>(), "Increase block processor allowed blocks queue size before dropping live network packets and holding bootstrap download, default 65536, 1 million for fast_bootstrap")
 		("block_processor_verification_size", boost::program_options::value<std::size_t>(), "Increase batch signature verification size in block processor, default 0 (limited by config signature_checker_threads), unlimited for fast_bootstrap")
@@ -135,8 +146,12 @@ std::error_code nano::update_flags (nano::node_flags & flags_a, boost::program_o
 	flags_a.disable_unchecked_drop = (vm.count ("disable_unchecked_drop") > 0);
 	flags_a.disable_block_processor_unchecked_deletion = (vm.count ("disable_block_processor_unchecked_deletion") > 0);
 	flags_a.enable_pruning = (vm.count ("enable_pruning") > 0);
+	flags_a.enable_delegators_index = (vm.count ("enable_delegators_index") > 0);
+	flags_a.enable_receivable_index = (vm.count ("enable_receivable_index") > 0);
 	flags_a.allow_bootstrap_peers_duplicates = (vm.count ("allow_bootstrap_peers_duplicates") > 0);
 	flags_a.fast_bootstrap = (vm.count ("fast_bootstrap") > 0);
+	flags_a.memory_store = (vm.count ("memory_store") > 0);
+	flags_a.store_instrumentation = (vm.count ("store_instrumentation") > 0);
 	if (flags_a.fast_bootstrap)
 	{
 		flags_a.disable_block_processor_unchecked_deletion = true;
@@ -478,6 +493,171 @@ std::error_code nano::handle_node_options (boost::program_options::variables_map
 			std::cerr << "There was an error migrating" << std::endl;
 		}
 	}
+	else if (vm.count ("block_stream_export"))
+	{
+		if (vm.count ("file") == 1)
+		{
+			std::filesystem::path data_path = vm.count ("data_path") ? std::filesystem::path (vm["data_path"].as<std::string> ()) : nano::working_path ();
+			auto node_flags = nano::inactive_node_flag_defaults ();
+			nano::update_flags (node_flags, vm);
+			nano::inactive_node node (data_path, node_flags);
+			if (!node.node->init_error ())
+			{
+				std::cout << "Exporting blocks, might take a while..." << std::endl;
+				uint64_t count{ 0 };
+				if (!nano::block_stream::export_ledger (node.node->ledger, node.node->network_params.network.current_network, vm["file"].as<std::string> (), count))
+				{
+					std::cout << boost::str (boost::format ("Exported %1% blocks") % count) << std::endl;
+				}
+				else
+				{
+					std::cerr << "Error exporting blocks, pruned ledgers cannot be exported" << std::endl;
+					ec = nano::error_cli::generic;
+				}
+			}
+			else
+			{
+				ec = nano::error_cli::generic;
+			}
+		}
+		else
+		{
+			std::cerr << "block_stream_export requires one <file> option\n";
+			ec = nano::error_cli::invalid_arguments;
+		}
+	}
+	else if (vm.count ("block_stream_import"))
+	{
+		if (vm.count ("file") == 1)
+		{
+			unsigned threads = std::max (std::thread::hardware_concurrency (), 1u);
+			auto threads_it = vm.find ("threads");
+			if (threads_it != vm.end ())
+			{
+				try
+				{
+					threads = boost::lexical_cast<unsigned> (threads_it->second.as<std::string> ());
+				}
+				catch (boost::bad_lexical_cast &)
+				{
+					std::cerr << "Invalid threads count\n";
+					ec = nano::error_cli::invalid_arguments;
+				}
+			}
+			if (!ec)
+			{
+				std::filesystem::path data_path = vm.count ("data_path") ? std::filesystem::path (vm["data_path"].as<std::string> ()) : nano::working_path ();
+				auto node_flags = nano::inactive_node_flag_defaults ();
+				node_flags.read_only = false;
+				nano::update_flags (node_flags, vm);
+				nano::inactive_node node (data_path, node_flags);
+				if (!node.node->init_error ())
+				{
+					std::cout << "Importing blocks, might take a while..." << std::endl;
+					auto result = nano::block_stream::import_ledger (node.node->ledger, node.node->network_params.network.current_network, vm["file"].as<std::string> (), threads);
+					std::cout << boost::str (boost::format ("Processed %1% blocks: %2% imported, %3% already present, %4% failed verification, %5% rejected by the ledger") % result.processed % result.progress % result.old % result.invalid % result.rejected) << std::endl;
+					if (result.error)
+					{
+						std::cerr << "Error reading block stream, the file is truncated, corrupt or belongs to a different network" << std::endl;
+						ec = nano::error_cli::generic;
+					}
+				}
+				else
+				{
+					database_write_lock_error (ec);
+				}
+			}
+		}
+		else
+		{
+			std::cerr << "block_stream_import requires one <file> option\n";
+			ec = nano::error_cli::invalid_arguments;
+		}
+	}
+	else if (vm.count ("ledger_snapshot_export"))
+	{
+		if (vm.count ("file") == 1)
+		{
+			std::filesystem::path data_path = vm.count ("data_path") ? std::filesystem::path (vm["data_path"].as<std::string> ()) : nano::working_path ();
+			auto node_flags = nano::inactive_node_flag_defaults ();
+			nano::update_flags (node_flags, vm);
+			nano::inactive_node node (data_path, node_flags);
+			if (!node.node->init_error ())
+			{
+				std::cout << "Writing ledger snapshot, might take a while..." << std::endl;
+				uint64_t records{ 0 };
+				if (!nano::ledger_snapshot::write (node.node->store, node.node->network_params.network.current_network, vm["file"].as<std::string> (), records))
+				{
+					std::cout << boost::str (boost::format ("Snapshot of %1% records written") % records) << std::endl;
+				}
+				else
+				{
+					std::cerr << "Error writing ledger snapshot" << std::endl;
+					ec = nano::error_cli::generic;
+				}
+			}
+			else
+			{
+				ec = nano::error_cli::generic;
+			}
+		}
+		else
+		{
+			std::cerr << "ledger_snapshot_export requires one <file> option\n";
+			ec = nano::error_cli::invalid_arguments;
+		}
+	}
+	else if (vm.count ("ledger_snapshot_import"))
+	{
+		if (vm.count ("file") == 1)
+		{
+			unsigned threads = std::max (std::thread::hardware_concurrency (), 1u);
+			auto threads_it = vm.find ("threads");
+			if (threads_it != vm.end ())
+			{
+				try
+				{
+					threads = boost::lexical_cast<unsigned> (threads_it->second.as<std::string> ());
+				}
+				catch (boost::bad_lexical_cast &)
+				{
+					std::cerr << "Invalid threads count\n";
+					ec = nano::error_cli::invalid_arguments;
+				}
+			}
+			if (!ec)
+			{
+				std::filesystem::path data_path = vm.count ("data_path") ? std::filesystem::path (vm["data_path"].as<std::string> ()) : nano::working_path ();
+				auto node_flags = nano::inactive_node_flag_defaults ();
+				node_flags.read_only = false;
+				nano::update_flags (node_flags, vm);
+				nano::inactive_node node (data_path, node_flags);
+				if (!node.node->init_error ())
+				{
+					std::cout << "Restoring ledger snapshot, might take a while..." << std::endl;
+					uint64_t records{ 0 };
+					if (!nano::ledger_snapshot::read (node.node->store, node.node->network_params.network.current_network, node.node->network_params.ledger, vm["file"].as<std::string> (), threads, records))
+					{
+						std::cout << boost::str (boost::format ("Snapshot of %1% records restored") % records) << std::endl;
+					}
+					else
+					{
+						std::cerr << "Error restoring ledger snapshot. The ledger must only contain genesis and the snapshot must come from the same network and database version" << std::endl;
+						ec = nano::error_cli::generic;
+					}
+				}
+				else
+				{
+					database_write_lock_error (ec);
+				}
+			}
+		}
+		else
+		{
+			std::cerr << "ledger_snapshot_import requires one <file> option\n";
+			ec = nano::error_cli::invalid_arguments;
+		}
+	}
 	else if (vm.count ("unchecked_clear"))
 	{
 		std::filesystem::path data_path = vm.count ("data_path") ? std::filesystem::path (vm["data_path"].as<std::string> ()) : nano::working_path ();
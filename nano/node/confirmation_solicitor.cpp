@@ -2,6 +2,8 @@
 #include <nano/node/election.hpp>
 #include <nano/node/nodeconfig.hpp>
 
+#include <numeric>
+
 using namespace std::chrono_literals;
 
 nano::confirmation_solicitor::confirmation_solicitor (nano::network & network_a, nano::node_config const & config_a) :
@@ -21,6 +23,28 @@ void nano::confirmation_solicitor::prepare (std::vector<nano::representative> co
 	/** Two copies are required as representatives can be erased from \p representatives_requests */
 	representatives_requests = representatives_a;
 	representatives_broadcasts = representatives_a;
+	if (config.peer_selection == nano::peer_selection_mode::latency)
+	{
+		// Requests are capped per election, ask responsive representatives first so that a few slow ones do not hold up confirmation
+		std::vector<std::shared_ptr<nano::transport::channel>> channels;
+		channels.reserve (representatives_requests.size ());
+		std::transform (representatives_requests.begin (), representatives_requests.end (), std::back_inserter (channels), [] (auto const & rep) {
+			return rep.channel;
+		});
+		auto keys = nano::network::latency_weighted_keys (channels);
+		std::vector<std::size_t> order (representatives_requests.size ());
+		std::iota (order.begin (), order.end (), 0);
+		std::sort (order.begin (), order.end (), [&keys] (std::size_t lhs, std::size_t rhs) {
+			return keys[lhs] > keys[rhs];
+		});
+		std::vector<nano::representative> ordered;
+		ordered.reserve (order.size ());
+		for (auto index : order)
+		{
+			ordered.push_back (representatives_requests[index]);
+		}
+		representatives_requests.swap (ordered);
+	}
 	prepared = true;
 }
 
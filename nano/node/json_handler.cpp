@@ -9,12 +9,16 @@
 #include <nano/node/node.hpp>
 #include <nano/node/node_rpc_config.hpp>
 #include <nano/node/telemetry.hpp>
+#include <nano/store/delegator.hpp>
+#include <nano/store/receivable_amount.hpp>
+#include <nano/store/views.hpp>
 
 #include <boost/property_tree/json_parser.hpp>
 #include <boost/property_tree/ptree.hpp>
 
 #include <algorithm>
 #include <chrono>
+#include <unordered_set>
 #include <vector>
 
 namespace
@@ -24,7 +28,10 @@ using ipc_json_handler_no_arg_func_map = std::unordered_map<std::string, std::fu
 ipc_json_handler_no_arg_func_map create_ipc_json_handler_no_arg_func_map ();
 auto ipc_json_handler_no_arg_funcs = create_ipc_json_handler_no_arg_func_map ();
 bool block_confirmed (nano::node & node, nano::store::transaction & transaction, nano::block_hash const & hash, bool include_active, bool include_only_confirmed);
+std::vector<std::pair<nano::pending_key, nano::pending_info>> receivable_by_amount (nano::node & node, nano::store::transaction & transaction, nano::account const & account, nano::uint128_t const & threshold, uint64_t offset, uint64_t count, bool include_active, bool include_only_confirmed);
 char const * epoch_as_string (nano::epoch);
+/** Entries read per read transaction by listings, so a long listing does not keep one transaction open throughout */
+std::size_t constexpr listing_batch_size = 4096;
 }
 
 nano::json_handler::json_handler (nano::node & node_a, nano::node_rpc_config const & node_rpc_config_a, std::string const & body_a, std::function<void (std::string const &)> const & response_a, std::function<void ()> stop_callback_a) :
@@ -58,16 +65,36 @@ void nano::json_handler::process_request (bool unsafe_a)
 {
 	try
 	{
-		std::stringstream istream (body);
-		boost::property_tree::read_json (istream, request);
+		if (request_reader.parse (body))
+		{
+			json_error_response (response, "Unable to parse JSON");
+			return;
+		}
+		request = request_reader.root ();
+		if (request.is_array ())
+		{
+			process_batch (unsafe_a);
+			return;
+		}
 		if (node_rpc_config.request_callback)
 		{
 			debug_assert (node.network_params.network.is_dev_network ());
-			node_rpc_config.request_callback (request);
+			node_rpc_config.request_callback (request.to_ptree ());
 		}
 		action = request.get<std::string> ("action");
 		auto no_arg_func_iter = ipc_json_handler_no_arg_funcs.find (action);
-		if (no_arg_func_iter != ipc_json_handler_no_arg_funcs.cend ())
+		auto read_only = nano::rpc_read_executor::read_only (action);
+		if (no_arg_func_iter != ipc_json_handler_no_arg_funcs.cend () && read_only && nano::thread_role::get () == nano::thread_role::name::io)
+		{
+			// Reads arriving on io threads run on the read executor, leaving the io threads to the network
+			if (node.rpc_read_executor.push (*read_only, create_worker_task ([action_l = no_arg_func_iter->second] (std::shared_ptr<nano::json_handler> const & rpc_l) {
+					action_l (rpc_l.get ());
+				})))
+			{
+				json_error_response (response, "Too many read requests in progress");
+			}
+		}
+		else if (no_arg_func_iter != ipc_json_handler_no_arg_funcs.cend ())
 		{
 			// First try the map of options with no arguments
 			no_arg_func_iter->second (this);
@@ -96,8 +123,8 @@ void nano::json_handler::process_request (bool unsafe_a)
 			}
 			else if (action == "history")
 			{
+				// Same as account_history with "hash" as the head, which account_history reads when the action is "history"
 				response_l.put ("deprecated", "1");
-				request.put ("head", request.get<std::string> ("hash"));
 				account_history ();
 			}
 			else if (action == "knano_from_raw" || action == "krai_from_raw")
@@ -156,6 +183,71 @@ void nano::json_handler::process_request (bool unsafe_a)
 	}
 }
 
+void nano::json_handler::process_batch (bool unsafe_a)
+{
+	// Checked again here as IPC clients reach the node without going through the RPC server
+	if (request.empty () || request.size () > node_rpc_config.max_batch_size)
+	{
+		json_error_response (response, "Invalid batch size");
+		return;
+	}
+	// Responses are kept in request order, the batch is answered once every action has responded
+	class batch_responses final
+	{
+	public:
+		nano::mutex mutex;
+		std::vector<std::string> responses;
+		std::size_t remaining;
+	};
+	auto responses_l (std::make_shared<batch_responses> ());
+	responses_l->responses.resize (request.size ());
+	responses_l->remaining = request.size ();
+	std::vector<std::shared_ptr<nano::json_handler>> handlers;
+	auto read_only (true);
+	for (auto const & [key, element] : request)
+	{
+		auto const index = handlers.size ();
+		read_only = read_only && nano::rpc_read_executor::read_only (element.get<std::string> ("action", "")).has_value ();
+		std::stringstream ostream;
+		boost::property_tree::write_json (ostream, element.to_ptree ());
+		handlers.push_back (std::make_shared<nano::json_handler> (node, node_rpc_config, ostream.str (), [responses_l, index, response = response] (std::string const & response_a) {
+			nano::unique_lock<nano::mutex> lock{ responses_l->mutex };
+			responses_l->responses[index] = response_a;
+			if (--responses_l->remaining == 0)
+			{
+				lock.unlock ();
+				std::string result{ "[" };
+				for (auto const & response_l : responses_l->responses)
+				{
+					result += response_l;
+					result += ',';
+				}
+				result.back () = ']';
+				response (result);
+			}
+		},
+		stop_callback));
+	}
+	auto process = [handlers, unsafe_a] () {
+		for (auto const & handler : handlers)
+		{
+			handler->process_request (unsafe_a);
+		}
+	};
+	if (read_only && nano::thread_role::get () == nano::thread_role::name::io)
+	{
+		// A batch of reads runs on the read executor as a single task, in order, but takes a queue slot per action
+		if (node.rpc_read_executor.push (nano::stat::detail::batch, process, handlers.size ()))
+		{
+			json_error_response (response, "Too many read requests in progress");
+		}
+	}
+	else
+	{
+		process ();
+	}
+}
+
 void nano::json_handler::response_errors ()
 {
 	if (!ec && response_l.empty ())
@@ -179,6 +271,23 @@ void nano::json_handler::response_errors ()
 	}
 }
 
+void nano::json_handler::response_errors (nano::json_writer & writer)
+{
+	if (!ec && writer.empty ())
+	{
+		// Return an error code if no response data was given
+		ec = nano::error_rpc::empty_response;
+	}
+	if (ec)
+	{
+		response_errors ();
+	}
+	else
+	{
+		response (writer.str ());
+	}
+}
+
 std::shared_ptr<nano::wallet> nano::json_handler::wallet_impl ()
 {
 	if (!ec)
@@ -296,32 +405,34 @@ std::shared_ptr<nano::block> nano::json_handler::block_impl (bool signature_work
 	std::shared_ptr<nano::block> result{ nullptr };
 	if (!ec)
 	{
-		boost::property_tree::ptree block_l;
+		nano::json_reader block_reader;
+		nano::json_value block_l;
 		if (json_block_l)
 		{
 			block_l = request.get_child ("block");
 		}
 		else
 		{
-			std::string block_text (request.get<std::string> ("block"));
-			std::stringstream block_stream (block_text);
-			try
-			{
-				boost::property_tree::read_json (block_stream, block_l);
-			}
-			catch (...)
+			// The block is JSON text inside a string
+			if (block_reader.parse (request.get<std::string> ("block")))
 			{
 				ec = nano::error_blocks::invalid_block;
 			}
+			block_l = block_reader.root ();
 		}
 		if (!ec)
 		{
-			if (!signature_work_required)
+			if (signature_work_required)
 			{
-				block_l.put ("signature", "0");
-				block_l.put ("work", "0");
+				result = nano::deserialize_block_json (block_l);
+			}
+			else
+			{
+				auto tree_l (block_l.to_ptree ());
+				tree_l.put ("signature", "0");
+				tree_l.put ("work", "0");
+				result = nano::deserialize_block_json (tree_l);
 			}
-			result = nano::deserialize_block_json (block_l);
 			if (result == nullptr)
 			{
 				ec = nano::error_blocks::invalid_block;
@@ -525,6 +636,31 @@ uint64_t nano::json_handler::offset_optional_impl (uint64_t result)
 	return result;
 }
 
+/** Caps the count of a listing so requests without a count stay bounded too, the rest is reached through the cursor of the response */
+uint64_t nano::json_handler::listing_count_impl (uint64_t count)
+{
+	return std::min<uint64_t> (count, node_rpc_config.max_listing_count);
+}
+
+boost::optional<nano::account> nano::json_handler::cursor_optional_impl ()
+{
+	boost::optional<nano::account> result;
+	boost::optional<std::string> cursor_text (request.get_optional<std::string> ("cursor"));
+	if (!ec && cursor_text.is_initialized ())
+	{
+		nano::account account;
+		if (!account.decode_hex (cursor_text.get ()))
+		{
+			result = account;
+		}
+		else
+		{
+			ec = nano::error_rpc::invalid_cursor;
+		}
+	}
+	return result;
+}
+
 void nano::json_handler::account_balance ()
 {
 	auto account (account_impl ());
@@ -897,36 +1033,56 @@ void nano::json_handler::account_weight ()
 
 void nano::json_handler::accounts_balances ()
 {
-	boost::property_tree::ptree balances;
-	boost::property_tree::ptree errors;
+	nano::json_writer writer{ response_l };
+	// Accounts requested more than once are only listed once, in the position of their first occurrence
+	std::unordered_set<std::string> seen;
+	std::vector<std::pair<std::string, std::string>> errors;
+	bool balances_open{ false };
+	bool const include_only_confirmed = request.get<bool> ("include_only_confirmed", true);
 	auto transaction = node.store.tx_begin_read ();
 	for (auto & account_from_request : request.get_child ("accounts"))
 	{
-		boost::property_tree::ptree entry;
-		auto account = account_impl (account_from_request.second.data ());
+		auto const account_text = account_from_request.second.get<std::string> ("");
+		auto account = account_impl (account_text);
 		if (!ec)
 		{
-			bool const include_only_confirmed = request.get<bool> ("include_only_confirmed", true);
-			auto balance = node.balance_pending (account, include_only_confirmed);
-			entry.put ("balance", balance.first.convert_to<std::string> ());
-			entry.put ("pending", balance.second.convert_to<std::string> ());
-			entry.put ("receivable", balance.second.convert_to<std::string> ());
-			balances.put_child (account_from_request.second.data (), entry);
+			if (seen.insert (account_text).second)
+			{
+				if (!balances_open)
+				{
+					writer.begin_object ("balances");
+					balances_open = true;
+				}
+				auto balance = node.balance_pending (account, include_only_confirmed);
+				writer.begin_object (account_text);
+				writer.put ("balance", balance.first.convert_to<std::string> ());
+				writer.put ("pending", balance.second.convert_to<std::string> ());
+				writer.put ("receivable", balance.second.convert_to<std::string> ());
+				writer.end_object ();
+			}
 			continue;
 		}
 		debug_assert (ec);
-		errors.put (account_from_request.second.data (), ec.message ());
+		if (seen.insert (account_text).second)
+		{
+			errors.emplace_back (account_text, ec.message ());
+		}
 		ec = {};
 	}
-	if (!balances.empty ())
+	if (balances_open)
 	{
-		response_l.add_child ("balances", balances);
+		writer.end_object ();
 	}
 	if (!errors.empty ())
 	{
-		response_l.add_child ("errors", errors);
+		writer.begin_object ("errors");
+		for (auto const & [account_text, message] : errors)
+		{
+			writer.put (account_text, message);
+		}
+		writer.end_object ();
 	}
-	response_errors ();
+	response_errors (writer);
 }
 
 void nano::json_handler::accounts_representatives ()
@@ -936,18 +1092,18 @@ void nano::json_handler::accounts_representatives ()
 	auto transaction = node.store.tx_begin_read ();
 	for (auto & account_from_request : request.get_child ("accounts"))
 	{
-		auto account = account_impl (account_from_request.second.data ());
+		auto account = account_impl (account_from_request.second.get<std::string> (""));
 		if (!ec)
 		{
 			auto info = account_info_impl (transaction, account);
 			if (!ec)
 			{
-				representatives.put (account_from_request.second.data (), info.representative.to_account ());
+				representatives.put (account_from_request.second.get<std::string> (""), info.representative.to_account ());
 				continue;
 			}
 		}
 		debug_assert (ec);
-		errors.put (account_from_request.second.data (), ec.message ());
+		errors.put (account_from_request.second.get<std::string> (""), ec.message ());
 		ec = {};
 	}
 	if (!representatives.empty ())
@@ -993,7 +1149,7 @@ void nano::json_handler::accounts_frontiers ()
 	auto transaction = node.store.tx_begin_read ();
 	for (auto & account_from_request : request.get_child ("accounts"))
 	{
-		auto account = account_impl (account_from_request.second.data ());
+		auto account = account_impl (account_from_request.second.get<std::string> (""));
 		if (!ec)
 		{
 			auto latest = node.ledger.latest (transaction, account);
@@ -1008,7 +1164,7 @@ void nano::json_handler::accounts_frontiers ()
 			}
 		}
 		debug_assert (ec);
-		errors.put (account_from_request.second.data (), ec.message ());
+		errors.put (account_from_request.second.get<std::string> (""), ec.message ());
 		ec = {};
 	}
 	if (!frontiers.empty ())
@@ -1041,42 +1197,64 @@ void nano::json_handler::accounts_receivable ()
 	auto transaction (node.store.tx_begin_read ());
 	for (auto & accounts : request.get_child ("accounts"))
 	{
-		auto account (account_impl (accounts.second.data ()));
+		auto account (account_impl (accounts.second.get<std::string> ("")));
 		if (!ec)
 		{
 			boost::property_tree::ptree peers_l;
-			for (auto i (node.store.pending.begin (transaction, nano::pending_key (account, 0))), n (node.store.pending.end ()); i != n && nano::pending_key (i->first).account == account && peers_l.size () < count; ++i)
+			if (sorting && !simple && node.ledger.receivable_index)
 			{
-				nano::pending_key const & key (i->first);
-				if (block_confirmed (node, transaction, key.hash, include_active, include_only_confirmed))
+				// Read in descending amount order from the index, only the `count` largest receivables are visited
+				for (auto const & [key, info] : receivable_by_amount (node, transaction, account, threshold.number (), 0, count, include_active, include_only_confirmed))
 				{
-					if (simple)
+					if (source)
 					{
-						boost::property_tree::ptree entry;
-						entry.put ("", key.hash.to_string ());
-						peers_l.push_back (std::make_pair ("", entry));
+						boost::property_tree::ptree pending_tree;
+						pending_tree.put ("amount", info.amount.number ().convert_to<std::string> ());
+						pending_tree.put ("source", info.source.to_account ());
+						peers_l.add_child (key.hash.to_string (), pending_tree);
 					}
 					else
 					{
-						nano::pending_info const & info (i->second);
-						if (info.amount.number () >= threshold.number ())
+						peers_l.put (key.hash.to_string (), info.amount.number ().convert_to<std::string> ());
+					}
+				}
+			}
+			else
+			{
+				// Sorted output has to see every entry, the `count` largest are kept after sorting
+				for (auto i (node.store.pending.begin (transaction, nano::pending_key (account, 0))), n (node.store.pending.end ()); i != n && nano::pending_key (i->first).account == account && ((sorting && !simple) || peers_l.size () < count); ++i)
+				{
+					nano::pending_key const & key (i->first);
+					if (block_confirmed (node, transaction, key.hash, include_active, include_only_confirmed))
+					{
+						if (simple)
 						{
-							if (source)
-							{
-								boost::property_tree::ptree pending_tree;
-								pending_tree.put ("amount", info.amount.number ().convert_to<std::string> ());
-								pending_tree.put ("source", info.source.to_account ());
-								peers_l.add_child (key.hash.to_string (), pending_tree);
-							}
-							else
+							boost::property_tree::ptree entry;
+							entry.put ("", key.hash.to_string ());
+							peers_l.push_back (std::make_pair ("", entry));
+						}
+						else
+						{
+							nano::pending_info const & info (i->second);
+							if (info.amount.number () >= threshold.number ())
 							{
-								peers_l.put (key.hash.to_string (), info.amount.number ().convert_to<std::string> ());
+								if (source)
+								{
+									boost::property_tree::ptree pending_tree;
+									pending_tree.put ("amount", info.amount.number ().convert_to<std::string> ());
+									pending_tree.put ("source", info.source.to_account ());
+									peers_l.add_child (key.hash.to_string (), pending_tree);
+								}
+								else
+								{
+									peers_l.put (key.hash.to_string (), info.amount.number ().convert_to<std::string> ());
+								}
 							}
 						}
 					}
 				}
 			}
-			if (sorting && !simple)
+			if (sorting && !simple && !node.ledger.receivable_index)
 			{
 				if (source)
 				{
@@ -1090,6 +1268,10 @@ void nano::json_handler::accounts_receivable ()
 						return child1.second.template get<nano::uint128_t> ("") > child2.second.template get<nano::uint128_t> ("");
 					});
 				}
+				if (peers_l.size () > count)
+				{
+					peers_l.erase (std::next (peers_l.begin (), count), peers_l.end ());
+				}
 			}
 			if (!peers_l.empty ())
 			{
@@ -1245,11 +1427,11 @@ void nano::json_handler::blocks ()
 	bool const json_block_l = request.get<bool> ("json_block", false);
 	boost::property_tree::ptree blocks;
 	auto transaction (node.store.tx_begin_read ());
-	for (boost::property_tree::ptree::value_type & hashes : request.get_child ("hashes"))
+	for (auto const & hashes : request.get_child ("hashes"))
 	{
 		if (!ec)
 		{
-			std::string hash_text = hashes.second.data ();
+			std::string hash_text = hashes.second.get<std::string> ("");
 			nano::block_hash hash;
 			if (!hash.decode_hex (hash_text))
 			{
@@ -1296,11 +1478,11 @@ void nano::json_handler::blocks_info ()
 	boost::property_tree::ptree blocks;
 	boost::property_tree::ptree blocks_not_found;
 	auto transaction (node.store.tx_begin_read ());
-	for (boost::property_tree::ptree::value_type & hashes : request.get_child ("hashes"))
+	for (auto const & hashes : request.get_child ("hashes"))
 	{
 		if (!ec)
 		{
-			std::string hash_text = hashes.second.data ();
+			std::string hash_text = hashes.second.get<std::string> ("");
 			nano::block_hash hash;
 			if (!hash.decode_hex (hash_text))
 			{
@@ -2020,8 +2202,6 @@ void nano::json_handler::confirmation_height_currently_processing ()
 
 void nano::json_handler::confirmation_history ()
 {
-	boost::property_tree::ptree elections;
-	boost::property_tree::ptree confirmation_stats;
 	std::chrono::milliseconds running_total (0);
 	nano::block_hash hash (0);
 	boost::optional<std::string> hash_text (request.get_optional<std::string> ("hash"));
@@ -2029,34 +2209,47 @@ void nano::json_handler::confirmation_history ()
 	{
 		hash = hash_impl ();
 	}
+	nano::json_writer writer;
 	if (!ec)
 	{
-		for (auto const & status : node.active.recently_cemented.list ())
+		// The stats precede the confirmations in the response, so they are totalled in a first pass
+		auto const statuses = node.active.recently_cemented.list ();
+		std::size_t count (0);
+		for (auto const & status : statuses)
 		{
 			if (hash.is_zero () || status.winner->hash () == hash)
 			{
-				boost::property_tree::ptree election;
-				election.put ("hash", status.winner->hash ().to_string ());
-				election.put ("duration", status.election_duration.count ());
-				election.put ("time", status.election_end.count ());
-				election.put ("tally", status.tally.to_string_dec ());
-				election.add ("final", status.final_tally.to_string_dec ());
-				election.put ("blocks", std::to_string (status.block_count));
-				election.put ("voters", std::to_string (status.voter_count));
-				election.put ("request_count", std::to_string (status.confirmation_request_count));
-				elections.push_back (std::make_pair ("", election));
+				++count;
 			}
 			running_total += status.election_duration;
 		}
+		writer.begin_object ("confirmation_stats");
+		writer.put ("count", count);
+		if (count >= 1)
+		{
+			writer.put ("average", static_cast<std::size_t> (running_total.count ()) / count);
+		}
+		writer.end_object ();
+		writer.begin_array ("confirmations");
+		for (auto const & status : statuses)
+		{
+			if (hash.is_zero () || status.winner->hash () == hash)
+			{
+				writer.begin_object ();
+				writer.put ("hash", status.winner->hash ().to_string ());
+				writer.put ("duration", status.election_duration.count ());
+				writer.put ("time", status.election_end.count ());
+				writer.put ("tally", status.tally.to_string_dec ());
+				writer.put ("final", status.final_tally.to_string_dec ());
+				writer.put ("blocks", std::to_string (status.block_count));
+				writer.put ("voters", std::to_string (status.voter_count));
+				writer.put ("request_count", std::to_string (status.confirmation_request_count));
+				writer.end_object ();
+			}
+		}
+		writer.end_array ();
 	}
-	confirmation_stats.put ("count", elections.size ());
-	if (elections.size () >= 1)
-	{
-		confirmation_stats.put ("average", (running_total.count ()) / elections.size ());
-	}
-	response_l.add_child ("confirmation_stats", confirmation_stats);
-	response_l.add_child ("confirmations", elections);
-	response_errors ();
+	response_errors (writer);
 }
 
 void nano::json_handler::confirmation_info ()
@@ -2205,9 +2398,10 @@ void nano::json_handler::database_txn_tracker ()
 void nano::json_handler::delegators ()
 {
 	auto representative (account_impl ());
-	auto count (count_optional_impl (1024));
+	auto count (listing_count_impl (count_optional_impl (1024)));
 	auto threshold (threshold_optional_impl ());
 	auto start_account_text (request.get_optional<std::string> ("start"));
+	auto cursor (cursor_optional_impl ());
 
 	nano::account start_account{};
 	if (!ec && start_account_text.is_initialized ())
@@ -2215,27 +2409,66 @@ void nano::json_handler::delegators ()
 		start_account = account_impl (start_account_text.get ());
 	}
 
+	nano::json_writer writer;
 	if (!ec)
 	{
-		auto transaction (node.store.tx_begin_read ());
-		boost::property_tree::ptree delegators;
-		for (auto i (node.store.account.begin (transaction, start_account.number () + 1)), n (node.store.account.end ()); i != n && delegators.size () < count; ++i)
+		// "start" is the last account of the previous page while a cursor is the next account to read
+		boost::optional<nano::account> next{ cursor ? *cursor : nano::account{ start_account.number () + 1 } };
+		writer.begin_object ("delegators");
+		if (node.ledger.delegators_index)
 		{
-			nano::account_info const & info (i->second);
-			if (info.representative == representative)
+			// The delegators of a representative are adjacent in the index and ordered by account like the accounts table
+			while (next && writer.size () < count)
 			{
-				if (info.balance.number () >= threshold.number ())
+				auto transaction (node.store.tx_begin_read ());
+				auto i (node.store.delegator.begin (transaction, nano::delegator_key{ representative, *next }));
+				auto const end (node.store.delegator.end ());
+				for (std::size_t read (0); i != end && i->first.representative == representative && writer.size () < count && read < listing_batch_size; ++i, ++read)
 				{
-					std::string balance;
-					nano::uint128_union (info.balance).encode_dec (balance);
-					nano::account const & delegator (i->first);
-					delegators.put (delegator.to_account (), balance);
+					auto const info = node.ledger.account_info (transaction, i->first.account);
+					debug_assert (info);
+					if (info->balance.number () >= threshold.number ())
+					{
+						std::string balance;
+						info->balance.encode_dec (balance);
+						writer.put (i->first.account.to_account (), balance);
+					}
 				}
+				next = i != end && i->first.representative == representative ? boost::optional<nano::account>{ i->first.account } : boost::none;
 			}
 		}
-		response_l.add_child ("delegators", delegators);
+		else
+		{
+			while (next && writer.size () < count)
+			{
+				auto transaction (node.store.tx_begin_read ());
+				nano::store::view_iterator<nano::account, nano::account_info> i{ node.store.account.begin (transaction, *next) };
+				auto const end (node.store.account.end ());
+				for (std::size_t read (0); i != end && writer.size () < count && read < listing_batch_size; ++i, ++read)
+				{
+					nano::store::account_info_view const info{ i.view ().value };
+					if (info.representative () == representative)
+					{
+						auto const balance_l (info.balance ());
+						if (balance_l.number () >= threshold.number ())
+						{
+							std::string balance;
+							balance_l.encode_dec (balance);
+							auto const delegator (i.view ().key_as<nano::account> ());
+							writer.put (delegator.to_account (), balance);
+						}
+					}
+				}
+				next = i != end ? boost::optional<nano::account>{ i.view ().key_as<nano::account> () } : boost::none;
+			}
+		}
+		writer.end_object ();
+		if (next)
+		{
+			writer.put ("cursor", next->to_string ());
+		}
 	}
-	response_errors ();
+	response_errors (writer);
 }
 
 void nano::json_handler::delegators_count ()
@@ -2245,14 +2478,24 @@ void nano::json_handler::delegators_count ()
 	{
 		uint64_t count (0);
 		auto transaction (node.store.tx_begin_read ());
-		for (auto i (node.store.account.begin (transaction)), n (node.store.account.end ()); i != n; ++i)
+		if (node.ledger.delegators_index)
 		{
-			nano::account_info const & info (i->second);
-			if (info.representative == account)
+			for (auto i (node.store.delegator.begin (transaction, nano::delegator_key{ account, 0 })), n (node.store.delegator.end ()); i != n && i->first.representative == account; ++i)
 			{
 				++count;
 			}
 		}
+		else
+		{
+			nano::store::view_iterator<nano::account, nano::account_info> i{ node.store.account.begin (transaction) };
+			for (auto n (node.store.account.end ()); i != n; ++i)
+			{
+				if (nano::store::account_info_view{ i.view ().value }.representative () == account)
+				{
+					++count;
+				}
+			}
+		}
 		response_l.put ("count", std::to_string (count));
 	}
 	response_errors ();
@@ -2350,19 +2593,32 @@ void nano::json_handler::epoch_upgrade ()
 
 void nano::json_handler::frontiers ()
 {
-	auto start (account_impl ());
-	auto count (count_impl ());
+	auto cursor (cursor_optional_impl ());
+	auto start (cursor ? *cursor : account_impl ());
+	auto count (listing_count_impl (count_impl ()));
+	nano::json_writer writer;
 	if (!ec)
 	{
-		boost::property_tree::ptree frontiers;
-		auto transaction (node.store.tx_begin_read ());
-		for (auto i (node.store.account.begin (transaction, start)), n (node.store.account.end ()); i != n && frontiers.size () < count; ++i)
+		writer.begin_object ("frontiers");
+		boost::optional<nano::account> next{ start };
+		while (next && writer.size () < count)
 		{
-			frontiers.put (i->first.to_account (), i->second.head.to_string ());
+			auto transaction (node.store.tx_begin_read ());
+			nano::store::view_iterator<nano::account, nano::account_info> i{ node.store.account.begin (transaction, *next) };
+			auto const end (node.store.account.end ());
+			for (std::size_t read (0); i != end && writer.size () < count && read < listing_batch_size; ++i, ++read)
+			{
+				writer.put (i.view ().key_as<nano::account> ().to_account (), nano::store::account_info_view{ i.view ().value }.head ().to_string ());
+			}
+			next = i != end ? boost::optional<nano::account>{ i.view ().key_as<nano::account> () } : boost::none;
+		}
+		writer.end_object ();
+		if (next)
+		{
+			writer.put ("cursor", next->to_string ());
 		}
-		response_l.add_child ("frontiers", frontiers);
 	}
-	response_errors ();
+	response_errors (writer);
 }
 
 void nano::json_handler::account_count ()
@@ -2598,7 +2854,7 @@ void nano::json_handler::account_history ()
 	nano::account account;
 	nano::block_hash hash;
 	bool reverse (request.get_optional<bool> ("reverse") == true);
-	auto head_str (request.get_optional<std::string> ("head"));
+	auto head_str (request.get_optional<std::string> (action == "history" ? "hash" : "head"));
 	auto transaction (node.store.tx_begin_read ());
 	auto count (count_impl ());
 	auto offset (offset_optional_impl (0));
@@ -2639,13 +2895,15 @@ void nano::json_handler::account_history ()
 			}
 		}
 	}
+	// Entries written by the calling action, such as the deprecation notice of "history", come first
+	nano::json_writer writer{ response_l };
 	if (!ec)
 	{
-		boost::property_tree::ptree history;
 		bool output_raw (request.get_optional<bool> ("raw") == true);
-		response_l.put ("account", account.to_account ());
+		writer.put ("account", account.to_account ());
+		writer.begin_array ("history");
 		auto block (node.store.block.get (transaction, hash));
-		while (block != nullptr && count > 0)
+		for (std::size_t read (1); block != nullptr && count > 0; ++read)
 		{
 			if (offset > 0)
 			{
@@ -2667,20 +2925,25 @@ void nano::json_handler::account_history ()
 						entry.put ("work", nano::to_string_hex (block->block_work ()));
 						entry.put ("signature", block->block_signature ().to_string ());
 					}
-					history.push_back (std::make_pair ("", entry));
+					writer.push_back (entry);
 					--count;
 				}
 			}
 			hash = reverse ? node.store.block.successor (transaction, hash) : block->previous ();
+			if (read % listing_batch_size == 0)
+			{
+				// Only point reads are made, there are no iterators to reposition
+				transaction.refresh ();
+			}
 			block = node.store.block.get (transaction, hash);
 		}
-		response_l.add_child ("history", history);
+		writer.end_array ();
 		if (!hash.is_zero ())
 		{
-			response_l.put (reverse ? "next" : "previous", hash.to_string ());
+			writer.put (reverse ? "next" : "previous", hash.to_string ());
 		}
 	}
-	response_errors ();
+	response_errors (writer);
 }
 
 void nano::json_handler::keepalive ()
@@ -2732,8 +2995,9 @@ void nano::json_handler::key_expand ()
 
 void nano::json_handler::ledger ()
 {
-	auto count (count_optional_impl ());
+	auto count (listing_count_impl (count_optional_impl ()));
 	auto threshold (threshold_optional_impl ());
+	nano::json_writer writer;
 	if (!ec)
 	{
 		nano::account start{};
@@ -2756,104 +3020,155 @@ void nano::json_handler::ledger ()
 		bool const weight = request.get<bool> ("weight", false);
 		bool const pending = request.get<bool> ("pending", false);
 		bool const receivable = request.get<bool> ("receivable", pending);
-		boost::property_tree::ptree accounts;
-		auto transaction (node.store.tx_begin_read ());
+		auto write_account = [&] (store::transaction const & transaction, nano::account const & account, nano::account_info const & info, nano::uint128_t const & account_receivable) {
+			writer.begin_object (account.to_account ());
+			if (receivable)
+			{
+				writer.put ("pending", account_receivable.convert_to<std::string> ());
+				writer.put ("receivable", account_receivable.convert_to<std::string> ());
+			}
+			writer.put ("frontier", info.head.to_string ());
+			writer.put ("open_block", info.open_block.to_string ());
+			writer.put ("representative_block", node.ledger.representative (transaction, info.head).to_string ());
+			std::string balance;
+			nano::uint128_union (info.balance).encode_dec (balance);
+			writer.put ("balance", balance);
+			writer.put ("modified_timestamp", std::to_string (info.modified));
+			writer.put ("block_count", std::to_string (info.block_count));
+			if (representative)
+			{
+				writer.put ("representative", info.representative.to_account ());
+			}
+			if (weight)
+			{
+				auto account_weight (node.ledger.weight (account));
+				writer.put ("weight", account_weight.convert_to<std::string> ());
+			}
+			writer.end_object ();
+		};
+		// Accounts are listed by account, or by descending balance when sorting, where a cursor is the balance and account of the last one listed
+		using entry_t = std::pair<nano::uint128_union, nano::account>;
+		boost::optional<nano::account> cursor;
+		boost::optional<entry_t> sorted_cursor;
+		if (!sorting)
+		{
+			cursor = cursor_optional_impl ();
+		}
+		else
+		{
+			boost::optional<std::string> cursor_text (request.get_optional<std::string> ("cursor"));
+			if (cursor_text.is_initialized ())
+			{
+				entry_t position;
+				if (cursor_text->size () == 96 && !position.first.decode_hex (cursor_text->substr (0, 32)) && !position.second.decode_hex (cursor_text->substr (32)))
+				{
+					sorted_cursor = position;
+				}
+				else
+				{
+					ec = nano::error_rpc::invalid_cursor;
+				}
+			}
+		}
+		std::string next_cursor;
+		writer.begin_object ("accounts");
 		if (!ec && !sorting) // Simple
 		{
-			for (auto i (node.store.account.begin (transaction, start)), n (node.store.account.end ()); i != n && accounts.size () < count; ++i)
+			boost::optional<nano::account> next{ cursor ? *cursor : start };
+			while (next && writer.size () < count)
 			{
-				nano::account_info const & info (i->second);
-				if (info.modified >= modified_since && (receivable || info.balance.number () >= threshold.number ()))
+				auto transaction (node.store.tx_begin_read ());
+				nano::store::view_iterator<nano::account, nano::account_info> i{ node.store.account.begin (transaction, *next) };
+				auto const end (node.store.account.end ());
+				for (std::size_t read (0); i != end && writer.size () < count && read < listing_batch_size; ++i, ++read)
 				{
-					nano::account const & account (i->first);
-					boost::property_tree::ptree response_a;
-					if (receivable)
+					nano::store::account_info_view const view (i.view ().value);
+					if (view.modified () >= modified_since && (receivable || view.balance ().number () >= threshold.number ()))
 					{
-						auto account_receivable = node.ledger.account_receivable (transaction, account);
-						if (info.balance.number () + account_receivable < threshold.number ())
+						auto const [account, info] = i.entry ();
+						nano::uint128_t account_receivable{ 0 };
+						if (receivable)
 						{
-							continue;
+							account_receivable = node.ledger.account_receivable (transaction, account);
+							if (info.balance.number () + account_receivable < threshold.number ())
+							{
+								continue;
+							}
 						}
-						response_a.put ("pending", account_receivable.convert_to<std::string> ());
-						response_a.put ("receivable", account_receivable.convert_to<std::string> ());
-					}
-					response_a.put ("frontier", info.head.to_string ());
-					response_a.put ("open_block", info.open_block.to_string ());
-					response_a.put ("representative_block", node.ledger.representative (transaction, info.head).to_string ());
-					std::string balance;
-					nano::uint128_union (info.balance).encode_dec (balance);
-					response_a.put ("balance", balance);
-					response_a.put ("modified_timestamp", std::to_string (info.modified));
-					response_a.put ("block_count", std::to_string (info.block_count));
-					if (representative)
-					{
-						response_a.put ("representative", info.representative.to_account ());
+						write_account (transaction, account, info, account_receivable);
 					}
-					if (weight)
-					{
-						auto account_weight (node.ledger.weight (account));
-						response_a.put ("weight", account_weight.convert_to<std::string> ());
-					}
-					accounts.push_back (std::make_pair (account.to_account (), response_a));
 				}
+				next = i != end ? boost::optional<nano::account>{ i.view ().key_as<nano::account> () } : boost::none;
+			}
+			if (next)
+			{
+				next_cursor = next->to_string ();
 			}
 		}
 		else if (!ec) // Sorting
 		{
-			std::vector<std::pair<nano::uint128_union, nano::account>> ledger_l;
-			for (auto i (node.store.account.begin (transaction, start)), n (node.store.account.end ()); i != n; ++i)
+			// Only the first `count` accounts are kept while scanning, in a min-heap of the largest eligible entries seen so far
+			std::vector<entry_t> ledger_l;
+			bool truncated (false);
+			boost::optional<nano::account> next{ start };
+			while (next)
 			{
-				nano::account_info const & info (i->second);
-				nano::uint128_union balance (info.balance);
-				if (info.modified >= modified_since)
-				{
-					ledger_l.emplace_back (balance, i->first);
-				}
-			}
-			std::sort (ledger_l.begin (), ledger_l.end ());
-			std::reverse (ledger_l.begin (), ledger_l.end ());
-			nano::account_info info;
-			for (auto i (ledger_l.begin ()), n (ledger_l.end ()); i != n && accounts.size () < count; ++i)
-			{
-				node.store.account.get (transaction, i->second, info);
-				if (receivable || info.balance.number () >= threshold.number ())
+				auto transaction (node.store.tx_begin_read ());
+				nano::store::view_iterator<nano::account, nano::account_info> i{ node.store.account.begin (transaction, *next) };
+				auto const end (node.store.account.end ());
+				for (std::size_t read (0); i != end && read < listing_batch_size; ++i, ++read)
 				{
-					nano::account const & account (i->second);
-					boost::property_tree::ptree response_a;
-					if (receivable)
+					nano::store::account_info_view const info (i.view ().value);
+					if (info.modified () >= modified_since && (receivable || info.balance ().number () >= threshold.number ()))
 					{
-						auto account_receivable = node.ledger.account_receivable (transaction, account);
-						if (info.balance.number () + account_receivable < threshold.number ())
+						entry_t entry{ info.balance (), i.view ().key_as<nano::account> () };
+						if (sorted_cursor && !(entry < *sorted_cursor))
 						{
 							continue;
 						}
-						response_a.put ("pending", account_receivable.convert_to<std::string> ());
-						response_a.put ("receivable", account_receivable.convert_to<std::string> ());
-					}
-					response_a.put ("frontier", info.head.to_string ());
-					response_a.put ("open_block", info.open_block.to_string ());
-					response_a.put ("representative_block", node.ledger.representative (transaction, info.head).to_string ());
-					std::string balance;
-					(i->first).encode_dec (balance);
-					response_a.put ("balance", balance);
-					response_a.put ("modified_timestamp", std::to_string (info.modified));
-					response_a.put ("block_count", std::to_string (info.block_count));
-					if (representative)
-					{
-						response_a.put ("representative", info.representative.to_account ());
-					}
-					if (weight)
-					{
-						auto account_weight (node.ledger.weight (account));
-						response_a.put ("weight", account_weight.convert_to<std::string> ());
+						if (ledger_l.size () >= count && (count == 0 || !(ledger_l.front () < entry)))
+						{
+							truncated = true;
+							continue;
+						}
+						if (receivable && !threshold.is_zero () && info.balance ().number () + node.ledger.account_receivable (transaction, entry.second) < threshold.number ())
+						{
+							continue;
+						}
+						ledger_l.push_back (entry);
+						std::push_heap (ledger_l.begin (), ledger_l.end (), std::greater<entry_t> ());
+						if (ledger_l.size () > count)
+						{
+							std::pop_heap (ledger_l.begin (), ledger_l.end (), std::greater<entry_t> ());
+							ledger_l.pop_back ();
+							truncated = true;
+						}
 					}
-					accounts.push_back (std::make_pair (account.to_account (), response_a));
 				}
+				next = i != end ? boost::optional<nano::account>{ i.view ().key_as<nano::account> () } : boost::none;
+			}
+			std::sort (ledger_l.begin (), ledger_l.end (), std::greater<entry_t> ());
+			auto transaction (node.store.tx_begin_read ());
+			nano::account_info info;
+			for (auto const & [balance, account] : ledger_l)
+			{
+				node.store.account.get (transaction, account, info);
+				// The balance scanned is listed, the same one used for ordering
+				info.balance = balance.number ();
+				write_account (transaction, account, info, receivable ? node.ledger.account_receivable (transaction, account) : nano::uint128_t{ 0 });
+			}
+			if (truncated && !ledger_l.empty ())
+			{
+				next_cursor = ledger_l.back ().first.to_string () + ledger_l.back ().second.to_string ();
 			}
 		}
-		response_l.add_child ("accounts", accounts);
+		writer.end_object ();
+		if (!next_cursor.empty ())
+		{
+			writer.put ("cursor", next_cursor);
+		}
 	}
-	response_errors ();
+	response_errors (writer);
 }
 
 void nano::json_handler::mnano_from_raw (nano::uint128_t ratio)
@@ -3025,6 +3340,33 @@ void nano::json_handler::peers ()
 			}
 			debug_assert (channel->get_type () == nano::transport::transport_type::tcp);
 			pending_tree.put ("type", "tcp");
+			pending_tree.put ("rtt", std::to_string (std::chrono::duration_cast<std::chrono::milliseconds> (channel->get_rtt ()).count ()));
+			boost::property_tree::ptree traffic_l;
+			for (auto type : { nano::message_type::keepalive, nano::message_type::publish, nano::message_type::confirm_req, nano::message_type::confirm_ack, nano::message_type::node_id_handshake, nano::message_type::telemetry_req, nano::message_type::telemetry_ack, nano::message_type::asc_pull_req, nano::message_type::asc_pull_ack })
+			{
+				auto messages_in = channel->traffic.messages (type, nano::stat::dir::in);
+				auto messages_out = channel->traffic.messages (type, nano::stat::dir::out);
+				if (messages_in != 0 || messages_out != 0)
+				{
+					boost::property_tree::ptree entry;
+					entry.put ("bytes_in", std::to_string (channel->traffic.bytes (type, nano::stat::dir::in)));
+					entry.put ("bytes_out", std::to_string (channel->traffic.bytes (type, nano::stat::dir::out)));
+					entry.put ("messages_in", std::to_string (messages_in));
+					entry.put ("messages_out", std::to_string (messages_out));
+					traffic_l.add_child (nano::to_string (type), entry);
+				}
+			}
+			pending_tree.add_child ("traffic", traffic_l);
+			pending_tree.put ("send_queue_fill", channel->queue_fill ());
+			if (auto tcp_channel = std::dynamic_pointer_cast<nano::transport::channel_tcp> (channel))
+			{
+				if (auto socket = tcp_channel->socket.lock ())
+				{
+					pending_tree.put ("inbound_queued", std::to_string (socket->inbound.queued.load ()));
+					pending_tree.put ("inbound_enqueued", std::to_string (socket->inbound.enqueued.load ()));
+					pending_tree.put ("inbound_dropped", std::to_string (socket->inbound.dropped.load ()));
+				}
+			}
 			peers_l.push_back (boost::property_tree::ptree::value_type (text.str (), pending_tree));
 		}
 		else
@@ -3055,100 +3397,105 @@ void nano::json_handler::receivable ()
 	bool const sorting = request.get<bool> ("sorting", false);
 	auto simple (threshold.is_zero () && !source && !min_version && !sorting); // if simple, response is a list of hashes
 	bool const should_sort = sorting && !simple;
+	// Entries written by the calling action, such as the deprecation notice of "pending", come first
+	nano::json_writer writer{ response_l };
 	if (!ec)
 	{
-		auto offset_counter = offset;
-		boost::property_tree::ptree peers_l;
-		auto transaction (node.store.tx_begin_read ());
-		// The ptree container is used if there are any children nodes (e.g source/min_version) otherwise the amount container is used.
-		std::vector<std::pair<std::string, boost::property_tree::ptree>> hash_ptree_pairs;
-		std::vector<std::pair<std::string, nano::uint128_t>> hash_amount_pairs;
-		for (auto i (node.store.pending.begin (transaction, nano::pending_key (account, 0))), n (node.store.pending.end ()); i != n && nano::pending_key (i->first).account == account && (should_sort || peers_l.size () < count); ++i)
-		{
-			nano::pending_key const & key (i->first);
-			if (block_confirmed (node, transaction, key.hash, include_active, include_only_confirmed))
+		// Entries are the amount alone unless children (e.g source/min_version) are requested
+		auto write_entry = [&writer, source, min_version] (nano::pending_key const & key, nano::pending_info const & info) {
+			if (source || min_version)
 			{
-				if (!should_sort && offset_counter > 0)
+				writer.begin_object (key.hash.to_string ());
+				writer.put ("amount", info.amount.number ().convert_to<std::string> ());
+				if (source)
 				{
-					--offset_counter;
-					continue;
+					writer.put ("source", info.source.to_account ());
 				}
-
-				if (simple)
+				if (min_version)
 				{
-					boost::property_tree::ptree entry;
-					entry.put ("", key.hash.to_string ());
-					peers_l.push_back (std::make_pair ("", entry));
+					writer.put ("min_version", epoch_as_string (info.epoch));
 				}
-				else
+				writer.end_object ();
+			}
+			else
+			{
+				writer.put (key.hash.to_string (), info.amount.number ().convert_to<std::string> ());
+			}
+		};
+		auto transaction (node.store.tx_begin_read ());
+		if (simple)
+		{
+			writer.begin_array ("blocks");
+		}
+		else
+		{
+			writer.begin_object ("blocks");
+		}
+		if (should_sort && node.ledger.receivable_index)
+		{
+			// Read in descending amount order from the index, only the entries skipped by `offset` and the `count` returned are visited
+			for (auto const & [key, info] : receivable_by_amount (node, transaction, account, threshold.number (), offset, count, include_active, include_only_confirmed))
+			{
+				write_entry (key, info);
+			}
+		}
+		else
+		{
+			auto offset_counter = offset;
+			std::vector<std::pair<nano::pending_key, nano::pending_info>> sorted;
+			for (auto i (node.store.pending.begin (transaction, nano::pending_key (account, 0))), n (node.store.pending.end ()); i != n && nano::pending_key (i->first).account == account && (should_sort || writer.size () < count); ++i)
+			{
+				nano::pending_key const & key (i->first);
+				if (block_confirmed (node, transaction, key.hash, include_active, include_only_confirmed))
 				{
-					nano::pending_info const & info (i->second);
-					if (info.amount.number () >= threshold.number ())
+					if (!should_sort && offset_counter > 0)
 					{
-						if (source || min_version)
-						{
-							boost::property_tree::ptree pending_tree;
-							pending_tree.put ("amount", info.amount.number ().convert_to<std::string> ());
-							if (source)
-							{
-								pending_tree.put ("source", info.source.to_account ());
-							}
-							if (min_version)
-							{
-								pending_tree.put ("min_version", epoch_as_string (info.epoch));
-							}
+						--offset_counter;
+						continue;
+					}
 
-							if (should_sort)
-							{
-								hash_ptree_pairs.emplace_back (key.hash.to_string (), pending_tree);
-							}
-							else
-							{
-								peers_l.add_child (key.hash.to_string (), pending_tree);
-							}
-						}
-						else
+					if (simple)
+					{
+						writer.push_back (key.hash.to_string ());
+					}
+					else
+					{
+						nano::pending_info const & info (i->second);
+						if (info.amount.number () >= threshold.number ())
 						{
 							if (should_sort)
 							{
-								hash_amount_pairs.emplace_back (key.hash.to_string (), info.amount.number ());
+								sorted.emplace_back (key, info);
 							}
 							else
 							{
-								peers_l.put (key.hash.to_string (), info.amount.number ().convert_to<std::string> ());
+								write_entry (key, info);
 							}
 						}
 					}
 				}
 			}
-		}
-		if (should_sort)
-		{
-			if (source || min_version)
-			{
-				std::stable_sort (hash_ptree_pairs.begin (), hash_ptree_pairs.end (), [] (auto const & lhs, auto const & rhs) {
-					return lhs.second.template get<nano::uint128_t> ("amount") > rhs.second.template get<nano::uint128_t> ("amount");
-				});
-				for (auto i = offset, j = offset + count; i < hash_ptree_pairs.size () && i < j; ++i)
-				{
-					peers_l.add_child (hash_ptree_pairs[i].first, hash_ptree_pairs[i].second);
-				}
-			}
-			else
+			if (should_sort)
 			{
-				std::stable_sort (hash_amount_pairs.begin (), hash_amount_pairs.end (), [] (auto const & lhs, auto const & rhs) {
-					return lhs.second > rhs.second;
+				std::stable_sort (sorted.begin (), sorted.end (), [] (auto const & lhs, auto const & rhs) {
+					return lhs.second.amount.number () > rhs.second.amount.number ();
 				});
-
-				for (auto i = offset, j = offset + count; i < hash_amount_pairs.size () && i < j; ++i)
+				for (auto i = offset, j = offset + count; i < sorted.size () && i < j; ++i)
 				{
-					peers_l.put (hash_amount_pairs[i].first, hash_amount_pairs[i].second.convert_to<std::string> ());
+					write_entry (sorted[i].first, sorted[i].second);
 				}
 			}
 		}
-		response_l.add_child ("blocks", peers_l);
+		if (simple)
+		{
+			writer.end_array ();
+		}
+		else
+		{
+			writer.end_object ();
+		}
 	}
-	response_errors ();
+	response_errors (writer);
 }
 
 void nano::json_handler::pending_exists ()
@@ -3510,10 +3857,11 @@ void nano::json_handler::receive_minimum_set ()
 void nano::json_handler::representatives ()
 {
 	auto count (count_optional_impl ());
+	nano::json_writer writer;
 	if (!ec)
 	{
 		bool const sorting = request.get<bool> ("sorting", false);
-		boost::property_tree::ptree representatives;
+		writer.begin_object ("representatives");
 		auto rep_amounts = node.ledger.cache.rep_weights.get_rep_amounts ();
 		if (!sorting) // Simple
 		{
@@ -3522,9 +3870,9 @@ void nano::json_handler::representatives ()
 			{
 				auto const & account (rep_amount.first);
 				auto const & amount (rep_amount.second);
-				representatives.put (account.to_account (), amount.convert_to<std::string> ());
+				writer.put (account.to_account (), amount.convert_to<std::string> ());
 
-				if (representatives.size () > count)
+				if (writer.size () > count)
 				{
 					break;
 				}
@@ -3542,14 +3890,14 @@ void nano::json_handler::representatives ()
 			}
 			std::sort (representation.begin (), representation.end ());
 			std::reverse (representation.begin (), representation.end ());
-			for (auto i (representation.begin ()), n (representation.end ()); i != n && representatives.size () < count; ++i)
+			for (auto i (representation.begin ()), n (representation.end ()); i != n && writer.size () < count; ++i)
 			{
-				representatives.put (i->second, (i->first).convert_to<std::string> ());
+				writer.put (i->second, (i->first).convert_to<std::string> ());
 			}
 		}
-		response_l.add_child ("representatives", representatives);
+		writer.end_object ();
 	}
-	response_errors ();
+	response_errors (writer);
 }
 
 void nano::json_handler::representatives_online ()
@@ -3952,6 +4300,10 @@ void nano::json_handler::stats ()
 	{
 		node.store.serialize_memory_stats (response_l);
 	}
+	else if (type == "store")
+	{
+		node.store.instrumentation.serialize (response_l);
+	}
 	else
 	{
 		ec = nano::error_rpc::invalid_missing_type;
@@ -3973,6 +4325,7 @@ void nano::json_handler::stats ()
 void nano::json_handler::stats_clear ()
 {
 	node.stats.clear ();
+	node.store.instrumentation.clear ();
 	response_l.put ("success", "");
 	std::stringstream ostream;
 	boost::property_tree::write_json (ostream, response_l);
@@ -4140,8 +4493,8 @@ void nano::json_handler::unchecked ()
 	if (!ec)
 	{
 		boost::property_tree::ptree unchecked;
-		node.unchecked.for_each (
-		[&unchecked, &json_block_l] (nano::unchecked_key const & key, nano::unchecked_info const & info) {
+		for (auto const & [key, info] : node.unchecked.list (count))
+		{
 			if (json_block_l)
 			{
 				boost::property_tree::ptree block_node_l;
@@ -4153,7 +4506,8 @@ void nano::json_handler::unchecked ()
 				std::string contents;
 				info.block->serialize_json (contents);
 				unchecked.put (info.block->hash ().to_string (), contents);
-			} }, [iterations = 0, count = count] () mutable { return iterations++ < count; });
+			}
+		}
 		response_l.add_child ("blocks", unchecked);
 	}
 	response_errors ();
@@ -4174,27 +4528,24 @@ void nano::json_handler::unchecked_get ()
 	auto hash (hash_impl ());
 	if (!ec)
 	{
-		bool done = false;
-		node.unchecked.for_each (
-		[&] (nano::unchecked_key const & key, nano::unchecked_info const & info) {
-			if (key.hash == hash)
-			{
-				response_l.put ("modified_timestamp", std::to_string (info.modified ()));
+		if (auto entry = node.unchecked.find (hash))
+		{
+			auto const & info = entry->second;
+			response_l.put ("modified_timestamp", std::to_string (info.modified ()));
 
-				if (json_block_l)
-				{
-					boost::property_tree::ptree block_node_l;
-					info.block->serialize_json (block_node_l);
-					response_l.add_child ("contents", block_node_l);
-				}
-				else
-				{
-					std::string contents;
-					info.block->serialize_json (contents);
-					response_l.put ("contents", contents);
-				}
-				done = true;
-			} }, [&] () { return !done; });
+			if (json_block_l)
+			{
+				boost::property_tree::ptree block_node_l;
+				info.block->serialize_json (block_node_l);
+				response_l.add_child ("contents", block_node_l);
+			}
+			else
+			{
+				std::string contents;
+				info.block->serialize_json (contents);
+				response_l.put ("contents", contents);
+			}
+		}
 		if (response_l.empty ())
 		{
 			ec = nano::error_blocks::not_found;
@@ -4219,11 +4570,14 @@ void nano::json_handler::unchecked_keys ()
 	if (!ec)
 	{
 		boost::property_tree::ptree unchecked;
-		node.unchecked.for_each (
-		key,
-		[&unchecked, json_block_l] (nano::unchecked_key const & key, nano::unchecked_info const & info) {
+		for (auto const & [key_l, info] : node.unchecked.list (key))
+		{
+			if (unchecked.size () >= count)
+			{
+				break;
+			}
 			boost::property_tree::ptree entry;
-			entry.put ("key", key.key ().to_string ());
+			entry.put ("key", key_l.key ().to_string ());
 			entry.put ("hash", info.block->hash ().to_string ());
 			entry.put ("modified_timestamp", std::to_string (info.modified ()));
 			if (json_block_l)
@@ -4238,7 +4592,8 @@ void nano::json_handler::unchecked_keys ()
 				info.block->serialize_json (contents);
 				entry.put ("contents", contents);
 			}
-			unchecked.push_back (std::make_pair ("", entry)); }, [&unchecked, &count] () { return unchecked.size () < count; });
+			unchecked.push_back (std::make_pair ("", entry));
+		}
 		response_l.add_child ("unchecked", unchecked);
 	}
 	response_errors ();
@@ -4246,7 +4601,7 @@ void nano::json_handler::unchecked_keys ()
 
 void nano::json_handler::unopened ()
 {
-	auto count (count_optional_impl ());
+	auto count (listing_count_impl (count_optional_impl ()));
 	auto threshold (threshold_optional_impl ());
 	nano::account start (1); // exclude burn account by default
 	boost::optional<std::string> account_text (request.get_optional<std::string> ("account"));
@@ -4254,54 +4609,63 @@ void nano::json_handler::unopened ()
 	{
 		start = account_impl (account_text.get ());
 	}
+	auto cursor (cursor_optional_impl ());
+	nano::json_writer writer;
 	if (!ec)
 	{
-		auto transaction (node.store.tx_begin_read ());
-		auto iterator (node.store.pending.begin (transaction, nano::pending_key (start, 0)));
-		auto end (node.store.pending.end ());
-		nano::account current_account (start);
-		nano::uint128_t current_account_sum{ 0 };
-		boost::property_tree::ptree accounts;
-		while (iterator != end && accounts.size () < count)
+		using iterator_t = nano::store::view_iterator<nano::pending_key, nano::pending_info>;
+		boost::optional<nano::account> next{ cursor ? *cursor : start };
+		writer.begin_object ("accounts");
+		while (next && writer.size () < count)
 		{
-			nano::pending_key key (iterator->first);
-			nano::account account (key.account);
-			nano::pending_info info (iterator->second);
-			if (node.store.account.exists (transaction, account))
+			auto transaction (node.store.tx_begin_read ());
+			iterator_t iterator{ node.store.pending.begin (transaction, nano::pending_key (*next, 0)) };
+			auto const end (node.store.pending.end ());
+			next = boost::none;
+			// Batches end between accounts so the receivable sum of an account is read in one transaction
+			for (std::size_t read (0); iterator != end && writer.size () < count;)
 			{
-				if (account.number () == std::numeric_limits<nano::uint256_t>::max ())
+				nano::account const account (iterator.view ().key_as<nano::pending_key> ().account);
+				if (read >= listing_batch_size)
 				{
+					next = account;
 					break;
 				}
-				// Skip existing accounts
-				iterator = node.store.pending.begin (transaction, nano::pending_key (account.number () + 1, 0));
-			}
-			else
-			{
-				if (account != current_account)
+				if (node.store.account.exists (transaction, account))
 				{
-					if (current_account_sum > 0)
+					if (account.number () == std::numeric_limits<nano::uint256_t>::max ())
 					{
-						if (current_account_sum >= threshold.number ())
-						{
-							accounts.put (current_account.to_account (), current_account_sum.convert_to<std::string> ());
-						}
-						current_account_sum = 0;
+						break;
 					}
-					current_account = account;
+					// Skip existing accounts
+					iterator = iterator_t{ node.store.pending.begin (transaction, nano::pending_key (account.number () + 1, 0)) };
+					++read;
 				}
-				current_account_sum += info.amount.number ();
-				++iterator;
+				else
+				{
+					nano::uint128_t account_sum{ 0 };
+					for (; iterator != end && iterator.view ().key_as<nano::pending_key> ().account == account; ++iterator, ++read)
+					{
+						account_sum += nano::store::pending_info_view{ iterator.view ().value }.amount ().number ();
+					}
+					if (account_sum > 0 && account_sum >= threshold.number ())
+					{
+						writer.put (account.to_account (), account_sum.convert_to<std::string> ());
+					}
+				}
+			}
+			if (!next && iterator != end && writer.size () >= count)
+			{
+				next = iterator.view ().key_as<nano::pending_key> ().account;
 			}
 		}
-		// last one after iterator reaches end
-		if (accounts.size () < count && current_account_sum > 0 && current_account_sum >= threshold.number ())
+		writer.end_object ();
+		if (next)
 		{
-			accounts.put (current_account.to_account (), current_account_sum.convert_to<std::string> ());
+			writer.put ("cursor", next->to_string ());
 		}
-		response_l.add_child ("accounts", accounts);
 	}
-	response_errors ();
+	response_errors (writer);
 }
 
 void nano::json_handler::uptime ()
@@ -4373,7 +4737,7 @@ void nano::json_handler::wallet_add_watch ()
 			{
 				for (auto & accounts : rpc_l->request.get_child ("accounts"))
 				{
-					auto account (rpc_l->account_impl (accounts.second.data ()));
+					auto account (rpc_l->account_impl (accounts.second.get<std::string> ("")));
 					if (!rpc_l->ec)
 					{
 						if (wallet->insert_watch (transaction, account))
@@ -4644,12 +5008,36 @@ void nano::json_handler::wallet_history ()
 		}
 	}
 	auto wallet (wallet_impl ());
+	auto count (listing_count_impl (count_optional_impl ()));
+	boost::optional<std::string> cursor_text (request.get_optional<std::string> ("cursor"));
 	if (!ec)
 	{
-		std::multimap<uint64_t, boost::property_tree::ptree, std::greater<uint64_t>> entries;
+		// Entries are listed newest first, then by account and from the head of each chain, the ascending order of these positions
+		using position_t = std::tuple<uint64_t, nano::account, uint64_t>;
+		auto const position = [] (uint64_t timestamp_a, nano::account const & account_a, uint64_t height_a) {
+			return position_t{ std::numeric_limits<uint64_t>::max () - timestamp_a, account_a, std::numeric_limits<uint64_t>::max () - height_a };
+		};
+		std::map<position_t, boost::property_tree::ptree> entries;
+		bool truncated (false);
 		auto transaction (node.wallets.tx_begin_read ());
 		auto block_transaction (node.store.tx_begin_read ());
-		for (auto i (wallet->store.begin (transaction)), n (wallet->store.end ()); i != n; ++i)
+		boost::optional<position_t> cursor;
+		if (cursor_text.is_initialized ())
+		{
+			// A cursor is the hash of the last block listed
+			nano::block_hash cursor_hash;
+			auto cursor_block (!cursor_hash.decode_hex (cursor_text.get ()) ? node.store.block.get (block_transaction, cursor_hash) : nullptr);
+			if (cursor_block != nullptr)
+			{
+				cursor = position (cursor_block->sideband ().timestamp, node.ledger.account (*cursor_block), cursor_block->sideband ().height);
+			}
+			else
+			{
+				ec = nano::error_rpc::invalid_cursor;
+			}
+		}
+		std::size_t read (0);
+		for (auto i (wallet->store.begin (transaction)), n (wallet->store.end ()); !ec && i != n; ++i)
 		{
 			nano::account const & account (i->first);
 			auto info = node.ledger.account_info (block_transaction, account);
@@ -4659,20 +5047,32 @@ void nano::json_handler::wallet_history ()
 				auto hash (info->head);
 				while (timestamp >= modified_since && !hash.is_zero ())
 				{
+					if (++read % listing_batch_size == 0)
+					{
+						block_transaction.refresh ();
+					}
 					auto block (node.store.block.get (block_transaction, hash));
-					timestamp = block->sideband ().timestamp;
-					if (block != nullptr && timestamp >= modified_since)
+					// The block can be gone if it was rolled back before the transaction was refreshed
+					if (block != nullptr && block->sideband ().timestamp >= modified_since)
 					{
+						timestamp = block->sideband ().timestamp;
 						boost::property_tree::ptree entry;
 						std::vector<nano::public_key> no_filter;
 						history_visitor visitor (*this, false, block_transaction, entry, hash, no_filter);
 						block->visit (visitor);
-						if (!entry.empty ())
+						auto const entry_position (position (timestamp, account, block->sideband ().height));
+						if (!entry.empty () && (!cursor || *cursor < entry_position))
 						{
 							entry.put ("block_account", account.to_account ());
 							entry.put ("hash", hash.to_string ());
 							entry.put ("local_timestamp", std::to_string (timestamp));
-							entries.insert (std::make_pair (timestamp, entry));
+							entries.emplace (entry_position, entry);
+							// Only the first `count` entries are kept
+							if (entries.size () > count)
+							{
+								entries.erase (std::prev (entries.end ()));
+								truncated = true;
+							}
 						}
 						hash = block->previous ();
 					}
@@ -4689,6 +5089,10 @@ void nano::json_handler::wallet_history ()
 			history.push_back (std::make_pair ("", i->second));
 		}
 		response_l.add_child ("history", history);
+		if (truncated && !entries.empty ())
+		{
+			response_l.put ("cursor", entries.rbegin ()->second.get<std::string> ("hash"));
+		}
 	}
 	response_errors ();
 }
@@ -4718,9 +5122,10 @@ void nano::json_handler::wallet_ledger ()
 		modified_since = strtoul (modified_since_text.get ().c_str (), NULL, 10);
 	}
 	auto wallet (wallet_impl ());
+	nano::json_writer writer;
 	if (!ec)
 	{
-		boost::property_tree::ptree accounts;
+		writer.begin_object ("accounts");
 		auto transaction (node.wallets.tx_begin_read ());
 		auto block_transaction (node.store.tx_begin_read ());
 		for (auto i (wallet->store.begin (transaction)), n (wallet->store.end ()); i != n; ++i)
@@ -4731,37 +5136,37 @@ void nano::json_handler::wallet_ledger ()
 			{
 				if (info->modified >= modified_since)
 				{
-					boost::property_tree::ptree entry;
-					entry.put ("frontier", info->head.to_string ());
-					entry.put ("open_block", info->open_block.to_string ());
-					entry.put ("representative_block", node.ledger.representative (block_transaction, info->head).to_string ());
+					writer.begin_object (account.to_account ());
+					writer.put ("frontier", info->head.to_string ());
+					writer.put ("open_block", info->open_block.to_string ());
+					writer.put ("representative_block", node.ledger.representative (block_transaction, info->head).to_string ());
 					std::string balance;
 					nano::uint128_union (info->balance).encode_dec (balance);
-					entry.put ("balance", balance);
-					entry.put ("modified_timestamp", std::to_string (info->modified));
-					entry.put ("block_count", std::to_string (info->block_count));
+					writer.put ("balance", balance);
+					writer.put ("modified_timestamp", std::to_string (info->modified));
+					writer.put ("block_count", std::to_string (info->block_count));
 					if (representative)
 					{
-						entry.put ("representative", info->representative.to_account ());
+						writer.put ("representative", info->representative.to_account ());
 					}
 					if (weight)
 					{
 						auto account_weight (node.ledger.weight (account));
-						entry.put ("weight", account_weight.convert_to<std::string> ());
+						writer.put ("weight", account_weight.convert_to<std::string> ());
 					}
 					if (receivable)
 					{
 						auto account_receivable (node.ledger.account_receivable (block_transaction, account));
-						entry.put ("pending", account_receivable.convert_to<std::string> ());
-						entry.put ("receivable", account_receivable.convert_to<std::string> ());
+						writer.put ("pending", account_receivable.convert_to<std::string> ());
+						writer.put ("receivable", account_receivable.convert_to<std::string> ());
 					}
-					accounts.push_back (std::make_pair (account.to_account (), entry));
+					writer.end_object ();
 				}
 			}
 		}
-		response_l.add_child ("accounts", accounts);
+		writer.end_object ();
 	}
-	response_errors ();
+	response_errors (writer);
 }
 
 void nano::json_handler::wallet_lock ()
@@ -4793,6 +5198,8 @@ void nano::json_handler::wallet_receivable ()
 	bool const min_version = request.get<bool> ("min_version", false);
 	bool const include_active = request.get<bool> ("include_active", false);
 	bool const include_only_confirmed = request.get<bool> ("include_only_confirmed", true);
+	bool const sorting = request.get<bool> ("sorting", false);
+	auto simple (threshold.is_zero () && !source && !sorting); // if simple, response is a list of hashes for each account
 	if (!ec)
 	{
 		boost::property_tree::ptree pending;
@@ -4802,43 +5209,69 @@ void nano::json_handler::wallet_receivable ()
 		{
 			nano::account const & account (i->first);
 			boost::property_tree::ptree peers_l;
-			for (auto ii (node.store.pending.begin (block_transaction, nano::pending_key (account, 0))), nn (node.store.pending.end ()); ii != nn && nano::pending_key (ii->first).account == account && peers_l.size () < count; ++ii)
-			{
-				nano::pending_key key (ii->first);
-				if (block_confirmed (node, block_transaction, key.hash, include_active, include_only_confirmed))
+			auto add_entry = [&peers_l, source, min_version] (nano::pending_key const & key, nano::pending_info const & info) {
+				if (source || min_version)
 				{
-					if (threshold.is_zero () && !source)
+					boost::property_tree::ptree pending_tree;
+					pending_tree.put ("amount", info.amount.number ().convert_to<std::string> ());
+					if (source)
 					{
-						boost::property_tree::ptree entry;
-						entry.put ("", key.hash.to_string ());
-						peers_l.push_back (std::make_pair ("", entry));
+						pending_tree.put ("source", info.source.to_account ());
 					}
-					else
+					if (min_version)
 					{
-						nano::pending_info info (ii->second);
-						if (info.amount.number () >= threshold.number ())
+						pending_tree.put ("min_version", epoch_as_string (info.epoch));
+					}
+					peers_l.add_child (key.hash.to_string (), pending_tree);
+				}
+				else
+				{
+					peers_l.put (key.hash.to_string (), info.amount.number ().convert_to<std::string> ());
+				}
+			};
+			if (sorting && node.ledger.receivable_index)
+			{
+				// Read in descending amount order from the index, only the `count` largest receivables are visited
+				for (auto const & [key, info] : receivable_by_amount (node, block_transaction, account, threshold.number (), 0, count, include_active, include_only_confirmed))
+				{
+					add_entry (key, info);
+				}
+			}
+			else
+			{
+				// Sorted output has to see every entry, the `count` largest are kept after sorting
+				for (auto ii (node.store.pending.begin (block_transaction, nano::pending_key (account, 0))), nn (node.store.pending.end ()); ii != nn && nano::pending_key (ii->first).account == account && (sorting || peers_l.size () < count); ++ii)
+				{
+					nano::pending_key key (ii->first);
+					if (block_confirmed (node, block_transaction, key.hash, include_active, include_only_confirmed))
+					{
+						if (simple)
 						{
-							if (source || min_version)
-							{
-								boost::property_tree::ptree pending_tree;
-								pending_tree.put ("amount", info.amount.number ().convert_to<std::string> ());
-								if (source)
-								{
-									pending_tree.put ("source", info.source.to_account ());
-								}
-								if (min_version)
-								{
-									pending_tree.put ("min_version", epoch_as_string (info.epoch));
-								}
-								peers_l.add_child (key.hash.to_string (), pending_tree);
-							}
-							else
+							boost::property_tree::ptree entry;
+							entry.put ("", key.hash.to_string ());
+							peers_l.push_back (std::make_pair ("", entry));
+						}
+						else
+						{
+							nano::pending_info info (ii->second);
+							if (info.amount.number () >= threshold.number ())
 							{
-								peers_l.put (key.hash.to_string (), info.amount.number ().convert_to<std::string> ());
+								add_entry (key, info);
 							}
 						}
 					}
 				}
+				if (sorting)
+				{
+					auto const amount_path = source || min_version ? "amount" : "";
+					peers_l.sort ([amount_path] (auto const & child1, auto const & child2) -> bool {
+						return child1.second.template get<nano::uint128_t> (amount_path) > child2.second.template get<nano::uint128_t> (amount_path);
+					});
+					if (peers_l.size () > count)
+					{
+						peers_l.erase (std::next (peers_l.begin (), count), peers_l.end ());
+					}
+				}
 			}
 			if (!peers_l.empty ())
 			{
@@ -5470,6 +5903,32 @@ bool block_confirmed (nano::node & node, nano::store::transaction & transaction,
 	return is_confirmed;
 }
 
+/**
+ * Confirmed receivables of `account` with amounts of at least `threshold` from the largest amount down, ties ordered by hash.
+ * Read from the receivable amount index so only the entries returned and skipped by `offset` are visited.
+ */
+std::vector<std::pair<nano::pending_key, nano::pending_info>> receivable_by_amount (nano::node & node, nano::store::transaction & transaction, nano::account const & account, nano::uint128_t const & threshold, uint64_t offset, uint64_t count, bool include_active, bool include_only_confirmed)
+{
+	debug_assert (node.ledger.receivable_index);
+	std::vector<std::pair<nano::pending_key, nano::pending_info>> result;
+	for (auto i (node.store.receivable_amount.begin (transaction, nano::receivable_amount_key{ account, std::numeric_limits<nano::uint128_t>::max (), 0 })), n (node.store.receivable_amount.end ()); i != n && i->first.account == account && i->first.amount ().number () >= threshold && result.size () < count; ++i)
+	{
+		nano::pending_key const key{ account, i->first.hash };
+		if (block_confirmed (node, transaction, key.hash, include_active, include_only_confirmed))
+		{
+			if (offset > 0)
+			{
+				--offset;
+				continue;
+			}
+			auto const info = node.ledger.pending_info (transaction, key);
+			debug_assert (info);
+			result.emplace_back (key, *info);
+		}
+	}
+	return result;
+}
+
 char const * epoch_as_string (nano::epoch epoch)
 {
 	switch (epoch)
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <nano/lib/json_reader.hpp>
+#include <nano/lib/json_writer.hpp>
 #include <nano/lib/numbers.hpp>
 #include <nano/node/ipc/flatbuffers_handler.hpp>
 #include <nano/node/wallet.hpp>
@@ -148,9 +150,13 @@ public:
 	void work_validate ();
 	std::string body;
 	nano::node & node;
-	boost::property_tree::ptree request;
+	/** Owns the parsed body that `request` views */
+	nano::json_reader request_reader;
+	nano::json_value request;
 	std::function<void (std::string const &)> response;
 	void response_errors ();
+	/** Responds with the document of `writer` unless an error is set, for actions streaming their response */
+	void response_errors (nano::json_writer & writer);
 	std::error_code ec;
 	std::string action;
 	boost::property_tree::ptree response_l;
@@ -167,6 +173,8 @@ public:
 	uint64_t count_impl ();
 	uint64_t count_optional_impl (uint64_t = std::numeric_limits<uint64_t>::max ());
 	uint64_t offset_optional_impl (uint64_t = 0);
+	boost::optional<nano::account> cursor_optional_impl ();
+	uint64_t listing_count_impl (uint64_t);
 	uint64_t difficulty_optional_impl (nano::work_version const);
 	uint64_t difficulty_ledger (nano::block const &);
 	double multiplier_optional_impl (nano::work_version const, uint64_t &);
@@ -175,6 +183,8 @@ public:
 	std::function<void ()> stop_callback;
 	nano::node_rpc_config const & node_rpc_config;
 	std::function<void ()> create_worker_task (std::function<void (std::shared_ptr<nano::json_handler> const &)> const &);
+	/** Runs each action object of an array request with a handler of its own and responds with the array of their responses */
+	void process_batch (bool unsafe);
 };
 
 class inprocess_rpc_handler final : public nano::rpc_handler_interface
@@ -0,0 +1,532 @@
+#include <nano/lib/blocks.hpp>
+#include <nano/lib/locks.hpp>
+#include <nano/lib/stream.hpp>
+#include <nano/lib/thread_pool.hpp>
+#include <nano/node/ledger_snapshot.hpp>
+#include <nano/secure/common.hpp>
+#include <nano/store/account.hpp>
+#include <nano/store/block.hpp>
+#include <nano/store/component.hpp>
+#include <nano/store/confirmation_height.hpp>
+#include <nano/store/delegator.hpp>
+#include <nano/store/final.hpp>
+#include <nano/store/frontier.hpp>
+#include <nano/store/pending.hpp>
+#include <nano/store/pruned.hpp>
+#include <nano/store/receivable_amount.hpp>
+#include <nano/store/version.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <fstream>
+#include <unordered_map>
+
+namespace
+{
+uint8_t constexpr end_marker = 0xff;
+
+/** Tables that make up the ledger, other tables are node local state and are not part of a snapshot */
+std::array<nano::tables, 7> constexpr snapshot_tables = {
+	nano::tables::accounts,
+	nano::tables::blocks,
+	nano::tables::confirmation_height,
+	nano::tables::final_votes,
+	nano::tables::frontiers,
+	nano::tables::pending,
+	nano::tables::pruned
+};
+
+/** Bounds the allocation made for a corrupt chunk header */
+std::size_t constexpr max_chunk_payload = 16 * nano::ledger_snapshot::chunk_size;
+
+/** Chunk header following the table byte: record count, payload size and checksum */
+std::size_t constexpr chunk_header_size = sizeof (uint32_t) + sizeof (uint32_t) + sizeof (uint64_t);
+
+bool is_snapshot_table (uint8_t table)
+{
+	return std::any_of (snapshot_tables.begin (), snapshot_tables.end (), [table] (nano::tables const & item) {
+		return static_cast<uint8_t> (item) == table;
+	});
+}
+
+/** Empties the ledger tables and writes genesis again, leaving the fresh ledger a failed restore started from */
+void reset (nano::store::component & store, nano::ledger_constants & constants)
+{
+	auto transaction = store.tx_begin_write (std::vector<nano::tables> (snapshot_tables.begin (), snapshot_tables.end ()));
+	for (auto table : snapshot_tables)
+	{
+		store.drop (transaction, table);
+	}
+	nano::ledger_cache cache;
+	store.initialize (transaction, cache, constants);
+}
+
+uint64_t checksum (std::vector<uint8_t> const & payload)
+{
+	uint64_t result;
+	blake2b_state state;
+	blake2b_init (&state, sizeof (result));
+	blake2b_update (&state, payload.data (), payload.size ());
+	blake2b_final (&state, &result, sizeof (result));
+	return result;
+}
+
+/** Shared output file, chunks from all traversal threads are appended to it as they complete */
+class snapshot_output final
+{
+public:
+	explicit snapshot_output (std::filesystem::path const & path) :
+		file{ path, std::ios::binary | std::ios::trunc }
+	{
+	}
+
+	void write (std::vector<uint8_t> const & bytes)
+	{
+		file.write (reinterpret_cast<char const *> (bytes.data ()), bytes.size ());
+	}
+
+	void write_chunk (nano::tables table, uint32_t records, std::vector<uint8_t> const & payload)
+	{
+		std::vector<uint8_t> header;
+		{
+			nano::vectorstream stream{ header };
+			nano::write (stream, static_cast<uint8_t> (table));
+			nano::write_big_endian (stream, records);
+			nano::write_big_endian (stream, static_cast<uint32_t> (payload.size ()));
+			nano::write_big_endian (stream, checksum (payload));
+		}
+		nano::lock_guard<nano::mutex> guard{ mutex };
+		write (header);
+		write (payload);
+		counts[table] += records;
+	}
+
+	nano::mutex mutex;
+	std::ofstream file;
+	std::unordered_map<nano::tables, uint64_t> counts;
+};
+
+/** Accumulates records of one table on a traversal thread and hands them to the output once a chunk is full */
+class chunk_writer final
+{
+public:
+	chunk_writer (snapshot_output & output_a, nano::tables table_a) :
+		output{ output_a },
+		table{ table_a }
+	{
+		payload.reserve (nano::ledger_snapshot::chunk_size);
+	}
+
+	~chunk_writer ()
+	{
+		flush ();
+	}
+
+	template <typename Serialize>
+	void add (Serialize const & serialize)
+	{
+		{
+			nano::vectorstream stream{ payload };
+			serialize (stream);
+		}
+		++records;
+		if (payload.size () >= nano::ledger_snapshot::chunk_size)
+		{
+			flush ();
+		}
+	}
+
+private:
+	void flush ()
+	{
+		if (records > 0)
+		{
+			output.write_chunk (table, records, payload);
+			payload.clear ();
+			records = 0;
+		}
+	}
+
+	snapshot_output & output;
+	nano::tables const table;
+	std::vector<uint8_t> payload;
+	uint32_t records{ 0 };
+};
+
+/** Writes the records of one chunk, the chunk is applied in a single write transaction locking only its table */
+bool restore_chunk (nano::store::component & store, nano::tables table, std::vector<uint8_t> const & payload, uint32_t records)
+{
+	nano::bufferstream stream{ payload.data (), payload.size () };
+	auto transaction = store.tx_begin_write ({ table });
+	std::vector<uint8_t> value;
+	try
+	{
+		for (uint32_t i = 0; i < records; ++i)
+		{
+			switch (table)
+			{
+				case nano::tables::accounts:
+				{
+					nano::account account;
+					nano::account_info info;
+					nano::read (stream, account);
+					if (info.deserialize (stream))
+					{
+						return true;
+					}
+					store.account.put (transaction, account, info);
+					break;
+				}
+				case nano::tables::blocks:
+				{
+					// Blocks are stored exactly as the database value, type followed by block and sideband
+					nano::block_hash hash;
+					nano::block_type type;
+					nano::read (stream, hash);
+					nano::read (stream, type);
+					if (type < nano::block_type::send || type > nano::block_type::state)
+					{
+						return true;
+					}
+					auto const size = nano::block::size (type) + nano::block_sideband::size (type);
+					value.resize (sizeof (type) + size);
+					value[0] = static_cast<uint8_t> (type);
+					if (stream.sgetn (value.data () + sizeof (type), size) != static_cast<std::streamsize> (size))
+					{
+						return true;
+					}
+					store.block.raw_put (transaction, value, hash);
+					break;
+				}
+				case nano::tables::confirmation_height:
+				{
+					nano::account account;
+					nano::confirmation_height_info info;
+					nano::read (stream, account);
+					if (info.deserialize (stream))
+					{
+						return true;
+					}
+					store.confirmation_height.put (transaction, account, info);
+					break;
+				}
+				case nano::tables::final_votes:
+				{
+					nano::qualified_root root;
+					nano::block_hash hash;
+					nano::read (stream, root);
+					nano::read (stream, hash);
+					store.final_vote.put (transaction, root, hash);
+					break;
+				}
+				case nano::tables::frontiers:
+				{
+					nano::block_hash hash;
+					nano::account account;
+					nano::read (stream, hash);
+					nano::read (stream, account);
+					store.frontier.put (transaction, hash, account);
+					break;
+				}
+				case nano::tables::pending:
+				{
+					nano::pending_key key;
+					nano::pending_info info;
+					if (key.deserialize (stream) || info.deserialize (stream))
+					{
+						return true;
+					}
+					store.pending.put (transaction, key, info);
+					break;
+				}
+				case nano::tables::pruned:
+				{
+					nano::block_hash hash;
+					nano::read (stream, hash);
+					store.pruned.put (transaction, hash);
+					break;
+				}
+				default:
+					return true;
+			}
+		}
+	}
+	catch (std::runtime_error const &)
+	{
+		return true;
+	}
+	// Trailing bytes mean the record count does not match the payload
+	return !nano::at_end (stream);
+}
+}
+
+bool nano::ledger_snapshot::write (nano::store::component & store, nano::networks network, std::filesystem::path const & path, uint64_t & records)
+{
+	records = 0;
+	snapshot_output output{ path };
+	if (!output.file)
+	{
+		return true;
+	}
+	{
+		std::vector<uint8_t> header;
+		{
+			nano::vectorstream stream{ header };
+			nano::write (stream, version);
+			nano::write_big_endian (stream, static_cast<uint16_t> (network));
+			nano::write_big_endian (stream, static_cast<int32_t> (store.version.get (store.tx_begin_read ())));
+		}
+		output.write (header);
+	}
+
+	store.account.for_each_par (
+	[&output] (nano::store::read_transaction const & /*unused*/, auto i, auto n) {
+		chunk_writer chunk{ output, nano::tables::accounts };
+		for (; i != n; ++i)
+		{
+			chunk.add ([&i] (nano::stream & stream) {
+				nano::write (stream, i->first);
+				i->second.serialize (stream);
+			});
+		}
+	});
+
+	store.block.for_each_par (
+	[&output] (nano::store::read_transaction const & /*unused*/, auto i, auto n) {
+		chunk_writer chunk{ output, nano::tables::blocks };
+		for (; i != n; ++i)
+		{
+			chunk.add ([&i] (nano::stream & stream) {
+				nano::write (stream, i->first);
+				nano::serialize_block (stream, *i->second.block);
+				i->second.sideband.serialize (stream, i->second.block->type ());
+			});
+		}
+	});
+
+	store.confirmation_height.for_each_par (
+	[&output] (nano::store::read_transaction const & /*unused*/, auto i, auto n) {
+		chunk_writer chunk{ output, nano::tables::confirmation_height };
+		for (; i != n; ++i)
+		{
+			chunk.add ([&i] (nano::stream & stream) {
+				nano::write (stream, i->first);
+				i->second.serialize (stream);
+			});
+		}
+	});
+
+	store.final_vote.for_each_par (
+	[&output] (nano::store::read_transaction const & /*unused*/, auto i, auto n) {
+		chunk_writer chunk{ output, nano::tables::final_votes };
+		for (; i != n; ++i)
+		{
+			chunk.add ([&i] (nano::stream & stream) {
+				nano::write (stream, i->first);
+				nano::write (stream, i->second);
+			});
+		}
+	});
+
+	store.frontier.for_each_par (
+	[&output] (nano::store::read_transaction const & /*unused*/, auto i, auto n) {
+		chunk_writer chunk{ output, nano::tables::frontiers };
+		for (; i != n; ++i)
+		{
+			chunk.add ([&i] (nano::stream & stream) {
+				nano::write (stream, i->first);
+				nano::write (stream, i->second);
+			});
+		}
+	});
+
+	store.pending.for_each_par (
+	[&output] (nano::store::read_transaction const & /*unused*/, auto i, auto n) {
+		chunk_writer chunk{ output, nano::tables::pending };
+		for (; i != n; ++i)
+		{
+			chunk.add ([&i] (nano::stream & stream) {
+				i->first.serialize (stream);
+				i->second.serialize (stream);
+			});
+		}
+	});
+
+	store.pruned.for_each_par (
+	[&output] (nano::store::read_transaction const & /*unused*/, auto i, auto n) {
+		chunk_writer chunk{ output, nano::tables::pruned };
+		for (; i != n; ++i)
+		{
+			chunk.add ([&i] (nano::stream & stream) {
+				nano::write (stream, i->first);
+			});
+		}
+	});
+
+	// Footer with record counts per table, used to detect missing chunks when restoring
+	std::vector<uint8_t> footer;
+	{
+		nano::vectorstream stream{ footer };
+		nano::write (stream, end_marker);
+		nano::write (stream, static_cast<uint8_t> (snapshot_tables.size ()));
+		for (auto table : snapshot_tables)
+		{
+			auto count = output.counts[table];
+			nano::write (stream, static_cast<uint8_t> (table));
+			nano::write_big_endian (stream, count);
+			records += count;
+		}
+	}
+	output.write (footer);
+	output.file.flush ();
+	return !output.file;
+}
+
+bool nano::ledger_snapshot::read (nano::store::component & store, nano::networks network, nano::ledger_constants & constants, std::filesystem::path const & path, unsigned threads, uint64_t & records)
+{
+	auto error = restore (store, network, path, threads, records);
+	if (error == restore_error::partial)
+	{
+		reset (store, constants);
+	}
+	return error != restore_error::none;
+}
+
+nano::ledger_snapshot::restore_error nano::ledger_snapshot::restore (nano::store::component & store, nano::networks network, std::filesystem::path const & path, unsigned threads, uint64_t & records)
+{
+	records = 0;
+	std::ifstream file (path, std::ios::binary);
+	std::array<uint8_t, sizeof (version) + sizeof (uint16_t) + sizeof (int32_t)> header{};
+	if (!file.read (reinterpret_cast<char *> (header.data ()), header.size ()))
+	{
+		return restore_error::refused;
+	}
+	{
+		nano::bufferstream stream{ header.data (), header.size () };
+		uint8_t version_l{ 0 };
+		uint16_t network_l{ 0 };
+		int32_t store_version{ 0 };
+		nano::read (stream, version_l);
+		nano::read_big_endian (stream, network_l);
+		nano::read_big_endian (stream, store_version);
+		auto transaction = store.tx_begin_read ();
+		// Only restore into a fresh ledger of the same database version, records are written as is
+		if (version_l != version || static_cast<nano::networks> (network_l) != network || store_version != store.version.get (transaction) || store.block.count (transaction) > 1)
+		{
+			return restore_error::refused;
+		}
+	}
+	// The indexes are derived from the accounts and pending tables, indexes built for the fresh ledger would miss the restored entries
+	{
+		auto transaction = store.tx_begin_write ({ nano::tables::delegators, nano::tables::receivable_amounts });
+		store.delegator.clear (transaction);
+		store.receivable_amount.clear (transaction);
+	}
+
+	std::atomic<bool> error{ false };
+	nano::mutex mutex;
+	nano::condition_variable condition;
+	std::size_t in_flight{ 0 };
+	std::unordered_map<nano::tables, uint64_t> restored;
+	// Declared after everything its tasks use so its threads are joined first
+	nano::thread_pool pool (std::max (threads, 1u), nano::thread_role::name::db_parallel_traversal);
+	// Bounds the memory used by chunks waiting for a thread
+	auto const max_in_flight = 2 * pool.get_num_threads ();
+	bool end = false;
+	while (!end && !error)
+	{
+		uint8_t table{ 0 };
+		if (!file.read (reinterpret_cast<char *> (&table), sizeof (table)))
+		{
+			error = true; // Truncated, the snapshot must end with a footer
+			break;
+		}
+		if (table == end_marker)
+		{
+			end = true;
+			break;
+		}
+		std::array<uint8_t, chunk_header_size> chunk_header{};
+		if (!is_snapshot_table (table) || !file.read (reinterpret_cast<char *> (chunk_header.data ()), chunk_header.size ()))
+		{
+			error = true;
+			break;
+		}
+		uint32_t chunk_records{ 0 };
+		uint32_t size{ 0 };
+		uint64_t expected_checksum{ 0 };
+		{
+			nano::bufferstream stream{ chunk_header.data (), chunk_header.size () };
+			nano::read_big_endian (stream, chunk_records);
+			nano::read_big_endian (stream, size);
+			nano::read_big_endian (stream, expected_checksum);
+		}
+		if (size > max_chunk_payload)
+		{
+			error = true;
+			break;
+		}
+		auto payload = std::make_shared<std::vector<uint8_t>> (size);
+		if (!file.read (reinterpret_cast<char *> (payload->data ()), size))
+		{
+			error = true;
+			break;
+		}
+		{
+			nano::unique_lock<nano::mutex> lock{ mutex };
+			condition.wait (lock, [&] () { return in_flight < max_in_flight; });
+			++in_flight;
+		}
+		pool.push_task ([&, table = static_cast<nano::tables> (table), payload, chunk_records, expected_checksum] () {
+			auto chunk_error = checksum (*payload) != expected_checksum || restore_chunk (store, table, *payload, chunk_records);
+			if (chunk_error)
+			{
+				error = true;
+			}
+			// Notified under the lock, the waiting thread may return and destroy the condition as soon as it sees the count drop
+			nano::lock_guard<nano::mutex> guard{ mutex };
+			restored[table] += chunk_records;
+			--in_flight;
+			condition.notify_all ();
+		});
+	}
+	{
+		nano::unique_lock<nano::mutex> lock{ mutex };
+		condition.wait (lock, [&] () { return in_flight == 0; });
+	}
+	if (!end || error)
+	{
+		return restore_error::partial;
+	}
+
+	// Compare the restored record counts with the ones the snapshot was written with
+	try
+	{
+		std::array<uint8_t, sizeof (uint8_t)> count_byte{};
+		file.read (reinterpret_cast<char *> (count_byte.data ()), count_byte.size ());
+		std::vector<uint8_t> footer (count_byte[0] * (sizeof (uint8_t) + sizeof (uint64_t)));
+		if (!file || !file.read (reinterpret_cast<char *> (footer.data ()), footer.size ()))
+		{
+			return restore_error::partial;
+		}
+		nano::bufferstream stream{ footer.data (), footer.size () };
+		for (auto i = 0; i < count_byte[0]; ++i)
+		{
+			uint8_t table{ 0 };
+			uint64_t count{ 0 };
+			nano::read (stream, table);
+			nano::read_big_endian (stream, count);
+			if (restored[static_cast<nano::tables> (table)] != count)
+			{
+				return restore_error::partial;
+			}
+			records += count;
+		}
+	}
+	catch (std::runtime_error const &)
+	{
+		return restore_error::partial;
+	}
+	return restore_error::none;
+}
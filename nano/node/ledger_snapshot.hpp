@@ -0,0 +1,56 @@
+#pragma once
+
+#include <nano/lib/config.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+
+namespace nano::store
+{
+class component;
+}
+
+namespace nano
+{
+class ledger_constants;
+
+/**
+ * Backend independent snapshot of the ledger tables: accounts, blocks with their sidebands, confirmation heights, final votes, frontiers, pending and pruned entries.
+ * Layout: header (version, network id, store version), chunks of records belonging to a single table and a footer with the number of records written per table.
+ * Each chunk carries its record count, payload size and checksum, so chunks can be written by parallel table traversals in any order and restored in parallel.
+ * Payloads are stored uncompressed, fixed size records keep them well suited to compressing the file as a whole.
+ */
+class ledger_snapshot final
+{
+public:
+	static uint8_t constexpr version = 1;
+	/** Chunks are flushed once their payload reaches this size */
+	static std::size_t constexpr chunk_size = 1024 * 1024;
+
+	/**
+	 * Writes all ledger tables of `store` to `path`, traversing each table on multiple threads
+	 * @return true on error
+	 */
+	static bool write (nano::store::component & store, nano::networks, std::filesystem::path const & path, uint64_t & records);
+
+	/**
+	 * Restores a snapshot into `store`, which must not contain anything besides genesis. Chunks are verified and written by `threads` threads.
+	 * A restore that fails part way empties the ledger tables again and writes back the genesis of `constants`.
+	 * @return true on error
+	 */
+	static bool read (nano::store::component & store, nano::networks, nano::ledger_constants & constants, std::filesystem::path const & path, unsigned threads, uint64_t & records);
+
+private:
+	enum class restore_error
+	{
+		none,
+		/** Nothing was written, the snapshot or the store did not qualify */
+		refused,
+		/** Some records may have been written */
+		partial
+	};
+
+	static restore_error restore (nano::store::component & store, nano::networks, std::filesystem::path const & path, unsigned threads, uint64_t & records);
+};
+}
@@ -1861,6 +1861,12 @@ std::string nano::asc_pull_ack::to_string () const
 				s += (*block)->to_json ();
 				++block;
 			}
+
+			nano::bufferstream stream{ arg.serialized_blocks.data (), arg.serialized_blocks.size () };
+			for (auto serialized = nano::deserialize_block (stream); serialized != nullptr; serialized = nano::deserialize_block (stream))
+			{
+				s += serialized->to_json ();
+			}
 		}
 
 		else if constexpr (std::is_same_v<T, nano::asc_pull_ack::account_info_payload>)
@@ -1884,12 +1890,16 @@ std::string nano::asc_pull_ack::to_string () const
 
 void nano::asc_pull_ack::blocks_payload::serialize (nano::stream & stream) const
 {
-	debug_assert (blocks.size () <= max_blocks);
+	debug_assert (size () <= max_blocks);
 	for (auto & block : blocks)
 	{
 		debug_assert (block != nullptr);
 		nano::serialize_block (stream, *block);
 	}
+	if (!serialized_blocks.empty ())
+	{
+		nano::write (stream, serialized_blocks);
+	}
 	// For convenience, end with null block terminator
 	nano::serialize_block_type (stream, nano::block_type::not_a_block);
 }
@@ -1904,6 +1914,11 @@ void nano::asc_pull_ack::blocks_payload::deserialize (nano::stream & stream)
 	}
 }
 
+std::size_t nano::asc_pull_ack::blocks_payload::size () const
+{
+	return blocks.size () + serialized_count;
+}
+
 /*
  * asc_pull_ack::account_info_payload
  */
@@ -520,8 +520,17 @@ public: // Payload definitions
 		void serialize (nano::stream &) const;
 		void deserialize (nano::stream &);
 
+		/** Number of blocks in the payload, in either representation */
+		std::size_t size () const;
+
 	public:
 		std::vector<std::shared_ptr<nano::block>> blocks{};
+		/**
+		 * Blocks already in network serialization, copied straight from the store by the bootstrap server to skip a deserialize / serialize roundtrip
+		 * Sent after `blocks`, deserialization always fills `blocks`
+		 */
+		std::vector<uint8_t> serialized_blocks{};
+		std::size_t serialized_count{ 0 };
 
 	public:
 		/* Header allows for 16 bit extensions; 65535 bytes / 500 bytes (block size with some future margin) ~ 131 */
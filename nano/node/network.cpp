@@ -7,6 +7,9 @@
 
 #include <boost/format.hpp>
 
+#include <cmath>
+#include <numeric>
+
 /*
  * network
  */
@@ -20,7 +23,7 @@ nano::network::network (nano::node & node_a, uint16_t port_a) :
 		process_message (message, channel);
 	} },
 	resolver (node_a.io_ctx),
-	tcp_message_manager (node_a.config.tcp_incoming_connections_max),
+	tcp_message_manager (node_a.stats, node_a.config.tcp_incoming_connections_max),
 	node (node_a),
 	publish_filter (256 * 1024),
 	tcp_channels (node_a, inbound),
@@ -143,6 +146,10 @@ void nano::network::flood_message (nano::message & message_a, nano::transport::b
 {
 	for (auto & i : list (fanout (scale_a)))
 	{
+		if (drop_policy_a == nano::transport::buffer_drop_policy::limiter && skip_congested (*i))
+		{
+			continue;
+		}
 		i->send (message_a, nullptr, drop_policy_a);
 	}
 }
@@ -185,10 +192,30 @@ void nano::network::flood_vote (std::shared_ptr<nano::vote> const & vote_a, floa
 	nano::confirm_ack message{ node.network_params.network, vote_a };
 	for (auto & i : list (fanout (scale)))
 	{
+		if (skip_congested (*i))
+		{
+			continue;
+		}
 		i->send (message, nullptr);
 	}
 }
 
+bool nano::network::skip_congested (nano::transport::channel & channel_a)
+{
+	if (!node.config.adaptive_flooding)
+	{
+		return false;
+	}
+	// Skip with a probability equal to the send queue occupancy, once the queue is full the socket would drop the message anyway
+	auto fill = channel_a.queue_fill ();
+	if (fill > 0.0 && nano::random_pool::generate_word32 (0, 999) < fill * 1000)
+	{
+		node.stats.inc (nano::stat::type::drop, nano::stat::detail::flood_congested, nano::stat::dir::out);
+		return true;
+	}
+	return false;
+}
+
 void nano::network::flood_vote_pr (std::shared_ptr<nano::vote> const & vote_a)
 {
 	nano::confirm_ack message{ node.network_params.network, vote_a };
@@ -510,6 +537,11 @@ public:
 
 	void asc_pull_ack (nano::asc_pull_ack const & message) override
 	{
+		// Responses to round trip probes sent along with telemetry requests are not bootstrap responses
+		if (channel->rtt_probe_end (message.id))
+		{
+			return;
+		}
 		node.ascendboot.process (message, channel);
 	}
 
@@ -522,6 +554,7 @@ private:
 void nano::network::process_message (nano::message const & message, std::shared_ptr<nano::transport::channel> const & channel)
 {
 	node.stats.inc (nano::stat::type::message, nano::to_stat_detail (message.header.type), nano::stat::dir::in);
+	channel->traffic.add (message.header.type, nano::stat::dir::in, nano::message_header::size + message.header.payload_length_bytes ());
 
 	network_message_visitor visitor (node, channel);
 	message.visit (visitor);
@@ -578,11 +611,7 @@ std::deque<std::shared_ptr<nano::transport::channel>> nano::network::list (std::
 {
 	std::deque<std::shared_ptr<nano::transport::channel>> result;
 	tcp_channels.list (result, minimum_version_a, include_tcp_temporary_channels_a);
-	nano::random_pool_shuffle (result.begin (), result.end ());
-	if (count_a > 0 && result.size () > count_a)
-	{
-		result.resize (count_a, nullptr);
-	}
+	select (result, count_a);
 	return result;
 }
 
@@ -590,14 +619,84 @@ std::deque<std::shared_ptr<nano::transport::channel>> nano::network::list_non_pr
 {
 	std::deque<std::shared_ptr<nano::transport::channel>> result;
 	tcp_channels.list (result);
-	nano::random_pool_shuffle (result.begin (), result.end ());
 	result.erase (std::remove_if (result.begin (), result.end (), [this] (std::shared_ptr<nano::transport::channel> const & channel) {
 		return this->node.rep_crawler.is_pr (*channel);
 	}),
 	result.end ());
-	if (result.size () > count_a)
+	select (result, count_a);
+	return result;
+}
+
+void nano::network::select (std::deque<std::shared_ptr<nano::transport::channel>> & channels_a, std::size_t count_a) const
+{
+	// Biasing only matters when some of the candidates get left out
+	if (node.config.peer_selection == nano::peer_selection_mode::latency && count_a > 0 && channels_a.size () > count_a)
+	{
+		auto keys = latency_weighted_keys (std::vector<std::shared_ptr<nano::transport::channel>> (channels_a.begin (), channels_a.end ()));
+		std::vector<std::size_t> order (channels_a.size ());
+		std::iota (order.begin (), order.end (), 0);
+		std::partial_sort (order.begin (), order.begin () + count_a, order.end (), [&keys] (std::size_t lhs, std::size_t rhs) {
+			return keys[lhs] > keys[rhs];
+		});
+		std::deque<std::shared_ptr<nano::transport::channel>> result;
+		for (auto i = order.begin (), n = order.begin () + count_a; i != n; ++i)
+		{
+			result.push_back (channels_a[*i]);
+		}
+		channels_a.swap (result);
+	}
+	else
+	{
+		nano::random_pool_shuffle (channels_a.begin (), channels_a.end ());
+		if (count_a > 0 && channels_a.size () > count_a)
+		{
+			channels_a.resize (count_a, nullptr);
+		}
+	}
+}
+
+namespace
+{
+/** Median of the non zero values, peers that have not been measured yet are treated as typical ones */
+uint64_t median_known (std::vector<uint64_t> values)
+{
+	std::erase (values, 0);
+	if (values.empty ())
 	{
-		result.resize (count_a, nullptr);
+		return 1;
+	}
+	std::nth_element (values.begin (), values.begin () + values.size () / 2, values.end ());
+	return values[values.size () / 2];
+}
+}
+
+std::vector<double> nano::network::latency_weighted_keys (std::vector<std::shared_ptr<nano::transport::channel>> const & channels_a)
+{
+	std::vector<uint64_t> rtts;
+	std::vector<uint64_t> throughputs;
+	for (auto const & channel : channels_a)
+	{
+		rtts.push_back (channel->get_rtt ().count ());
+		throughputs.push_back (channel->get_throughput ());
+	}
+	auto const median_rtt = median_known (rtts);
+	auto const median_throughput = median_known (throughputs);
+
+	// Weighted random sampling without replacement (Efraimidis & Spirakis): the key of each peer is ln(u) / weight for uniform u in (0, 1]
+	// Ordering by descending key picks peers with probability proportional to their weight while every peer keeps a chance
+	std::vector<double> result;
+	result.reserve (channels_a.size ());
+	for (std::size_t i = 0; i < channels_a.size (); ++i)
+	{
+		auto const rtt = rtts[i] > 0 ? rtts[i] : median_rtt;
+		auto const throughput = throughputs[i] > 0 ? throughputs[i] : median_throughput;
+		auto weight = std::clamp (static_cast<double> (median_rtt) / static_cast<double> (rtt) * static_cast<double> (throughput) / static_cast<double> (median_throughput), min_selection_weight, max_selection_weight);
+		if (channels_a[i]->max ())
+		{
+			weight *= congested_selection_penalty;
+		}
+		auto random = static_cast<double> (nano::random_pool::generate_word32 (1, std::numeric_limits<uint32_t>::max ())) / std::numeric_limits<uint32_t>::max ();
+		result.push_back (std::log (random) / weight);
 	}
 	return result;
 }
@@ -820,55 +919,92 @@ nano::node_id_handshake::response_payload nano::network::prepare_handshake_respo
  * tcp_message_manager
  */
 
-nano::tcp_message_manager::tcp_message_manager (unsigned incoming_connections_max_a) :
-	max_entries (incoming_connections_max_a * nano::tcp_message_manager::max_entries_per_connection + 1)
+nano::tcp_message_manager::tcp_message_manager (nano::stats & stats_a, unsigned incoming_connections_max_a) :
+	stats (stats_a),
+	max_entries (incoming_connections_max_a * nano::tcp_message_manager::max_entries_per_connection + 1),
+	entries (max_entries)
 {
 	debug_assert (max_entries > 0);
 }
 
-void nano::tcp_message_manager::put_message (nano::tcp_message_item const & item_a)
+bool nano::tcp_message_manager::put_message (nano::tcp_message_item const & item_a)
 {
+	if (stopped)
+	{
+		return false;
+	}
+	auto const & socket = item_a.socket;
+	// Reserve a slot from the peer's share before touching the shared queue
+	if (socket && socket->inbound.queued.fetch_add (1) >= max_entries_per_connection)
 	{
-		nano::unique_lock<nano::mutex> lock{ mutex };
-		while (entries.size () >= max_entries && !stopped)
+		socket->inbound.queued.fetch_sub (1);
+		socket->inbound.dropped.fetch_add (1);
+		stats.inc (nano::stat::type::tcp_message_manager, nano::stat::detail::peer_overfill);
+		return false;
+	}
+	nano::tcp_message_item item{ item_a };
+	if (entries.size () >= max_entries || !entries.try_push (item))
+	{
+		if (socket)
 		{
-			producer_condition.wait (lock);
+			socket->inbound.queued.fetch_sub (1);
+			socket->inbound.dropped.fetch_add (1);
 		}
-		entries.push_back (item_a);
+		stats.inc (nano::stat::type::tcp_message_manager, nano::stat::detail::overfill);
+		return false;
+	}
+	if (socket)
+	{
+		socket->inbound.enqueued.fetch_add (1);
 	}
-	consumer_condition.notify_one ();
+	stats.inc (nano::stat::type::tcp_message_manager, nano::stat::detail::queue);
+	available.release ();
+	return true;
 }
 
 nano::tcp_message_item nano::tcp_message_manager::get_message ()
 {
-	nano::tcp_message_item result;
-	nano::unique_lock<nano::mutex> lock{ mutex };
-	while (entries.empty () && !stopped)
-	{
-		consumer_condition.wait (lock);
-	}
-	if (!entries.empty ())
-	{
-		result = std::move (entries.front ());
-		entries.pop_front ();
-	}
-	else
+	available.acquire ();
+	if (!stopped)
 	{
-		result = nano::tcp_message_item{ nullptr, nano::tcp_endpoint (boost::asio::ip::address_v6::any (), 0), 0, nullptr };
+		// The token guarantees an entry has been published, but an earlier slot may still be in the middle of being written
+		while (true)
+		{
+			if (auto result = entries.try_pop ())
+			{
+				if (result->socket)
+				{
+					result->socket->inbound.queued.fetch_sub (1);
+				}
+				return std::move (*result);
+			}
+			std::this_thread::yield ();
+		}
 	}
-	lock.unlock ();
-	producer_condition.notify_one ();
-	return result;
+	// Wake up the next waiting consumer so that all of them observe the stop
+	available.release ();
+	return nano::tcp_message_item{ nullptr, nano::tcp_endpoint (boost::asio::ip::address_v6::any (), 0), 0, nullptr };
 }
 
 void nano::tcp_message_manager::stop ()
 {
+	if (!stopped.exchange (true))
 	{
-		nano::lock_guard<nano::mutex> lock{ mutex };
-		stopped = true;
+		available.release ();
 	}
-	consumer_condition.notify_all ();
-	producer_condition.notify_all ();
+}
+
+std::size_t nano::tcp_message_manager::size () const
+{
+	return entries.size ();
+}
+
+std::unique_ptr<nano::container_info_component> nano::tcp_message_manager::collect_container_info (std::string const & name)
+{
+	auto composite = std::make_unique<container_info_composite> (name);
+	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "entries", entries.size (), sizeof (nano::tcp_message_item) }));
+	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "capacity", entries.capacity (), sizeof (nano::tcp_message_item) }));
+	return composite;
 }
 
 /*
@@ -989,6 +1125,7 @@ std::unique_ptr<nano::container_info_component> nano::collect_container_info (ne
 	composite->add_component (network.tcp_channels.collect_container_info ("tcp_channels"));
 	composite->add_component (network.syn_cookies.collect_container_info ("syn_cookies"));
 	composite->add_component (network.excluded_peers.collect_container_info ("excluded_peers"));
+	composite->add_component (network.tcp_message_manager.collect_container_info ("tcp_message_manager"));
 	return composite;
 }
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <nano/lib/mpmc_queue.hpp>
 #include <nano/node/common.hpp>
 #include <nano/node/peer_exclusion.hpp>
 #include <nano/node/transport/tcp.hpp>
@@ -9,29 +10,43 @@
 
 #include <deque>
 #include <memory>
+#include <semaphore>
 #include <unordered_set>
 
 namespace nano
 {
 class node;
 
+/**
+ * Queue of deserialized realtime messages waiting to be processed by `tcp_channels::process_messages`
+ * Backed by a bounded lock-free ring, producers (socket read handlers) never block and instead drop messages when either
+ * the queue or the sending peer's share of it is full. Each peer can occupy at most `max_entries_per_connection` slots,
+ * so a single chatty peer cannot crowd out the others.
+ */
 class tcp_message_manager final
 {
 public:
-	tcp_message_manager (unsigned incoming_connections_max_a);
-	void put_message (nano::tcp_message_item const & item_a);
+	tcp_message_manager (nano::stats &, unsigned incoming_connections_max_a);
+	/** @return true if the message was queued, false if it was dropped */
+	bool put_message (nano::tcp_message_item const & item_a);
+	/** Blocks until a message is available or the manager is stopped, in which case an item with null message is returned */
 	nano::tcp_message_item get_message ();
 	// Stop container and notify waiting threads
 	void stop ();
+	std::size_t size () const;
+
+	std::unique_ptr<container_info_component> collect_container_info (std::string const & name);
 
 private:
-	nano::mutex mutex;
-	nano::condition_variable producer_condition;
-	nano::condition_variable consumer_condition;
-	std::deque<nano::tcp_message_item> entries;
-	unsigned max_entries;
+	nano::stats & stats;
+	unsigned const max_entries;
+	nano::mpmc_queue<nano::tcp_message_item> entries;
+	/** Counts queued entries, consumers sleep on it so that producers only need a non-blocking release */
+	std::counting_semaphore<> available{ 0 };
+	std::atomic<bool> stopped{ false };
+
+public:
 	static unsigned const max_entries_per_connection = 16;
-	bool stopped{ false };
 
 	friend class network_tcp_message_manager_Test;
 };
@@ -108,6 +123,11 @@ public:
 	std::deque<std::shared_ptr<nano::transport::channel>> list_non_pr (std::size_t);
 	// Desired fanout for a given scale
 	std::size_t fanout (float scale = 1.0f) const;
+	/**
+	 * Random sort keys for the given channels, peers with higher keys should be preferred.
+	 * Keys are biased towards low round trip time, high inbound throughput and uncongested send queues while every peer keeps a chance of being picked.
+	 */
+	static std::vector<double> latency_weighted_keys (std::vector<std::shared_ptr<nano::transport::channel>> const &);
 	void random_fill (std::array<nano::endpoint, 8> &) const;
 	void fill_keepalive_self (std::array<nano::endpoint, 8> &) const;
 	// Note: The minimum protocol version is used after the random selection, so number of peers can be less than expected.
@@ -137,6 +157,10 @@ public:
 
 private:
 	void process_message (nano::message const &, std::shared_ptr<nano::transport::channel> const &);
+	/** Adaptive flooding: randomly leaves out peers in proportion to how full their send queue is */
+	bool skip_congested (nano::transport::channel &);
+	/** Reduces `channels_a` to at most `count_a` peers (0 for all) in random order, according to the configured peer selection mode */
+	void select (std::deque<std::shared_ptr<nano::transport::channel>> & channels_a, std::size_t count_a) const;
 
 public:
 	std::function<void (nano::message const &, std::shared_ptr<nano::transport::channel> const &)> inbound;
@@ -156,6 +180,11 @@ public:
 	static std::size_t const buffer_size = 512;
 	static std::size_t const confirm_req_hashes_max = 7;
 	static std::size_t const confirm_ack_hashes_max = 12;
+	/** Bounds on how strongly round trip time and throughput can favour or penalise a peer relative to the median one */
+	static double constexpr min_selection_weight = 0.1;
+	static double constexpr max_selection_weight = 10.0;
+	/** Weight multiplier for peers whose send queue is full */
+	static double constexpr congested_selection_penalty = 0.1;
 };
 std::unique_ptr<container_info_component> collect_container_info (network & network, std::string const & name);
 }
@@ -149,9 +149,9 @@ nano::node::node (boost::asio::io_context & io_ctx_a, std::filesystem::path cons
 	work (work_a),
 	distributed_work (*this),
 	logger (config_a.logging.min_time_between_log_output),
-	store_impl (nano::make_store (logger, application_path_a, network_params.ledger, flags.read_only, true, config_a.rocksdb_config, config_a.diagnostics_config.txn_tracking, config_a.block_processor_batch_max_time, config_a.lmdb_config, config_a.backup_before_upgrade)),
+	store_impl (nano::make_store (logger, application_path_a, network_params.ledger, flags.read_only, true, config_a.rocksdb_config, config_a.diagnostics_config.txn_tracking, config_a.block_processor_batch_max_time, config_a.lmdb_config, config_a.backup_before_upgrade, flags.memory_store)),
 	store (*store_impl),
-	unchecked{ stats, flags.disable_block_processor_unchecked_deletion },
+	unchecked{ stats, flags.disable_block_processor_unchecked_deletion, application_path_a / "unchecked.spill", flags.read_only || flags.inactive_node ? 0 : config_a.unchecked_spill_max },
 	wallets_store_impl (std::make_unique<nano::mdb_wallets_store> (application_path_a / "wallets.ldb", config_a.lmdb_config)),
 	wallets_store (*wallets_store_impl),
 	gap_cache (*this),
@@ -164,7 +164,8 @@ nano::node::node (boost::asio::io_context & io_ctx_a, std::filesystem::path cons
 	network (*this, config.peering_port.has_value () ? *config.peering_port : 0),
 	telemetry{ nano::telemetry::config{ config, flags }, *this, network, observers, network_params, stats },
 	bootstrap_initiator (*this),
-	bootstrap_server{ store, ledger, network_params.network, stats },
+	bootstrap_server{ config.bootstrap_server, store, ledger, network_params.network, stats },
+	rpc_read_executor{ config.rpc_read_executor, stats },
 	// BEWARE: `bootstrap` takes `network.port` instead of `config.peering_port` because when the user doesn't specify
 	//         a peering port and wants the OS to pick one, the picking happens when `network` gets initialized
 	//         (if UDP is active, otherwise it happens when `bootstrap` gets initialized), so then for TCP traffic
@@ -192,7 +193,7 @@ nano::node::node (boost::asio::io_context & io_ctx_a, std::filesystem::path cons
 	aggregator (config, stats, generator, final_generator, history, ledger, wallets, active),
 	wallets (wallets_store.init_error (), *this),
 	backlog{ nano::backlog_population_config (config), store, stats },
-	ascendboot{ config, block_processor, ledger, network, stats },
+	ascendboot{ config, block_processor, ledger, network, stats, application_path_a },
 	websocket{ config.websocket_config, observers, wallets, ledger, io_ctx, logger },
 	epoch_upgrader{ *this, ledger, store, network_params, logger },
 	startup_time (std::chrono::steady_clock::now ()),
@@ -202,6 +203,7 @@ nano::node::node (boost::asio::io_context & io_ctx_a, std::filesystem::path cons
 	gap_tracker{ gap_cache },
 	process_live_dispatcher{ ledger, scheduler.priority, vote_cache, websocket }
 {
+	store.instrumentation.enable (flags.store_instrumentation);
 	block_broadcast.connect (block_processor);
 	block_publisher.connect (block_processor);
 	gap_tracker.connect (block_processor);
@@ -456,6 +458,27 @@ nano::node::node (boost::asio::io_context & io_ctx_a, std::filesystem::path cons
 				std::exit (1);
 			}
 		}
+
+		if (flags.inactive_node || flags.read_only)
+		{
+			// Keep an existing index up to date, building or removing it is left to the node
+			auto transaction (store.tx_begin_read ());
+			ledger.delegators_index = store.delegator.begin (transaction) != store.delegator.end ();
+			ledger.receivable_index = store.receivable_amount.begin (transaction) != store.receivable_amount.end ();
+		}
+		else
+		{
+			auto const built = ledger.delegators_index_set (flags.enable_delegators_index);
+			if (built > 0)
+			{
+				logger.always_log (boost::str (boost::format ("Built delegators index for %1% accounts") % built));
+			}
+			auto const built_receivable = ledger.receivable_index_set (flags.enable_receivable_index);
+			if (built_receivable > 0)
+			{
+				logger.always_log (boost::str (boost::format ("Built receivable amount index for %1% receivable entries") % built_receivable));
+			}
+		}
 	}
 	node_initialized_latch.count_down ();
 }
@@ -576,6 +599,8 @@ std::unique_ptr<nano::container_info_component> nano::collect_container_info (no
 	composite->add_component (collect_container_info (node.generator, "vote_generator"));
 	composite->add_component (collect_container_info (node.final_generator, "vote_generator_final"));
 	composite->add_component (node.ascendboot.collect_container_info ("bootstrap_ascending"));
+	composite->add_component (node.bootstrap_server.collect_container_info ("bootstrap_server"));
+	composite->add_component (node.rpc_read_executor.collect_container_info ("rpc_read_executor"));
 	composite->add_component (node.unchecked.collect_container_info ("unchecked"));
 	return composite;
 }
@@ -593,7 +618,7 @@ void nano::node::process_active (std::shared_ptr<nano::block> const & incoming)
 
 nano::process_return nano::node::process (nano::block & block)
 {
-	auto const transaction = store.tx_begin_write ({ tables::accounts, tables::blocks, tables::frontiers, tables::pending });
+	auto const transaction = store.tx_begin_write ({ tables::accounts, tables::blocks, tables::delegators, tables::frontiers, tables::pending, tables::receivable_amounts });
 	return process (transaction, block);
 }
 
@@ -643,6 +668,10 @@ void nano::node::start ()
 	ongoing_rep_calculation ();
 	ongoing_peer_store ();
 	ongoing_online_weight_calculation_queue ();
+	if (flags.store_instrumentation)
+	{
+		ongoing_store_instrumentation_flush ();
+	}
 
 	bool tcp_enabled = false;
 	if (config.tcp_incoming_connections_max > 0 && !(flags.disable_bootstrap_listener && flags.disable_tcp_realtime))
@@ -725,6 +754,7 @@ void nano::node::stop ()
 	telemetry.stop ();
 	websocket.stop ();
 	bootstrap_server.stop ();
+	rpc_read_executor.stop ();
 	bootstrap_initiator.stop ();
 	tcp_listener.stop ();
 	port_mapping.stop ();
@@ -901,6 +931,18 @@ void nano::node::ongoing_peer_store ()
 	});
 }
 
+void nano::node::ongoing_store_instrumentation_flush ()
+{
+	store.instrumentation.flush (stats);
+	std::weak_ptr<nano::node> node_w (shared_from_this ());
+	workers.add_timed_task (std::chrono::steady_clock::now () + std::chrono::seconds (1), [node_w] () {
+		if (auto node_l = node_w.lock ())
+		{
+			node_l->ongoing_store_instrumentation_flush ();
+		}
+	});
+}
+
 void nano::node::backup_wallet ()
 {
 	auto transaction (wallets.tx_begin_read ());
@@ -964,15 +1006,15 @@ void nano::node::unchecked_cleanup ()
 	if (ledger.cache.block_count >= ledger.bootstrap_weight_max_blocks && !long_attempt)
 	{
 		auto const now (nano::seconds_since_epoch ());
-		auto const transaction (store.tx_begin_read ());
 		// Max 1M records to clean, max 2 minutes reading to prevent slow i/o systems issues
-		unchecked.for_each (
-		[this, &digests, &cleaning_list, &now] (nano::unchecked_key const & key, nano::unchecked_info const & info) {
+		for (auto const & [key, info] : unchecked.list (1024 * 1024))
+		{
 			if ((now - info.modified ()) > static_cast<uint64_t> (config.unchecked_cutoff_time.count ()))
 			{
 				digests.push_back (network.publish_filter.hash (info.block));
 				cleaning_list.push_back (key);
-			} }, [iterations = 0, count = 1024 * 1024] () mutable { return iterations++ < count; });
+			}
+		}
 	}
 	if (!cleaning_list.empty ())
 	{
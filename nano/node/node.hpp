@@ -28,6 +28,7 @@
 #include <nano/node/portmapping.hpp>
 #include <nano/node/process_live_dispatcher.hpp>
 #include <nano/node/repcrawler.hpp>
+#include <nano/node/rpc_read_executor.hpp>
 #include <nano/node/request_aggregator.hpp>
 #include <nano/node/signatures.hpp>
 #include <nano/node/telemetry.hpp>
@@ -101,6 +102,8 @@ public:
 	void ongoing_rep_calculation ();
 	void ongoing_bootstrap ();
 	void ongoing_peer_store ();
+	/** Copies the store operation counters into stats every second */
+	void ongoing_store_instrumentation_flush ();
 	void ongoing_unchecked_cleanup ();
 	void backup_wallet ();
 	void search_receivable_all ();
@@ -165,6 +168,7 @@ public:
 	nano::telemetry telemetry;
 	nano::bootstrap_initiator bootstrap_initiator;
 	nano::bootstrap_server bootstrap_server;
+	nano::rpc_read_executor rpc_read_executor;
 	nano::transport::tcp_listener tcp_listener;
 	std::filesystem::path application_path;
 	nano::node_observers observers;
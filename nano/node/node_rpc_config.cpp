@@ -7,6 +7,8 @@
 nano::error nano::node_rpc_config::serialize_toml (nano::tomlconfig & toml) const
 {
 	toml.put ("enable_sign_hash", enable_sign_hash, "Allow or disallow signing of hashes.\ntype:bool");
+	toml.put ("max_batch_size", max_batch_size, "Maximum number of actions in a batch request received from the RPC server or an IPC client.\ntype:uint32");
+	toml.put ("max_listing_count", max_listing_count, "Maximum number of entries returned by one ledger, frontiers, unopened, delegators or wallet_history request, whether or not it sets a count. Larger listings return a cursor to continue from.\ntype:uint32");
 
 	nano::tomlconfig child_process_l;
 	child_process_l.put ("enable", child_process.enable, "Enable or disable RPC child process. If false, an in-process RPC server is used.\ntype:bool");
@@ -19,6 +21,8 @@ nano::error nano::node_rpc_config::deserialize_toml (nano::tomlconfig & toml)
 {
 	toml.get_optional ("enable_sign_hash", enable_sign_hash);
 	toml.get_optional<bool> ("enable_sign_hash", enable_sign_hash);
+	toml.get_optional<uint32_t> ("max_batch_size", max_batch_size);
+	toml.get_optional<uint32_t> ("max_listing_count", max_listing_count);
 
 	auto child_process_l (toml.get_optional_child ("child_process"));
 	if (child_process_l)
@@ -4,6 +4,7 @@
 
 #include <boost/property_tree/ptree_fwd.hpp>
 
+#include <cstdint>
 #include <string>
 
 namespace nano
@@ -23,6 +24,10 @@ public:
 	nano::error deserialize_toml (nano::tomlconfig & toml);
 
 	bool enable_sign_hash{ false };
+	/** Maximum number of actions in a batch request, applied to IPC clients as well as the RPC server */
+	uint32_t max_batch_size{ 1024 };
+	/** Maximum number of entries in a response of a listing action, larger listings are continued through their cursor */
+	uint32_t max_listing_count{ 65536 };
 	nano::rpc_child_process_config child_process;
 
 	// Used in tests to ensure requests are modified in specific cases
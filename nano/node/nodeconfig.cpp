@@ -109,6 +109,7 @@ nano::error nano::node_config::serialize_toml (nano::tomlconfig & toml) const
 	toml.put ("vote_generator_delay", vote_generator_delay.count (), "Delay before votes are sent to allow for efficient bundling of hashes in votes.\ntype:milliseconds");
 	toml.put ("vote_generator_threshold", vote_generator_threshold, "Number of bundled hashes required for an additional generator delay.\ntype:uint64,[1..11]");
 	toml.put ("unchecked_cutoff_time", unchecked_cutoff_time.count (), "Number of seconds before deleting an unchecked entry.\nWarning: lower values (e.g., 3600 seconds, or 1 hour) may result in unsuccessful bootstraps, especially a bootstrap from scratch.\ntype:seconds");
+	toml.put ("unchecked_spill_max", unchecked_spill_max, "Maximum number of unchecked blocks moved to disk once the in memory limit is reached, avoiding downloading them again when their dependencies arrive. 0 drops them instead.\ntype:uint64");
 	toml.put ("tcp_io_timeout", tcp_io_timeout.count (), "Timeout for TCP connect-, read- and write operations.\nWarning: a low value (e.g., below 5 seconds) may result in TCP connections failing.\ntype:seconds");
 	toml.put ("pow_sleep_interval", pow_sleep_interval.count (), "Time to sleep between batch work generation attempts. Reduces max CPU usage at the expense of a longer generation time.\ntype:nanoseconds");
 	toml.put ("external_address", external_address, "The external address of this node (NAT). If not set, the node will request this information via UPnP.\ntype:string,ip");
@@ -124,10 +125,15 @@ nano::error nano::node_config::serialize_toml (nano::tomlconfig & toml) const
 	toml.put ("bootstrap_bandwidth_limit", bootstrap_bandwidth_limit, "Outbound bootstrap traffic limit in bytes/sec after which messages will be dropped.\nNote: changing to unlimited bandwidth (0) is not recommended for limited connections.\ntype:uint64");
 	toml.put ("bootstrap_bandwidth_burst_ratio", bootstrap_bandwidth_burst_ratio, "Burst ratio for outbound bootstrap traffic.\ntype:double");
 
+	toml.put ("peer_bandwidth_limit", peer_bandwidth_limit, "Outbound traffic limit for each individual peer in bytes/sec, applied in addition to bandwidth_limit. 0 for unlimited.\ntype:uint64");
+	toml.put ("peer_bandwidth_burst_ratio", peer_bandwidth_burst_ratio, "Burst ratio for per peer outbound traffic shaping.\ntype:double");
+	toml.put ("adaptive_flooding", adaptive_flooding, "Send less flood traffic to peers whose send queue is filling up, instead of letting their queue drop it.\ntype:bool");
+
 	toml.put ("conf_height_processor_batch_min_time", conf_height_processor_batch_min_time.count (), "Minimum write batching time when there are blocks pending confirmation height.\ntype:milliseconds");
 	toml.put ("backup_before_upgrade", backup_before_upgrade, "Backup the ledger database before performing upgrades.\nWarning: uses more disk storage and increases startup time when upgrading.\ntype:bool");
 	toml.put ("max_work_generate_multiplier", max_work_generate_multiplier, "Maximum allowed difficulty multiplier for work generation.\ntype:double,[1..]");
 	toml.put ("frontiers_confirmation", serialize_frontiers_confirmation (frontiers_confirmation), "Mode controlling frontier confirmation rate.\ntype:string,{auto,always,disabled}");
+	toml.put ("peer_selection", serialize_peer_selection (peer_selection), "Strategy for choosing peers to flood to and the order in which representatives are asked for votes. Latency keeps the choice random but favours peers with low round trip time and free send queues.\ntype:string,{latency,random}");
 	toml.put ("max_queued_requests", max_queued_requests, "Limit for number of queued confirmation requests for one channel, after which new requests are dropped until the queue drops below this value.\ntype:uint32");
 	toml.put ("rep_crawler_weight_minimum", rep_crawler_weight_minimum.to_string_dec (), "Rep crawler minimum weight, if this is less than minimum principal weight then this is taken as the minimum weight a rep must have to be tracked. If you want to track all reps set this to 0. If you do not want this to influence anything then set it to max value. This is only useful for debugging or for people who really know what they are doing.\ntype:string,amount,raw");
 	toml.put ("backlog_scan_batch_size", backlog_scan_batch_size, "Number of accounts per second to process when doing backlog population scan. Increasing this value will help unconfirmed frontiers get into election prioritization queue faster, however it will also increase resource usage. \ntype:uint");
@@ -208,6 +214,14 @@ nano::error nano::node_config::serialize_toml (nano::tomlconfig & toml) const
 	vote_cache.serialize (vote_cache_l);
 	toml.put_child ("vote_cache", vote_cache_l);
 
+	nano::tomlconfig bootstrap_server_l;
+	bootstrap_server.serialize (bootstrap_server_l);
+	toml.put_child ("bootstrap_server", bootstrap_server_l);
+
+	nano::tomlconfig rpc_read_executor_l;
+	rpc_read_executor.serialize (rpc_read_executor_l);
+	toml.put_child ("rpc_read_executor", rpc_read_executor_l);
+
 	return toml.get_error ();
 }
 
@@ -283,6 +297,18 @@ nano::error nano::node_config::deserialize_toml (nano::tomlconfig & toml)
 			vote_cache.deserialize (config_l);
 		}
 
+		if (toml.has_key ("bootstrap_server"))
+		{
+			auto config_l = toml.get_required_child ("bootstrap_server");
+			bootstrap_server.deserialize (config_l);
+		}
+
+		if (toml.has_key ("rpc_read_executor"))
+		{
+			auto config_l = toml.get_required_child ("rpc_read_executor");
+			rpc_read_executor.deserialize (config_l);
+		}
+
 		if (toml.has_key ("work_peers"))
 		{
 			work_peers.clear ();
@@ -365,6 +391,8 @@ nano::error nano::node_config::deserialize_toml (nano::tomlconfig & toml)
 		toml.get ("unchecked_cutoff_time", unchecked_cutoff_time_l);
 		unchecked_cutoff_time = std::chrono::seconds (unchecked_cutoff_time_l);
 
+		toml.get<std::size_t> ("unchecked_spill_max", unchecked_spill_max);
+
 		auto tcp_io_timeout_l = static_cast<unsigned long> (tcp_io_timeout.count ());
 		toml.get ("tcp_io_timeout", tcp_io_timeout_l);
 		tcp_io_timeout = std::chrono::seconds (tcp_io_timeout_l);
@@ -415,6 +443,9 @@ nano::error nano::node_config::deserialize_toml (nano::tomlconfig & toml)
 
 		toml.get<std::size_t> ("bootstrap_bandwidth_limit", bootstrap_bandwidth_limit);
 		toml.get<double> ("bootstrap_bandwidth_burst_ratio", bootstrap_bandwidth_burst_ratio);
+		toml.get<std::size_t> ("peer_bandwidth_limit", peer_bandwidth_limit);
+		toml.get<double> ("peer_bandwidth_burst_ratio", peer_bandwidth_burst_ratio);
+		toml.get<bool> ("adaptive_flooding", adaptive_flooding);
 
 		toml.get<bool> ("backup_before_upgrade", backup_before_upgrade);
 
@@ -442,6 +473,12 @@ nano::error nano::node_config::deserialize_toml (nano::tomlconfig & toml)
 			frontiers_confirmation = deserialize_frontiers_confirmation (frontiers_confirmation_l);
 		}
 
+		if (toml.has_key ("peer_selection"))
+		{
+			auto peer_selection_l (toml.get<std::string> ("peer_selection"));
+			peer_selection = deserialize_peer_selection (peer_selection_l);
+		}
+
 		toml.get<unsigned> ("backlog_scan_batch_size", backlog_scan_batch_size);
 		toml.get<unsigned> ("backlog_scan_frequency", backlog_scan_frequency);
 
@@ -489,6 +526,10 @@ nano::error nano::node_config::deserialize_toml (nano::tomlconfig & toml)
 		{
 			toml.get_error ().set ("frontiers_confirmation value is invalid (available: always, auto, disabled)");
 		}
+		if (peer_selection == nano::peer_selection_mode::invalid)
+		{
+			toml.get_error ().set ("peer_selection value is invalid (available: latency, random)");
+		}
 		if (block_processor_batch_max_time < network_params.node.process_confirmed_interval)
 		{
 			toml.get_error ().set ((boost::format ("block_processor_batch_max_time value must be equal or larger than %1%ms") % network_params.node.process_confirmed_interval.count ()).str ());
@@ -545,6 +586,35 @@ nano::frontiers_confirmation_mode nano::node_config::deserialize_frontiers_confi
 	}
 }
 
+std::string nano::node_config::serialize_peer_selection (nano::peer_selection_mode mode_a) const
+{
+	switch (mode_a)
+	{
+		case nano::peer_selection_mode::random:
+			return "random";
+		case nano::peer_selection_mode::latency:
+			return "latency";
+		default:
+			return "latency";
+	}
+}
+
+nano::peer_selection_mode nano::node_config::deserialize_peer_selection (std::string const & string_a)
+{
+	if (string_a == "random")
+	{
+		return nano::peer_selection_mode::random;
+	}
+	else if (string_a == "latency")
+	{
+		return nano::peer_selection_mode::latency;
+	}
+	else
+	{
+		return nano::peer_selection_mode::invalid;
+	}
+}
+
 void nano::node_config::deserialize_address (std::string const & entry_a, std::vector<std::pair<std::string, uint16_t>> & container_a) const
 {
 	auto port_position (entry_a.rfind (':'));
@@ -10,6 +10,7 @@
 #include <nano/node/bootstrap/bootstrap_config.hpp>
 #include <nano/node/ipc/ipc_config.hpp>
 #include <nano/node/logging.hpp>
+#include <nano/node/rpc_read_executor.hpp>
 #include <nano/node/scheduler/hinted.hpp>
 #include <nano/node/scheduler/optimistic.hpp>
 #include <nano/node/vote_cache.hpp>
@@ -32,6 +33,13 @@ enum class frontiers_confirmation_mode : uint8_t
 	invalid
 };
 
+enum class peer_selection_mode : uint8_t
+{
+	random, // Uniformly random choice of peers
+	latency, // Random choice biased towards peers with low round trip time and uncongested send queues
+	invalid
+};
+
 /**
  * Node configuration
  */
@@ -90,6 +98,8 @@ public:
 	/** Time to wait for block processing result */
 	std::chrono::seconds block_process_timeout{ 15 };
 	std::chrono::seconds unchecked_cutoff_time{ std::chrono::seconds (4 * 60 * 60) }; // 4 hours
+	/** Unchecked blocks evicted from memory kept in a file in the data directory, 0 drops them instead */
+	std::size_t unchecked_spill_max{ 1024 * 1024 };
 	/** Timeout for initiated async operations */
 	std::chrono::seconds tcp_io_timeout{ (network_params.network.is_dev_network () && !is_sanitizer_build ()) ? std::chrono::seconds (5) : std::chrono::seconds (15) };
 	std::chrono::nanoseconds pow_sleep_interval{ 0 };
@@ -111,6 +121,11 @@ public:
 	std::size_t bootstrap_bandwidth_limit{ 5 * 1024 * 1024 };
 	/** Bootstrap traffic does not need bursts */
 	double bootstrap_bandwidth_burst_ratio{ 1. };
+	/** Outbound traffic limit for each individual peer in bytes/sec, 0 for unlimited */
+	std::size_t peer_bandwidth_limit{ 0 };
+	double peer_bandwidth_burst_ratio{ 3. };
+	/** Send less flood traffic to peers whose send queue is filling up, instead of having their socket drop it */
+	bool adaptive_flooding{ true };
 	nano::bootstrap_ascending_config bootstrap_ascending;
 	std::chrono::milliseconds conf_height_processor_batch_min_time{ 50 };
 	bool backup_before_upgrade{ false };
@@ -121,15 +136,21 @@ public:
 	nano::rocksdb_config rocksdb_config;
 	nano::lmdb_config lmdb_config;
 	nano::frontiers_confirmation_mode frontiers_confirmation{ nano::frontiers_confirmation_mode::automatic };
+	/** How peers are chosen when flooding and when ordering representatives for confirmation requests */
+	nano::peer_selection_mode peer_selection{ nano::peer_selection_mode::latency };
 	/** Number of accounts per second to process when doing backlog population scan */
 	unsigned backlog_scan_batch_size{ 10 * 1000 };
 	/** Number of times per second to run backlog population batches. Number of accounts per single batch is `backlog_scan_batch_size / backlog_scan_frequency` */
 	unsigned backlog_scan_frequency{ 10 };
 	nano::vote_cache_config vote_cache;
+	nano::bootstrap_server_config bootstrap_server;
+	nano::rpc_read_executor_config rpc_read_executor;
 
 public:
 	std::string serialize_frontiers_confirmation (nano::frontiers_confirmation_mode) const;
 	nano::frontiers_confirmation_mode deserialize_frontiers_confirmation (std::string const &);
+	std::string serialize_peer_selection (nano::peer_selection_mode) const;
+	nano::peer_selection_mode deserialize_peer_selection (std::string const &);
 	/** Entry is ignored if it cannot be parsed as a valid address:port */
 	void deserialize_address (std::string const &, std::vector<std::pair<std::string, uint16_t>> &) const;
 };
@@ -164,8 +185,16 @@ public:
 	bool force_use_write_database_queue{ false }; // For testing only. RocksDB does not use the database queue, but some tests rely on it being used.
 	bool disable_search_pending{ false }; // For testing only
 	bool enable_pruning{ false };
+	/** Maintain the representative to delegators index used by the `delegators` and `delegators_count` RPCs */
+	bool enable_delegators_index{ false };
+	/** Maintain the receivable amount index used by sorted `receivable`, `accounts_receivable` and `wallet_receivable` RPCs */
+	bool enable_receivable_index{ false };
 	bool fast_bootstrap{ false };
 	bool read_only{ false };
+	/** Keep the ledger in memory only, nothing is written to or read from the data directory */
+	bool memory_store{ false };
+	/** Record count, value bytes and latency of every store operation per table, see the `stats` RPC with type `store` */
+	bool store_instrumentation{ false };
 	bool disable_connection_cleanup{ false };
 	nano::confirmation_height_mode confirmation_height_processor_mode{ nano::confirmation_height_mode::automatic };
 	nano::generate_cache generate_cache;
@@ -0,0 +1,121 @@
+#include <nano/lib/stats.hpp>
+#include <nano/lib/tomlconfig.hpp>
+#include <nano/lib/utility.hpp>
+#include <nano/node/rpc_read_executor.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <unordered_map>
+
+namespace
+{
+/** Actions which only read the ledger, aliases share the stat detail of the action they alias */
+std::unordered_map<std::string, nano::stat::detail> const read_only_actions{
+	{ "account_balance", nano::stat::detail::account_balance },
+	{ "account_block_count", nano::stat::detail::account_block_count },
+	{ "account_history", nano::stat::detail::account_history },
+	{ "account_info", nano::stat::detail::account_info },
+	{ "accounts_balances", nano::stat::detail::accounts_balances },
+	{ "accounts_frontiers", nano::stat::detail::accounts_frontiers },
+	{ "accounts_pending", nano::stat::detail::accounts_receivable },
+	{ "accounts_receivable", nano::stat::detail::accounts_receivable },
+	{ "block_account", nano::stat::detail::block_account },
+	{ "block_info", nano::stat::detail::block_info },
+	{ "blocks", nano::stat::detail::blocks },
+	{ "blocks_info", nano::stat::detail::blocks_info },
+	{ "delegators", nano::stat::detail::delegators },
+	{ "delegators_count", nano::stat::detail::delegators_count },
+	{ "frontiers", nano::stat::detail::frontiers },
+	{ "ledger", nano::stat::detail::ledger },
+	{ "pending", nano::stat::detail::receivable },
+	{ "pending_exists", nano::stat::detail::receivable_exists },
+	{ "receivable", nano::stat::detail::receivable },
+	{ "receivable_exists", nano::stat::detail::receivable_exists },
+	{ "representatives", nano::stat::detail::representatives },
+	{ "unopened", nano::stat::detail::unopened },
+};
+}
+
+nano::rpc_read_executor::rpc_read_executor (nano::rpc_read_executor_config const & config_a, nano::stats & stats_a) :
+	config{ config_a },
+	stats{ stats_a },
+	workers{ static_cast<unsigned> (std::max<std::size_t> (config.threads, 1)), nano::thread_role::name::rpc_read }
+{
+	// Microseconds, logarithmic bins
+	stats.define_histogram (nano::stat::type::rpc_read, nano::stat::detail::queue_time, nano::stat::dir::in, { 0, 10, 100, 1000, 10000, 100000, 1000000, 10000000 });
+	for (auto const & [action, detail] : read_only_actions)
+	{
+		// Aliases define the same histogram again before anything is recorded
+		stats.define_histogram (nano::stat::type::rpc_read, detail, nano::stat::dir::out, { 0, 10, 100, 1000, 10000, 100000, 1000000, 10000000 });
+	}
+	// Batches of read only actions run as one task
+	stats.define_histogram (nano::stat::type::rpc_read, nano::stat::detail::batch, nano::stat::dir::out, { 0, 10, 100, 1000, 10000, 100000, 1000000, 10000000 });
+}
+
+nano::rpc_read_executor::~rpc_read_executor ()
+{
+	stop ();
+}
+
+void nano::rpc_read_executor::stop ()
+{
+	workers.stop ();
+}
+
+std::optional<nano::stat::detail> nano::rpc_read_executor::read_only (std::string const & action)
+{
+	auto existing = read_only_actions.find (action);
+	return existing != read_only_actions.end () ? std::make_optional (existing->second) : std::nullopt;
+}
+
+bool nano::rpc_read_executor::push (nano::stat::detail action, std::function<void ()> task, std::size_t slots_a)
+{
+	// A task needing more slots than there are takes all of them, it still runs once the executor is idle
+	auto const slots = std::min<std::size_t> (slots_a, std::max<std::size_t> (config.max_queued, 1));
+	// Slots are taken before checking so concurrent pushes cannot overshoot the limit together
+	auto const refused = queued.fetch_add (slots) + slots > config.max_queued;
+	if (!refused)
+	{
+		stats.inc (nano::stat::type::rpc_read, action, nano::stat::dir::in);
+		workers.push_task ([this, action, slots, task = std::move (task), pushed = std::chrono::steady_clock::now ()] () {
+			auto const start = std::chrono::steady_clock::now ();
+			stats.update_histogram (nano::stat::type::rpc_read, nano::stat::detail::queue_time, nano::stat::dir::in, std::chrono::duration_cast<std::chrono::microseconds> (start - pushed).count ());
+			task ();
+			stats.update_histogram (nano::stat::type::rpc_read, action, nano::stat::dir::out, std::chrono::duration_cast<std::chrono::microseconds> (std::chrono::steady_clock::now () - start).count ());
+			queued -= slots;
+		});
+	}
+	else
+	{
+		queued -= slots;
+		stats.inc (nano::stat::type::rpc_read, nano::stat::detail::overfill, nano::stat::dir::in);
+	}
+	return refused;
+}
+
+std::unique_ptr<nano::container_info_component> nano::rpc_read_executor::collect_container_info (std::string const & name)
+{
+	auto composite = std::make_unique<container_info_composite> (name);
+	composite->add_component (nano::collect_container_info (workers, "workers"));
+	return composite;
+}
+
+/*
+ * rpc_read_executor_config
+ */
+
+nano::error nano::rpc_read_executor_config::serialize (nano::tomlconfig & toml) const
+{
+	toml.put ("threads", threads, "Number of threads running read only RPC actions such as ledger, account_history and receivable, apart from the node io threads.\ntype:uint64");
+	toml.put ("max_queued", max_queued, "Maximum number of read only RPC actions waiting or running. Further requests are refused with an error until some complete.\ntype:uint64");
+
+	return toml.get_error ();
+}
+
+nano::error nano::rpc_read_executor_config::deserialize (nano::tomlconfig & toml)
+{
+	toml.get ("threads", threads);
+	toml.get ("max_queued", max_queued);
+
+	return toml.get_error ();
+}
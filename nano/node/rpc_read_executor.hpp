@@ -0,0 +1,61 @@
+#pragma once
+
+#include <nano/lib/errors.hpp>
+#include <nano/lib/stats_enums.hpp>
+#include <nano/lib/thread_pool.hpp>
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+
+namespace nano
+{
+class container_info_component;
+class stats;
+class tomlconfig;
+
+class rpc_read_executor_config final
+{
+public:
+	nano::error deserialize (nano::tomlconfig &);
+	nano::error serialize (nano::tomlconfig &) const;
+
+public:
+	/** Number of threads running read only RPC actions */
+	std::size_t threads{ 2 };
+	/** Read only actions waiting or running at once, further requests are refused until some complete */
+	std::size_t max_queued{ 256 };
+};
+
+/**
+ * Runs RPC actions which only read the ledger on a pool of their own, so bursts of heavy queries such as `ledger` do not occupy the io threads or background workers.
+ * Each action opens its own read transactions and records its queue and run time in per action histograms.
+ */
+class rpc_read_executor final
+{
+public:
+	rpc_read_executor (rpc_read_executor_config const &, nano::stats &);
+	~rpc_read_executor ();
+
+	void stop ();
+
+	/** Stat detail of `action` if it is a read only action run by this executor */
+	static std::optional<nano::stat::detail> read_only (std::string const & action);
+	/**
+	 * Queues `task` which runs the read only `action`, a task running several actions takes one of the `max_queued` slots for each, up to all of them
+	 * @return true if the executor is saturated and the task was refused
+	 */
+	bool push (nano::stat::detail action, std::function<void ()> task, std::size_t slots = 1);
+
+	std::unique_ptr<nano::container_info_component> collect_container_info (std::string const & name);
+
+private:
+	rpc_read_executor_config const & config;
+	nano::stats & stats;
+	/** Slots taken by tasks waiting or running */
+	std::atomic<std::size_t> queued{ 0 };
+	nano::thread_pool workers;
+};
+}
@@ -1,3 +1,4 @@
+#include <nano/crypto_lib/random_pool.hpp>
 #include <nano/lib/stats.hpp>
 #include <nano/lib/threading.hpp>
 #include <nano/node/network.hpp>
@@ -217,6 +218,24 @@ void nano::telemetry::request (std::shared_ptr<nano::transport::channel> & chann
 
 	nano::telemetry_req message{ network_params.network };
 	channel->send (message);
+
+	// telemetry_ack carries no request id and peers also broadcast it unsolicited, so round trips are timed with an account info request whose response echoes the id
+	// Answering one costs the peer a ledger read, so they are sent at most once per rtt_probe_interval rather than with every telemetry request
+	auto const probe_id = nano::random_pool::generate_word64 (1, std::numeric_limits<uint64_t>::max ());
+	if (channel->rtt_probe_start (probe_id, network_params.network.rtt_probe_interval))
+	{
+		stats.inc (nano::stat::type::telemetry, nano::stat::detail::rtt_probe);
+		nano::asc_pull_req probe{ network_params.network };
+		probe.id = probe_id;
+		probe.type = nano::asc_pull_type::account_info;
+		nano::asc_pull_req::account_info_payload payload;
+		payload.target = network_params.ledger.genesis->account ();
+		payload.target_type = nano::asc_pull_req::hash_type::account;
+		probe.payload = payload;
+		probe.update_header ();
+		channel->send (probe, nullptr, nano::transport::buffer_drop_policy::limiter, nano::transport::traffic_type::bootstrap);
+	}
+	channel->throughput_sample ();
 }
 
 void nano::telemetry::run_broadcasts ()
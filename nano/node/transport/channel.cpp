@@ -9,6 +9,7 @@
 #include <boost/format.hpp>
 
 nano::transport::channel::channel (nano::node & node_a) :
+	limiter{ node_a.config.peer_bandwidth_limit, node_a.config.peer_bandwidth_burst_ratio },
 	node{ node_a }
 {
 	set_network_version (node_a.network_params.network.protocol_version);
@@ -19,10 +20,21 @@ void nano::transport::channel::send (nano::message & message_a, std::function<vo
 	auto buffer (message_a.to_shared_const_buffer ());
 	auto detail = nano::to_stat_detail (message_a.header.type);
 	auto is_droppable_by_limiter = (drop_policy_a == nano::transport::buffer_drop_policy::limiter);
-	auto should_pass (node.outbound_limiter.should_pass (buffer.size (), to_bandwidth_limit_type (traffic_type)));
+	// The peer limit is checked first so messages it drops do not use up the node wide budget, messages the node limit drops give the peer budget back
+	auto const peer_limited = is_droppable_by_limiter && node.config.peer_bandwidth_limit != 0;
+	auto should_pass (!peer_limited || limiter.should_pass (buffer.size ()));
+	if (should_pass && !node.outbound_limiter.should_pass (buffer.size (), to_bandwidth_limit_type (traffic_type)))
+	{
+		should_pass = false;
+		if (peer_limited)
+		{
+			limiter.refund (buffer.size ());
+		}
+	}
 	if (!is_droppable_by_limiter || should_pass)
 	{
 		send_buffer (buffer, callback_a, drop_policy_a, traffic_type);
+		traffic.add (message_a.header.type, nano::stat::dir::out, buffer.size ());
 		node.stats.inc (nano::stat::type::message, detail, nano::stat::dir::out);
 	}
 	else
@@ -60,4 +72,106 @@ nano::endpoint nano::transport::channel::get_peering_endpoint () const
 		lock.unlock ();
 		return get_endpoint ();
 	}
-}
\ No newline at end of file
+}
+
+bool nano::transport::channel::rtt_probe_start (nano::asc_pull_req::id_t id, std::chrono::milliseconds interval)
+{
+	auto const now = std::chrono::steady_clock::now ();
+	nano::lock_guard<nano::mutex> lock{ channel_mutex };
+	if (rtt_probe_last && now - *rtt_probe_last < interval)
+	{
+		return false;
+	}
+	// A probe that was never answered is superseded, otherwise its age would be taken as the round trip time
+	rtt_probe = std::make_pair (id, now);
+	rtt_probe_last = now;
+	return true;
+}
+
+bool nano::transport::channel::rtt_probe_end (nano::asc_pull_req::id_t id)
+{
+	nano::unique_lock<nano::mutex> lock{ channel_mutex };
+	if (!rtt_probe || rtt_probe->first != id)
+	{
+		return false;
+	}
+	auto elapsed = std::chrono::steady_clock::now () - rtt_probe->second;
+	rtt_probe.reset ();
+	lock.unlock ();
+	rtt_sample (std::chrono::duration_cast<std::chrono::microseconds> (elapsed));
+	return true;
+}
+
+void nano::transport::channel::rtt_sample (std::chrono::microseconds sample)
+{
+	auto sample_l = static_cast<uint64_t> (std::max<int64_t> (sample.count (), 1));
+	auto current = rtt.load ();
+	uint64_t updated;
+	do
+	{
+		// Exponentially weighted moving average with a gain of 1/8, the same smoothing TCP applies to its RTT estimate
+		updated = current == 0 ? sample_l : current - current / 8 + sample_l / 8;
+	} while (!rtt.compare_exchange_weak (current, updated));
+}
+
+void nano::transport::channel::throughput_sample ()
+{
+	auto now = std::chrono::steady_clock::now ();
+	auto bytes = traffic.total_bytes (nano::stat::dir::in);
+	uint64_t sample;
+	{
+		nano::lock_guard<nano::mutex> lock{ channel_mutex };
+		auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds> (now - throughput_time).count ();
+		if (elapsed <= 0)
+		{
+			return;
+		}
+		sample = (bytes - throughput_bytes) * 1000 / static_cast<uint64_t> (elapsed);
+		throughput_bytes = bytes;
+		throughput_time = now;
+	}
+	auto current = throughput.load ();
+	uint64_t updated;
+	do
+	{
+		// Samples are taken once per telemetry request interval, a gain of 1/4 follows changes within a few intervals
+		updated = current == 0 ? sample : current - current / 4 + sample / 4;
+	} while (!throughput.compare_exchange_weak (current, updated));
+}
+
+/*
+ * traffic_counters
+ */
+
+std::size_t nano::transport::traffic_counters::index (nano::message_type type, nano::stat::dir dir)
+{
+	auto type_index = std::min<std::size_t> (static_cast<uint8_t> (type), type_count - 1);
+	return (dir == nano::stat::dir::in ? 0 : type_count) + type_index;
+}
+
+void nano::transport::traffic_counters::add (nano::message_type type, nano::stat::dir dir, std::size_t bytes)
+{
+	auto i = index (type, dir);
+	bytes_m[i].fetch_add (bytes, std::memory_order_relaxed);
+	messages_m[i].fetch_add (1, std::memory_order_relaxed);
+}
+
+uint64_t nano::transport::traffic_counters::bytes (nano::message_type type, nano::stat::dir dir) const
+{
+	return bytes_m[index (type, dir)].load (std::memory_order_relaxed);
+}
+
+uint64_t nano::transport::traffic_counters::messages (nano::message_type type, nano::stat::dir dir) const
+{
+	return messages_m[index (type, dir)].load (std::memory_order_relaxed);
+}
+
+uint64_t nano::transport::traffic_counters::total_bytes (nano::stat::dir dir) const
+{
+	uint64_t result = 0;
+	for (std::size_t i = 0; i < type_count; ++i)
+	{
+		result += bytes_m[(dir == nano::stat::dir::in ? 0 : type_count) + i].load (std::memory_order_relaxed);
+	}
+	return result;
+}
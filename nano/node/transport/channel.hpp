@@ -9,6 +9,8 @@
 
 #include <boost/asio/ip/network_v6.hpp>
 
+#include <array>
+
 namespace nano::transport
 {
 enum class transport_type : uint8_t
@@ -19,6 +21,27 @@ enum class transport_type : uint8_t
 	fake = 3
 };
 
+/**
+ * Bytes and messages exchanged with a single peer, split by message type and direction
+ */
+class traffic_counters final
+{
+public:
+	void add (nano::message_type, nano::stat::dir, std::size_t bytes);
+	uint64_t bytes (nano::message_type, nano::stat::dir) const;
+	uint64_t messages (nano::message_type, nano::stat::dir) const;
+	/** Bytes of all message types in direction `dir` */
+	uint64_t total_bytes (nano::stat::dir) const;
+
+private:
+	static std::size_t index (nano::message_type, nano::stat::dir);
+
+	// Message types fit in the low nibble of the header type byte
+	static std::size_t constexpr type_count = 16;
+	std::array<std::atomic<uint64_t>, type_count * 2> bytes_m{};
+	std::array<std::atomic<uint64_t>, type_count * 2> messages_m{};
+};
+
 class channel
 {
 public:
@@ -53,6 +76,11 @@ public:
 	{
 		return true;
 	}
+	/** Occupancy of the send queue for the given traffic type, 0 when empty and 1 or more when full */
+	virtual double queue_fill (nano::transport::traffic_type = nano::transport::traffic_type::generic) const
+	{
+		return 0.0;
+	}
 
 	std::chrono::steady_clock::time_point get_last_bootstrap_attempt () const
 	{
@@ -128,7 +156,35 @@ public:
 	nano::endpoint get_peering_endpoint () const;
 	void set_peering_endpoint (nano::endpoint endpoint);
 
+	/** Smoothed round trip time to the peer, zero if it has not been measured yet */
+	std::chrono::microseconds get_rtt () const
+	{
+		return std::chrono::microseconds{ rtt.load () };
+	}
+
+	/** Smoothed rate at which the peer sends us data in bytes per second, zero if it has not been measured yet */
+	uint64_t get_throughput () const
+	{
+		return throughput.load ();
+	}
+
+	/**
+	 * Marks the send time of request `id` whose response is used as a round trip time sample
+	 * @return false if the previous probe was started less than `interval` ago, in which case no probe is started
+	 */
+	bool rtt_probe_start (nano::asc_pull_req::id_t id, std::chrono::milliseconds interval);
+	/**
+	 * Completes the outstanding probe if `id` answers it and folds the sample into the smoothed round trip time
+	 * @return true if `id` was the outstanding probe
+	 */
+	bool rtt_probe_end (nano::asc_pull_req::id_t id);
+	/** Folds a round trip time sample into the smoothed value */
+	void rtt_sample (std::chrono::microseconds sample);
+	/** Folds the rate of bytes received since the previous sample into the smoothed throughput */
+	void throughput_sample ();
+
 	mutable nano::mutex channel_mutex;
+	nano::transport::traffic_counters traffic;
 
 private:
 	std::chrono::steady_clock::time_point last_bootstrap_attempt{ std::chrono::steady_clock::time_point () };
@@ -137,6 +193,19 @@ private:
 	boost::optional<nano::account> node_id{ boost::none };
 	std::atomic<uint8_t> network_version{ 0 };
 	std::optional<nano::endpoint> peering_endpoint{};
+	/** Smoothed round trip time in microseconds, zero when unknown */
+	std::atomic<uint64_t> rtt{ 0 };
+	/** Id and send time of the outstanding round trip probe, guarded by channel_mutex */
+	std::optional<std::pair<nano::asc_pull_req::id_t, std::chrono::steady_clock::time_point>> rtt_probe;
+	/** Start of the latest round trip probe, guarded by channel_mutex */
+	std::optional<std::chrono::steady_clock::time_point> rtt_probe_last;
+	/** Smoothed inbound bytes per second, zero when unknown */
+	std::atomic<uint64_t> throughput{ 0 };
+	/** Inbound byte count and time of the previous throughput sample, guarded by channel_mutex */
+	uint64_t throughput_bytes{ 0 };
+	std::chrono::steady_clock::time_point throughput_time{ std::chrono::steady_clock::now () };
+	/** Outbound limit for this peer only, in addition to the node wide limits. Unused when `peer_bandwidth_limit` is 0 */
+	nano::bandwidth_limiter limiter;
 
 protected:
 	nano::node & node;
@@ -214,6 +214,11 @@ bool nano::transport::socket::full (nano::transport::traffic_type traffic_type)
 	return send_queue.size (traffic_type) >= 2 * max_queue_size;
 }
 
+std::size_t nano::transport::socket::queue_size (nano::transport::traffic_type traffic_type) const
+{
+	return send_queue.size (traffic_type);
+}
+
 /** Call set_timeout with default_timeout as parameter */
 void nano::transport::socket::set_default_timeout ()
 {
@@ -91,6 +91,7 @@ public:
 
 	bool max (nano::transport::traffic_type = nano::transport::traffic_type::generic) const;
 	bool full (nano::transport::traffic_type = nano::transport::traffic_type::generic) const;
+	std::size_t queue_size (nano::transport::traffic_type = nano::transport::traffic_type::generic) const;
 
 	type_t type () const
 	{
@@ -207,6 +208,17 @@ private:
 
 public:
 	std::size_t const max_queue_size;
+
+	/** Per peer accounting of inbound realtime messages, maintained by tcp_message_manager */
+	class inbound_counters final
+	{
+	public:
+		/** Messages from this peer currently waiting to be processed */
+		std::atomic<std::size_t> queued{ 0 };
+		std::atomic<uint64_t> enqueued{ 0 };
+		std::atomic<uint64_t> dropped{ 0 };
+	};
+	inbound_counters inbound;
 };
 
 std::string socket_type_to_string (socket::type_t type);
@@ -91,6 +91,15 @@ namespace transport
 			return false;
 		}
 
+		double queue_fill (nano::transport::traffic_type traffic_type) const override
+		{
+			if (auto socket_l = socket.lock ())
+			{
+				return static_cast<double> (socket_l->queue_size (traffic_type)) / socket_l->max_queue_size;
+			}
+			return 0.0;
+		}
+
 	private:
 		nano::tcp_endpoint endpoint{ boost::asio::ip::address_v6::any (), 0 };
 	};
@@ -5,11 +5,52 @@
 #include <nano/lib/timer.hpp>
 #include <nano/node/unchecked_map.hpp>
 
-nano::unchecked_map::unchecked_map (nano::stats & stats, bool const & disable_delete) :
+#include <boost/interprocess/sync/file_lock.hpp>
+
+#include <fstream>
+
+nano::unchecked_map::unchecked_map (nano::stats & stats, bool const & disable_delete, std::filesystem::path const & spill_path, std::size_t spill_count_max, std::size_t memory_count_max) :
 	stats{ stats },
 	disable_delete{ disable_delete },
-	thread{ [this] () { run (); } }
+	memory_count_max{ (memory_count_max + shard_count - 1) / shard_count }
+{
+	if (!spill_path.empty () && spill_count_max > 0 && lock_spill (spill_path))
+	{
+		for (auto i = 0u; i < shard_count; ++i)
+		{
+			auto path = spill_path;
+			path += "." + std::to_string (i);
+			auto & spill = shards[i].spill;
+			spill = std::make_unique<nano::unchecked_spill> (stats, path, (spill_count_max + shard_count - 1) / shard_count);
+			if (!spill->enabled ())
+			{
+				spill.reset ();
+			}
+		}
+	}
+	thread = std::thread{ [this] () { run (); } };
+}
+
+bool nano::unchecked_map::lock_spill (std::filesystem::path const & spill_path)
 {
+	auto lock_path = spill_path;
+	lock_path += ".lock";
+	try
+	{
+		std::error_code ec;
+		std::filesystem::create_directories (lock_path.parent_path (), ec);
+		// file_lock needs an existing file
+		std::ofstream{ lock_path, std::ios::app };
+		auto lock = std::make_unique<boost::interprocess::file_lock> (lock_path.string ().c_str ());
+		if (lock->try_lock ())
+		{
+			spill_lock = std::move (lock);
+		}
+	}
+	catch (boost::interprocess::interprocess_exception const &)
+	{
+	}
+	return spill_lock != nullptr;
 }
 
 nano::unchecked_map::~unchecked_map ()
@@ -18,68 +59,196 @@ nano::unchecked_map::~unchecked_map ()
 	thread.join ();
 }
 
+auto nano::unchecked_map::shard_of (nano::hash_or_account const & dependency) -> shard &
+{
+	return shards[dependency.as_block_hash ().qwords[0] % shard_count];
+}
+
+auto nano::unchecked_map::shard_of (nano::hash_or_account const & dependency) const -> shard const &
+{
+	return shards[dependency.as_block_hash ().qwords[0] % shard_count];
+}
+
 void nano::unchecked_map::put (nano::hash_or_account const & dependency, nano::unchecked_info const & info)
 {
-	nano::lock_guard<std::recursive_mutex> lock{ entries_mutex };
 	nano::unchecked_key key{ dependency, info.block->hash () };
-	entries.get<tag_root> ().insert ({ key, info });
-	if (entries.size () > mem_block_count_max)
+	auto & shard = shard_of (dependency);
+	std::optional<nano::unchecked_spill::put_result> spilled;
+	{
+		nano::lock_guard<nano::mutex> lock{ shard.mutex };
+		if (shard.spill != nullptr && shard.spill->exists (key))
+		{
+			return;
+		}
+		shard.entries.get<tag_root> ().insert ({ key, info });
+		if (shard.entries.size () > memory_count_max)
+		{
+			auto const & oldest = shard.entries.get<tag_sequenced> ().front ();
+			if (shard.spill != nullptr)
+			{
+				spilled = shard.spill->put (oldest.key, oldest.info);
+			}
+			shard.entries.get<tag_sequenced> ().pop_front ();
+		}
+	}
+	if (spilled)
 	{
-		entries.get<tag_sequenced> ().pop_front ();
+		switch (*spilled)
+		{
+			case nano::unchecked_spill::put_result::overflow:
+				stats.inc (nano::stat::type::unchecked, nano::stat::detail::spill_overflow);
+				[[fallthrough]];
+			case nano::unchecked_spill::put_result::added:
+			case nano::unchecked_spill::put_result::exists:
+				stats.inc (nano::stat::type::unchecked, nano::stat::detail::spill);
+				break;
+			case nano::unchecked_spill::put_result::error:
+				stats.inc (nano::stat::type::unchecked, nano::stat::detail::spill_error);
+				break;
+		}
 	}
 	stats.inc (nano::stat::type::unchecked, nano::stat::detail::put);
 }
 
-void nano::unchecked_map::for_each (std::function<void (nano::unchecked_key const &, nano::unchecked_info const &)> action, std::function<bool ()> predicate)
+std::vector<nano::unchecked_map::value_type> nano::unchecked_map::list (std::size_t count) const
 {
-	nano::lock_guard<std::recursive_mutex> lock{ entries_mutex };
-	for (auto i = entries.begin (), n = entries.end (); predicate () && i != n; ++i)
+	std::vector<value_type> result;
+	for (auto const & shard : shards)
 	{
-		action (i->key, i->info);
+		nano::lock_guard<nano::mutex> lock{ shard.mutex };
+		for (auto i = shard.entries.begin (), n = shard.entries.end (); result.size () < count && i != n; ++i)
+		{
+			result.emplace_back (i->key, i->info);
+		}
+		if (shard.spill != nullptr && result.size () < count)
+		{
+			shard.spill->list (count - result.size (), result);
+		}
 	}
+	return result;
 }
 
-void nano::unchecked_map::for_each (nano::hash_or_account const & dependency, std::function<void (nano::unchecked_key const &, nano::unchecked_info const &)> action, std::function<bool ()> predicate)
+std::vector<nano::unchecked_map::value_type> nano::unchecked_map::list (nano::hash_or_account const & dependency) const
 {
-	nano::lock_guard<std::recursive_mutex> lock{ entries_mutex };
-	for (auto i = entries.template get<tag_root> ().lower_bound (nano::unchecked_key{ dependency, 0 }), n = entries.template get<tag_root> ().end (); predicate () && i != n && i->key.key () == dependency.as_block_hash (); ++i)
+	std::vector<value_type> result;
+	auto const & shard = shard_of (dependency);
+	nano::lock_guard<nano::mutex> lock{ shard.mutex };
+	for (auto i = shard.entries.get<tag_root> ().lower_bound (nano::unchecked_key{ dependency, 0 }), n = shard.entries.get<tag_root> ().end (); i != n && i->key.key () == dependency.as_block_hash (); ++i)
+	{
+		result.emplace_back (i->key, i->info);
+	}
+	if (shard.spill != nullptr)
 	{
-		action (i->key, i->info);
+		shard.spill->list (dependency, result);
 	}
+	return result;
 }
 
-std::vector<nano::unchecked_info> nano::unchecked_map::get (nano::block_hash const & hash)
+std::vector<nano::unchecked_map::value_type> nano::unchecked_map::extract (nano::hash_or_account const & dependency)
+{
+	std::vector<value_type> result;
+	auto & shard = shard_of (dependency);
+	nano::lock_guard<nano::mutex> lock{ shard.mutex };
+	auto & entries = shard.entries.get<tag_root> ();
+	auto i = entries.lower_bound (nano::unchecked_key{ dependency, 0 });
+	auto n = i;
+	for (; n != entries.end () && n->key.key () == dependency.as_block_hash (); ++n)
+	{
+		result.emplace_back (n->key, n->info);
+	}
+	entries.erase (i, n);
+	if (shard.spill != nullptr)
+	{
+		shard.spill->extract (dependency, result);
+	}
+	return result;
+}
+
+std::optional<nano::unchecked_map::value_type> nano::unchecked_map::find (nano::block_hash const & hash) const
+{
+	for (auto const & shard : shards)
+	{
+		nano::lock_guard<nano::mutex> lock{ shard.mutex };
+		for (auto const & entry : shard.entries)
+		{
+			if (entry.key.hash == hash)
+			{
+				return value_type{ entry.key, entry.info };
+			}
+		}
+		if (shard.spill != nullptr)
+		{
+			if (auto result = shard.spill->find (hash))
+			{
+				return result;
+			}
+		}
+	}
+	return std::nullopt;
+}
+
+std::vector<nano::unchecked_info> nano::unchecked_map::get (nano::block_hash const & hash) const
 {
 	std::vector<nano::unchecked_info> result;
-	for_each (hash, [&result] (nano::unchecked_key const & key, nano::unchecked_info const & info) {
-		result.push_back (info);
-	});
+	for (auto & [key, info] : list (hash))
+	{
+		result.push_back (std::move (info));
+	}
 	return result;
 }
 
 bool nano::unchecked_map::exists (nano::unchecked_key const & key) const
 {
-	nano::lock_guard<std::recursive_mutex> lock{ entries_mutex };
-	return entries.get<tag_root> ().count (key) != 0;
+	auto const & shard = shard_of (key.key ());
+	nano::lock_guard<nano::mutex> lock{ shard.mutex };
+	return shard.entries.get<tag_root> ().count (key) != 0 || (shard.spill != nullptr && shard.spill->exists (key));
 }
 
 void nano::unchecked_map::del (nano::unchecked_key const & key)
 {
-	nano::lock_guard<std::recursive_mutex> lock{ entries_mutex };
-	auto erased = entries.get<tag_root> ().erase (key);
+	auto & shard = shard_of (key.key ());
+	nano::lock_guard<nano::mutex> lock{ shard.mutex };
+	auto erased = shard.entries.get<tag_root> ().erase (key) != 0;
+	if (!erased && shard.spill != nullptr)
+	{
+		erased = shard.spill->erase (key);
+	}
 	debug_assert (erased);
 }
 
 void nano::unchecked_map::clear ()
 {
-	nano::lock_guard<std::recursive_mutex> lock{ entries_mutex };
-	entries.clear ();
+	for (auto & shard : shards)
+	{
+		nano::lock_guard<nano::mutex> lock{ shard.mutex };
+		shard.entries.clear ();
+		if (shard.spill != nullptr)
+		{
+			shard.spill->clear ();
+		}
+	}
 }
 
 std::size_t nano::unchecked_map::count () const
 {
-	nano::lock_guard<std::recursive_mutex> lock{ entries_mutex };
-	return entries.size ();
+	std::size_t result{ 0 };
+	for (auto const & shard : shards)
+	{
+		nano::lock_guard<nano::mutex> lock{ shard.mutex };
+		result += shard.entries.size () + (shard.spill != nullptr ? shard.spill->count () : 0);
+	}
+	return result;
+}
+
+std::size_t nano::unchecked_map::spilled () const
+{
+	std::size_t result{ 0 };
+	for (auto const & shard : shards)
+	{
+		nano::lock_guard<nano::mutex> lock{ shard.mutex };
+		result += shard.spill != nullptr ? shard.spill->count () : 0;
+	}
+	return result;
 }
 
 void nano::unchecked_map::stop ()
@@ -145,27 +314,29 @@ void nano::unchecked_map::run ()
 
 void nano::unchecked_map::query_impl (nano::block_hash const & hash)
 {
-	std::deque<nano::unchecked_key> delete_queue;
-	for_each (hash, [this, &delete_queue] (nano::unchecked_key const & key, nano::unchecked_info const & info) {
-		delete_queue.push_back (key);
+	// Entries are taken out of the shard first, so observers run without holding its lock
+	auto entries = disable_delete ? list (hash) : extract (hash);
+	for (auto const & [key, info] : entries)
+	{
 		stats.inc (nano::stat::type::unchecked, nano::stat::detail::satisfied);
 		satisfied.notify (info);
-	});
-	if (!disable_delete)
-	{
-		for (auto const & key : delete_queue)
-		{
-			del (key);
-		}
 	}
 }
 
 std::unique_ptr<nano::container_info_component> nano::unchecked_map::collect_container_info (const std::string & name)
 {
+	std::size_t entries_count{ 0 };
+	for (auto const & shard : shards)
+	{
+		nano::lock_guard<nano::mutex> lock{ shard.mutex };
+		entries_count += shard.entries.size ();
+	}
+	auto const spilled_count = spilled ();
 	nano::lock_guard<nano::mutex> lock{ mutex };
 
 	auto composite = std::make_unique<container_info_composite> (name);
-	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "entries", entries.size (), sizeof (decltype (entries)::value_type) }));
+	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "entries", entries_count, sizeof (ordered_unchecked::value_type) }));
+	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "spilled", spilled_count, sizeof (nano::unchecked_key) + sizeof (uint64_t) }));
 	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "queries", buffer.size (), sizeof (decltype (buffer)::value_type) }));
 	return composite;
 }
@@ -3,6 +3,7 @@
 #include <nano/lib/locks.hpp>
 #include <nano/lib/numbers.hpp>
 #include <nano/lib/observer_set.hpp>
+#include <nano/node/unchecked_spill.hpp>
 #include <nano/secure/common.hpp>
 
 #include <boost/multi_index/member.hpp>
@@ -11,30 +12,57 @@
 #include <boost/multi_index/sequenced_index.hpp>
 #include <boost/multi_index_container.hpp>
 
+#include <array>
+#include <optional>
 #include <thread>
 
 namespace mi = boost::multi_index;
 
+namespace boost::interprocess
+{
+class file_lock;
+}
+
 namespace nano
 {
 class stats;
 
+/**
+ * Blocks waiting on a missing dependency, keyed by the dependency.
+ * The most recent entries are kept in memory, older ones are moved to an optional unchecked_spill file instead of being dropped.
+ * Entries are sharded by dependency with a lock per shard, so network puts and dependency triggers from the block processor rarely contend.
+ */
 class unchecked_map
 {
 public:
-	unchecked_map (nano::stats &, bool const & do_delete);
+	using value_type = std::pair<nano::unchecked_key, nano::unchecked_info>;
+
+	static std::size_t constexpr default_memory_count_max = 64 * 1024;
+	static std::size_t constexpr shard_count = 16;
+
+	/**
+	 * An empty `spill_path` or zero `spill_count_max` keeps entries in memory only. Limits are split evenly between the shards.
+	 * Spill files are only used by the process holding the lock on `spill_path`.lock, other processes on the same data directory keep entries in memory only.
+	 */
+	unchecked_map (nano::stats &, bool const & do_delete, std::filesystem::path const & spill_path = {}, std::size_t spill_count_max = 0, std::size_t memory_count_max = default_memory_count_max);
 	~unchecked_map ();
 
 	void put (nano::hash_or_account const & dependency, nano::unchecked_info const & info);
-	void for_each (
-	std::function<void (nano::unchecked_key const &, nano::unchecked_info const &)> action, std::function<bool ()> predicate = [] () { return true; });
-	void for_each (
-	nano::hash_or_account const & dependency, std::function<void (nano::unchecked_key const &, nano::unchecked_info const &)> action, std::function<bool ()> predicate = [] () { return true; });
-	std::vector<nano::unchecked_info> get (nano::block_hash const &);
+	/** Copies up to `count` entries, each shard is locked only while it is being copied */
+	std::vector<value_type> list (std::size_t count = std::numeric_limits<std::size_t>::max ()) const;
+	/** Copies the entries waiting on `dependency` */
+	std::vector<value_type> list (nano::hash_or_account const & dependency) const;
+	/** Removes and returns the entries waiting on `dependency` */
+	std::vector<value_type> extract (nano::hash_or_account const & dependency);
+	/** Finds the entry of the block `hash` whatever its dependency */
+	std::optional<value_type> find (nano::block_hash const & hash) const;
+	std::vector<nano::unchecked_info> get (nano::block_hash const &) const;
 	bool exists (nano::unchecked_key const & key) const;
 	void del (nano::unchecked_key const & key);
 	void clear ();
 	std::size_t count () const;
+	/** Number of entries moved to the spill file */
+	std::size_t spilled () const;
 	void stop ();
 	void flush ();
 
@@ -61,12 +89,9 @@ private:
 	bool stopped{ false };
 	nano::condition_variable condition;
 	nano::mutex mutex;
-	std::thread thread;
 
 	void process_queries (decltype (buffer) const & back_buffer);
 
-	static std::size_t constexpr mem_block_count_max = 64 * 1024;
-
 private:
 	struct entry
 	{
@@ -84,9 +109,28 @@ private:
 			mi::ordered_unique<mi::tag<tag_root>,
 				mi::member<entry, nano::unchecked_key, &entry::key>>>>;
 	// clang-format on
-	ordered_unchecked entries;
 
-	mutable std::recursive_mutex entries_mutex;
+	class shard final
+	{
+	public:
+		mutable nano::mutex mutex;
+		ordered_unchecked entries;
+		/** Entries evicted from memory, null if spilling is disabled */
+		std::unique_ptr<nano::unchecked_spill> spill;
+	};
+
+	shard & shard_of (nano::hash_or_account const & dependency);
+	shard const & shard_of (nano::hash_or_account const & dependency) const;
+
+	/** Takes the lock guarding the spill files from other processes using the same data directory, @return true if it was taken */
+	bool lock_spill (std::filesystem::path const & spill_path);
+
+	/** Limit of entries in memory per shard */
+	std::size_t const memory_count_max;
+	/** Declared before the shards so the spill files are removed before the lock is released */
+	std::unique_ptr<boost::interprocess::file_lock> spill_lock;
+	std::array<shard, shard_count> shards;
+	std::thread thread;
 
 public: // Container info
 	std::unique_ptr<nano::container_info_component> collect_container_info (std::string const & name);
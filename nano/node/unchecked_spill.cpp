@@ -0,0 +1,258 @@
+#include <nano/lib/stats.hpp>
+#include <nano/lib/stream.hpp>
+#include <nano/node/unchecked_spill.hpp>
+
+nano::unchecked_spill::unchecked_spill (nano::stats & stats_a, std::filesystem::path const & path_a, std::size_t max_count_a) :
+	stats{ stats_a },
+	path{ path_a },
+	max_count{ max_count_a }
+{
+	std::error_code ec;
+	std::filesystem::create_directories (path.parent_path (), ec);
+	// Unchecked entries don't survive restarts, any spill left over from a previous run is discarded
+	truncate ();
+}
+
+nano::unchecked_spill::~unchecked_spill ()
+{
+	file.close ();
+	std::error_code ec;
+	std::filesystem::remove (path, ec);
+}
+
+bool nano::unchecked_spill::enabled () const
+{
+	return max_count > 0 && file.is_open ();
+}
+
+auto nano::unchecked_spill::put (nano::unchecked_key const & key, nano::unchecked_info const & info) -> put_result
+{
+	if (entries.get<tag_key> ().count (key) != 0)
+	{
+		return put_result::exists;
+	}
+	if (!file.is_open ())
+	{
+		// A failed compaction could not reopen the file
+		return put_result::error;
+	}
+	buffer.clear ();
+	{
+		nano::vectorstream stream{ buffer };
+		info.serialize (stream);
+	}
+	file.seekp (file_size);
+	file.write (reinterpret_cast<char const *> (buffer.data ()), buffer.size ());
+	// Flushed so write errors are seen here rather than when the entry is read back
+	file.flush ();
+	if (!file.good ())
+	{
+		// Out of disk space or similar
+		file.clear ();
+		return put_result::error;
+	}
+	entries.get<tag_sequenced> ().push_back ({ key, file_size, static_cast<uint32_t> (buffer.size ()) });
+	file_size += buffer.size ();
+	live_size += buffer.size ();
+	if (entries.size () > max_count)
+	{
+		auto & oldest = entries.get<tag_sequenced> ().front ();
+		live_size -= oldest.size;
+		entries.get<tag_sequenced> ().pop_front ();
+		reclaim ();
+		return put_result::overflow;
+	}
+	return put_result::added;
+}
+
+void nano::unchecked_spill::list (std::size_t count, std::vector<value_type> & result)
+{
+	std::vector<nano::unchecked_key> unreadable;
+	for (auto i = entries.get<tag_key> ().begin (), n = entries.get<tag_key> ().end (); count > 0 && i != n; ++i)
+	{
+		if (auto info = read (*i))
+		{
+			result.emplace_back (i->key, std::move (*info));
+			--count;
+		}
+		else
+		{
+			unreadable.push_back (i->key);
+		}
+	}
+	erase (unreadable);
+}
+
+void nano::unchecked_spill::list (nano::hash_or_account const & dependency, std::vector<value_type> & result)
+{
+	std::vector<nano::unchecked_key> unreadable;
+	for (auto i = entries.get<tag_key> ().lower_bound (nano::unchecked_key{ dependency, 0 }), n = entries.get<tag_key> ().end (); i != n && i->key.key () == dependency.as_block_hash (); ++i)
+	{
+		if (auto info = read (*i))
+		{
+			result.emplace_back (i->key, std::move (*info));
+		}
+		else
+		{
+			unreadable.push_back (i->key);
+		}
+	}
+	erase (unreadable);
+}
+
+void nano::unchecked_spill::extract (nano::hash_or_account const & dependency, std::vector<value_type> & result)
+{
+	auto const size = result.size ();
+	list (dependency, result);
+	for (auto i = result.begin () + size, n = result.end (); i != n; ++i)
+	{
+		erase (i->first);
+	}
+}
+
+std::optional<nano::unchecked_spill::value_type> nano::unchecked_spill::find (nano::block_hash const & hash)
+{
+	for (auto const & entry : entries.get<tag_sequenced> ())
+	{
+		if (entry.key.hash == hash)
+		{
+			if (auto info = read (entry))
+			{
+				return value_type{ entry.key, std::move (*info) };
+			}
+			auto const key = entry.key;
+			erase (key);
+			break;
+		}
+	}
+	return std::nullopt;
+}
+
+bool nano::unchecked_spill::exists (nano::unchecked_key const & key) const
+{
+	return entries.get<tag_key> ().count (key) != 0;
+}
+
+bool nano::unchecked_spill::erase (nano::unchecked_key const & key)
+{
+	auto existing = entries.get<tag_key> ().find (key);
+	if (existing == entries.get<tag_key> ().end ())
+	{
+		return false;
+	}
+	live_size -= existing->size;
+	entries.get<tag_key> ().erase (existing);
+	reclaim ();
+	return true;
+}
+
+void nano::unchecked_spill::erase (std::vector<nano::unchecked_key> const & unreadable)
+{
+	for (auto const & key : unreadable)
+	{
+		erase (key);
+	}
+}
+
+void nano::unchecked_spill::clear ()
+{
+	entries.clear ();
+	truncate ();
+}
+
+std::size_t nano::unchecked_spill::count () const
+{
+	return entries.size ();
+}
+
+uint64_t nano::unchecked_spill::size () const
+{
+	return file_size;
+}
+
+std::optional<nano::unchecked_info> nano::unchecked_spill::read (entry const & entry_a)
+{
+	buffer.resize (entry_a.size);
+	file.seekg (entry_a.offset);
+	file.read (reinterpret_cast<char *> (buffer.data ()), buffer.size ());
+	nano::unchecked_info result;
+	nano::bufferstream stream{ buffer.data (), buffer.size () };
+	if (!file.good () || result.deserialize (stream))
+	{
+		// Short read or corrupted entry
+		file.clear ();
+		stats.inc (nano::stat::type::unchecked, nano::stat::detail::spill_error);
+		return std::nullopt;
+	}
+	return result;
+}
+
+void nano::unchecked_spill::truncate ()
+{
+	file.close ();
+	file.open (path, std::ios::in | std::ios::out | std::ios::binary | std::ios::trunc);
+	file_size = 0;
+	live_size = 0;
+}
+
+void nano::unchecked_spill::reclaim ()
+{
+	if (entries.empty ())
+	{
+		truncate ();
+	}
+	else if (file_size - live_size > std::max (compact_threshold, live_size) && compact ())
+	{
+		// The live entries can no longer be trusted to be in either file
+		stats.inc (nano::stat::type::unchecked, nano::stat::detail::spill_error);
+		entries.clear ();
+		truncate ();
+	}
+}
+
+bool nano::unchecked_spill::compact ()
+{
+	auto temp_path = path;
+	temp_path += ".compact";
+	std::vector<entry> compacted;
+	compacted.reserve (entries.size ());
+	auto error = false;
+	{
+		std::ofstream temp{ temp_path, std::ios::binary | std::ios::trunc };
+		uint64_t offset{ 0 };
+		for (auto const & entry : entries.get<tag_sequenced> ())
+		{
+			buffer.resize (entry.size);
+			file.seekg (entry.offset);
+			file.read (reinterpret_cast<char *> (buffer.data ()), buffer.size ());
+			temp.write (reinterpret_cast<char const *> (buffer.data ()), buffer.size ());
+			compacted.push_back ({ entry.key, offset, entry.size });
+			offset += buffer.size ();
+		}
+		temp.flush ();
+		error = !file.good () || !temp.good ();
+		debug_assert (error || offset == live_size);
+	}
+	std::error_code ec;
+	if (!error)
+	{
+		file.close ();
+		std::filesystem::rename (temp_path, path, ec);
+		error = static_cast<bool> (ec);
+	}
+	if (error)
+	{
+		std::filesystem::remove (temp_path, ec);
+		return true;
+	}
+	// Offsets only change once the rewritten file is in place
+	auto & sequenced = entries.get<tag_sequenced> ();
+	auto i = sequenced.begin ();
+	for (auto const & moved : compacted)
+	{
+		sequenced.modify (i++, [&moved] (entry & entry_a) { entry_a.offset = moved.offset; });
+	}
+	file_size = live_size;
+	file.open (path, std::ios::in | std::ios::out | std::ios::binary);
+	return !file.is_open ();
+}
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <nano/secure/common.hpp>
+
+#include <boost/multi_index/member.hpp>
+#include <boost/multi_index/ordered_index.hpp>
+#include <boost/multi_index/sequenced_index.hpp>
+#include <boost/multi_index_container.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <optional>
+
+namespace mi = boost::multi_index;
+
+namespace nano
+{
+class stats;
+
+/**
+ * Append-only file holding unchecked entries evicted from the in memory unchecked_map.
+ * Only the key and file location of each entry is kept in memory, indexed by dependency so the dependents of a block are read back with one lookup.
+ * Erased and dropped entries leave dead space in the file which is reclaimed by rewriting the live entries once it outgrows them.
+ * I/O errors are counted as spill_error, entries that cannot be read back are dropped and a failed rewrite empties the spill.
+ * Not thread safe, the owning unchecked_map serializes access.
+ */
+class unchecked_spill final
+{
+public:
+	using value_type = std::pair<nano::unchecked_key, nano::unchecked_info>;
+
+	unchecked_spill (nano::stats &, std::filesystem::path const & path, std::size_t max_count);
+	~unchecked_spill ();
+
+	enum class put_result
+	{
+		added,
+		/** Entries already spilled are ignored */
+		exists,
+		/** Added, the oldest entry was dropped to stay within the count limit */
+		overflow,
+		/** Writing to the file failed, the entry is lost the same as without a spill */
+		error
+	};
+
+	/** Whether the spill file could be created */
+	bool enabled () const;
+	/** Appends an entry */
+	put_result put (nano::unchecked_key const &, nano::unchecked_info const &);
+	/** Appends up to `count` entries to `result` */
+	void list (std::size_t count, std::vector<value_type> & result);
+	/** Appends the entries waiting on `dependency` to `result` */
+	void list (nano::hash_or_account const & dependency, std::vector<value_type> & result);
+	/** Moves the entries waiting on `dependency` to `result` */
+	void extract (nano::hash_or_account const & dependency, std::vector<value_type> & result);
+	/** Entry of the block `hash`, found by scanning the in memory keys */
+	std::optional<value_type> find (nano::block_hash const & hash);
+	bool exists (nano::unchecked_key const &) const;
+	/** @return true if the entry was found */
+	bool erase (nano::unchecked_key const &);
+	void clear ();
+	std::size_t count () const;
+	/** Size of the spill file including dead space */
+	uint64_t size () const;
+
+	/** Dead space is only reclaimed once it exceeds this and the size of the live entries */
+	static uint64_t constexpr compact_threshold = 16 * 1024 * 1024;
+
+private:
+	struct entry
+	{
+		nano::unchecked_key key;
+		uint64_t offset;
+		uint32_t size;
+	};
+
+	/** @return the entry or nothing if it could not be read back */
+	std::optional<nano::unchecked_info> read (entry const &);
+	/** Drops entries that could not be read back */
+	void erase (std::vector<nano::unchecked_key> const & unreadable);
+	void truncate ();
+	/** Compacts the file once dead space outgrows the live entries */
+	void reclaim ();
+	/** @return true if rewriting the file failed */
+	bool compact ();
+
+	// clang-format off
+	class tag_sequenced {};
+	class tag_key {};
+
+	using ordered_entries = boost::multi_index_container<entry,
+		mi::indexed_by<
+			mi::sequenced<mi::tag<tag_sequenced>>,
+			mi::ordered_unique<mi::tag<tag_key>,
+				mi::member<entry, nano::unchecked_key, &entry::key>>>>;
+	// clang-format on
+
+	nano::stats & stats;
+	std::filesystem::path const path;
+	std::size_t const max_count;
+	std::fstream file;
+	ordered_entries entries;
+	/** End of the file, where the next entry is appended */
+	uint64_t file_size{ 0 };
+	/** Bytes of the file belonging to entries still present */
+	uint64_t live_size{ 0 };
+	std::vector<uint8_t> buffer;
+};
+}
@@ -348,16 +348,15 @@ void nano::websocket::session::read ()
 				// Prepare next read by clearing the multibuffer
 				this_l->read_buffer.consume (this_l->read_buffer.size ());
 
-				boost::property_tree::ptree tree_msg;
-				try
+				nano::json_reader reader;
+				if (!reader.parse (std::move (incoming_message)))
 				{
-					boost::property_tree::read_json (os, tree_msg);
-					this_l->handle_message (tree_msg);
+					this_l->handle_message (reader.root ());
 					this_l->read ();
 				}
-				catch (boost::property_tree::json_parser::json_parser_error const & ex)
+				else
 				{
-					this_l->ws_listener.get_logger ().try_log ("Websocket: json parsing failed: ", ex.what ());
+					this_l->ws_listener.get_logger ().try_log ("Websocket: json parsing failed");
 				}
 			}
 			else if (ec != boost::asio::error::eof)
@@ -470,7 +469,7 @@ void nano::websocket::session::send_ack (std::string action_a, std::string id_a)
 	write (msg);
 }
 
-void nano::websocket::session::handle_message (boost::property_tree::ptree const & message_a)
+void nano::websocket::session::handle_message (nano::json_value const & message_a)
 {
 	std::string action (message_a.get<std::string> ("action", ""));
 	auto topic_l (to_topic (message_a.get<std::string> ("topic", "")));
@@ -484,11 +483,11 @@ void nano::websocket::session::handle_message (boost::property_tree::ptree const
 		std::unique_ptr<nano::websocket::options> options_l{ nullptr };
 		if (options_text_l && topic_l == nano::websocket::topic::confirmation)
 		{
-			options_l = std::make_unique<nano::websocket::confirmation_options> (options_text_l.get (), ws_listener.get_wallets (), ws_listener.get_logger ());
+			options_l = std::make_unique<nano::websocket::confirmation_options> (options_text_l->to_ptree (), ws_listener.get_wallets (), ws_listener.get_logger ());
 		}
 		else if (options_text_l && topic_l == nano::websocket::topic::vote)
 		{
-			options_l = std::make_unique<nano::websocket::vote_options> (options_text_l.get (), ws_listener.get_logger ());
+			options_l = std::make_unique<nano::websocket::vote_options> (options_text_l->to_ptree (), ws_listener.get_logger ());
 		}
 		else
 		{
@@ -515,7 +514,7 @@ void nano::websocket::session::handle_message (boost::property_tree::ptree const
 		if (existing != subscriptions.end ())
 		{
 			auto options_text_l (message_a.get_child_optional ("options"));
-			if (options_text_l.is_initialized () && !existing->second->update (*options_text_l))
+			if (options_text_l.is_initialized () && !existing->second->update (options_text_l->to_ptree ()))
 			{
 				action_succeeded = true;
 			}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <nano/lib/blocks.hpp>
+#include <nano/lib/json_reader.hpp>
 #include <nano/lib/numbers.hpp>
 #include <nano/lib/work.hpp>
 #include <nano/node/common.hpp>
@@ -280,7 +281,7 @@ namespace websocket
 		nano::mutex subscriptions_mutex;
 
 		/** Handle incoming message */
-		void handle_message (boost::property_tree::ptree const & message_a);
+		void handle_message (nano::json_value const & message_a);
 		/** Acknowledge incoming message */
 		void send_ack (std::string action_a, std::string id_a);
 		/** Send all queued messages. This must be called from the write strand. */
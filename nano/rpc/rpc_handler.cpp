@@ -1,6 +1,7 @@
 #include <nano/crypto_lib/random_pool.hpp>
 #include <nano/lib/errors.hpp>
 #include <nano/lib/json_error_response.hpp>
+#include <nano/lib/json_reader.hpp>
 #include <nano/lib/logger_mt.hpp>
 #include <nano/lib/numbers.hpp>
 #include <nano/lib/rpc_handler_interface.hpp>
@@ -16,6 +17,7 @@ namespace
 std::unordered_set<std::string> create_rpc_control_impls ();
 std::unordered_set<std::string> rpc_control_impl_set = create_rpc_control_impls ();
 std::string filter_request (boost::property_tree::ptree tree_a);
+std::string random_id ();
 }
 
 nano::rpc_handler::rpc_handler (nano::rpc_config const & rpc_config, std::string const & body_a, std::string const & request_id_a, std::function<void (std::string const &)> const & response_a, nano::rpc_handler_interface & rpc_handler_interface_a, nano::logger_mt & logger) :
@@ -54,68 +56,39 @@ void nano::rpc_handler::process_request (nano::rpc_handler_request_params const
 		{
 			if (request_params.rpc_version == 1)
 			{
-				boost::property_tree::ptree request;
+				nano::json_reader reader;
+				if (reader.parse (body))
 				{
-					std::stringstream ss;
-					ss << body;
-					boost::property_tree::read_json (ss, request);
+					json_error_response (response, "Unable to parse JSON");
+					return;
 				}
-
-				auto action = request.get<std::string> ("action");
-				if (rpc_config.rpc_logging.log_rpc)
+				auto const request = reader.root ();
+				if (request.is_array ())
 				{
-					// Creating same string via stringstream as using it directly is generating a TSAN warning
-					std::stringstream ss;
-					ss << request_id;
-					logger.always_log (ss.str (), " ", filter_request (request));
+					process_batch (request);
+					return;
 				}
 
-				// Check if this is a RPC command which requires RPC enabled control
-				std::error_code rpc_control_disabled_ec = nano::error_rpc::rpc_control_disabled;
+				auto action = request.get<std::string> ("action");
+				log_request (request);
 
-				bool error = false;
-				auto found = rpc_control_impl_set.find (action);
-				if (found != rpc_control_impl_set.cend () && !rpc_config.enable_control)
+				// Check if this is a RPC command which requires RPC enabled control
+				if (control_disabled (request, action))
 				{
+					std::error_code rpc_control_disabled_ec = nano::error_rpc::rpc_control_disabled;
 					json_error_response (response, rpc_control_disabled_ec.message ());
-					error = true;
 				}
 				else
 				{
-					// Special case with stats, type -> objects
-					if (action == "stats" && !rpc_config.enable_control)
-					{
-						if (request.get<std::string> ("type") == "objects")
-						{
-							json_error_response (response, rpc_control_disabled_ec.message ());
-							error = true;
-						}
-					}
-					else if (action == "process")
-					{
-						auto force = request.get_optional<bool> ("force").value_or (false);
-						if (force && !rpc_config.enable_control)
-						{
-							json_error_response (response, rpc_control_disabled_ec.message ());
-							error = true;
-						}
-					}
 					// Add random id to RPC send via IPC if not included
-					else if (action == "send" && request.find ("id") == request.not_found ())
+					if (action == "send" && request.count ("id") == 0)
 					{
-						nano::uint128_union random_id;
-						nano::random_pool::generate_block (random_id.bytes.data (), random_id.bytes.size ());
-						std::string random_id_text;
-						random_id.encode_hex (random_id_text);
-						request.put ("id", random_id_text);
+						auto request_l (request.to_ptree ());
+						request_l.put ("id", random_id ());
 						std::stringstream ostream;
-						boost::property_tree::write_json (ostream, request);
+						boost::property_tree::write_json (ostream, request_l);
 						body = ostream.str ();
 					}
-				}
-
-				if (!error)
-				{
 					rpc_handler_interface.process_request (action, body, this->response);
 				}
 			}
@@ -143,6 +116,85 @@ void nano::rpc_handler::process_request (nano::rpc_handler_request_params const
 	}
 }
 
+void nano::rpc_handler::process_batch (nano::json_value const & batch)
+{
+	if (batch.empty () || batch.size () > rpc_config.max_batch_size)
+	{
+		json_error_response (response, "Invalid batch size");
+		return;
+	}
+	// The whole batch is refused if any of its actions would be
+	auto add_ids (false);
+	for (auto const & [key, request] : batch)
+	{
+		auto action = request.get<std::string> ("action");
+		log_request (request);
+		if (action == "stop")
+		{
+			json_error_response (response, "Action stop cannot be batched");
+			return;
+		}
+		if (control_disabled (request, action))
+		{
+			std::error_code rpc_control_disabled_ec = nano::error_rpc::rpc_control_disabled;
+			json_error_response (response, rpc_control_disabled_ec.message ());
+			return;
+		}
+		add_ids = add_ids || (action == "send" && request.count ("id") == 0);
+	}
+	if (add_ids)
+	{
+		boost::property_tree::ptree batch_l;
+		for (auto const & [key, request] : batch)
+		{
+			auto request_l (request.to_ptree ());
+			if (request.get<std::string> ("action") == "send" && request.count ("id") == 0)
+			{
+				request_l.put ("id", random_id ());
+			}
+			batch_l.push_back (std::make_pair ("", request_l));
+		}
+		std::stringstream ostream;
+		boost::property_tree::write_json (ostream, batch_l);
+		body = ostream.str ();
+	}
+	// Forwarded as a single IPC request, the node answers with an array of the responses in request order
+	rpc_handler_interface.process_request ("batch", body, response);
+}
+
+bool nano::rpc_handler::control_disabled (nano::json_value const & request_a, std::string const & action_a) const
+{
+	auto result (false);
+	if (!rpc_config.enable_control)
+	{
+		if (rpc_control_impl_set.find (action_a) != rpc_control_impl_set.cend ())
+		{
+			result = true;
+		}
+		// Special case with stats, type -> objects
+		else if (action_a == "stats")
+		{
+			result = request_a.get<std::string> ("type") == "objects";
+		}
+		else if (action_a == "process")
+		{
+			result = request_a.get_optional<bool> ("force").value_or (false);
+		}
+	}
+	return result;
+}
+
+void nano::rpc_handler::log_request (nano::json_value const & request_a)
+{
+	if (rpc_config.rpc_logging.log_rpc)
+	{
+		// Creating same string via stringstream as using it directly is generating a TSAN warning
+		std::stringstream ss;
+		ss << request_id;
+		logger.always_log (ss.str (), " ", filter_request (request_a.to_ptree ()));
+	}
+}
+
 namespace
 {
 std::unordered_set<std::string> create_rpc_control_impls ()
@@ -230,4 +282,13 @@ std::string filter_request (boost::property_tree::ptree tree_a)
 	}
 	return result;
 }
+
+std::string random_id ()
+{
+	nano::uint128_union random_id;
+	nano::random_pool::generate_block (random_id.bytes.data (), random_id.bytes.size ());
+	std::string random_id_text;
+	random_id.encode_hex (random_id_text);
+	return random_id_text;
+}
 }
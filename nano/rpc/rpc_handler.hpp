@@ -7,6 +7,7 @@
 
 namespace nano
 {
+class json_value;
 class rpc_config;
 class rpc_handler_interface;
 class logger_mt;
@@ -19,6 +20,12 @@ public:
 	void process_request (nano::rpc_handler_request_params const & request_params);
 
 private:
+	/** Checks every action of a batch request and forwards the batch to the node in one piece */
+	void process_batch (nano::json_value const & batch);
+	/** Whether `request` needs RPC control enabled while it is disabled */
+	bool control_disabled (nano::json_value const & request, std::string const & action) const;
+	void log_request (nano::json_value const & request);
+
 	std::string body;
 	std::string request_id;
 	boost::property_tree::ptree request;
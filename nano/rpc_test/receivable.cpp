@@ -330,6 +330,72 @@ TEST (rpc, receivable_offset_and_sorting)
 	}
 }
 
+/**
+ * Sorted requests read the receivable amount index when the node maintains it
+ */
+TEST (rpc, receivable_sorting_index)
+{
+	nano::test::system system;
+	nano::node_config node_config = system.default_config ();
+	nano::node_flags node_flags;
+	node_flags.enable_receivable_index = true;
+	auto node = add_ipc_enabled_node (system, node_config, node_flags);
+	ASSERT_TRUE (node->ledger.receivable_index);
+	nano::keypair key1;
+	system.wallet (0)->insert_adhoc (nano::dev::genesis_key.prv);
+	auto block1 = system.wallet (0)->send_action (nano::dev::genesis_key.pub, key1.pub, 200);
+	// Below the threshold used by the requests
+	ASSERT_NE (nullptr, system.wallet (0)->send_action (nano::dev::genesis_key.pub, key1.pub, 100));
+	auto block3 = system.wallet (0)->send_action (nano::dev::genesis_key.pub, key1.pub, 400);
+	ASSERT_TIMELY (5s, node->ledger.account_receivable (node->store.tx_begin_read (), key1.pub, true) == 700);
+	auto const rpc_ctx = add_rpc (system, node);
+	boost::property_tree::ptree request;
+	request.put ("action", "receivable");
+	request.put ("account", key1.pub.to_account ());
+	request.put ("sorting", "true");
+	request.put ("threshold", "150");
+	{
+		auto response (wait_response (system, rpc_ctx, request));
+		auto & blocks_node (response.get_child ("blocks"));
+		ASSERT_EQ (2, blocks_node.size ());
+		auto itr = blocks_node.begin ();
+		ASSERT_EQ (block3->hash (), nano::block_hash{ itr->first });
+		ASSERT_EQ ("400", itr->second.get<std::string> (""));
+		++itr;
+		ASSERT_EQ (block1->hash (), nano::block_hash{ itr->first });
+		ASSERT_EQ ("200", itr->second.get<std::string> (""));
+	}
+	request.put ("source", "true");
+	request.put ("count", "1");
+	request.put ("offset", "1");
+	{
+		auto response (wait_response (system, rpc_ctx, request));
+		auto & blocks_node (response.get_child ("blocks"));
+		ASSERT_EQ (1, blocks_node.size ());
+		ASSERT_EQ (block1->hash (), nano::block_hash{ blocks_node.begin ()->first });
+		ASSERT_EQ (nano::dev::genesis_key.pub.to_account (), blocks_node.begin ()->second.get<std::string> ("source"));
+	}
+
+	boost::property_tree::ptree accounts_request;
+	accounts_request.put ("action", "accounts_receivable");
+	boost::property_tree::ptree entry;
+	boost::property_tree::ptree peers_l;
+	entry.put ("", key1.pub.to_account ());
+	peers_l.push_back (std::make_pair ("", entry));
+	accounts_request.add_child ("accounts", peers_l);
+	accounts_request.put ("sorting", "true");
+	accounts_request.put ("count", "2");
+	{
+		auto response (wait_response (system, rpc_ctx, accounts_request));
+		auto & blocks_node (response.get_child ("blocks").get_child (key1.pub.to_account ()));
+		ASSERT_EQ (2, blocks_node.size ());
+		auto itr = blocks_node.begin ();
+		ASSERT_EQ (block3->hash (), nano::block_hash{ itr->first });
+		++itr;
+		ASSERT_EQ (block1->hash (), nano::block_hash{ itr->first });
+	}
+}
+
 TEST (rpc, receivable_burn)
 {
 	nano::test::system system;
@@ -450,6 +516,62 @@ TEST (rpc, accounts_receivable_sorting)
 	}
 }
 
+/**
+ * Without the receivable amount index every entry is read before sorting, `count` keeps the largest instead of the first in hash order
+ */
+TEST (rpc, accounts_receivable_sorting_count)
+{
+	nano::test::system system;
+	auto node = add_ipc_enabled_node (system);
+	ASSERT_FALSE (node->ledger.receivable_index);
+	nano::keypair key1;
+	system.wallet (0)->insert_adhoc (nano::dev::genesis_key.prv);
+	// Amounts are below receive_minimum, the wallet leaves them receivable
+	system.wallet (0)->insert_adhoc (key1.prv);
+	std::vector<std::shared_ptr<nano::block>> sends;
+	for (auto amount : { 200, 100, 400, 300 })
+	{
+		auto send = system.wallet (0)->send_action (nano::dev::genesis_key.pub, key1.pub, amount);
+		ASSERT_NE (nullptr, send);
+		sends.push_back (send);
+	}
+	ASSERT_TIMELY (5s, node->block_confirmed (sends.back ()->hash ()));
+	auto const rpc_ctx = add_rpc (system, node);
+	auto check = [&] (boost::property_tree::ptree const & blocks_node) {
+		ASSERT_EQ (2, blocks_node.size ());
+		auto itr = blocks_node.begin ();
+		ASSERT_EQ (sends[2]->hash (), nano::block_hash{ itr->first });
+		ASSERT_EQ ("400", itr->second.get<std::string> (""));
+		++itr;
+		ASSERT_EQ (sends[3]->hash (), nano::block_hash{ itr->first });
+		ASSERT_EQ ("300", itr->second.get<std::string> (""));
+	};
+
+	boost::property_tree::ptree request;
+	request.put ("action", "accounts_receivable");
+	boost::property_tree::ptree entry;
+	boost::property_tree::ptree peers_l;
+	entry.put ("", key1.pub.to_account ());
+	peers_l.push_back (std::make_pair ("", entry));
+	request.add_child ("accounts", peers_l);
+	request.put ("sorting", "true");
+	request.put ("count", "2");
+	{
+		auto response (wait_response (system, rpc_ctx, request));
+		check (response.get_child ("blocks").get_child (key1.pub.to_account ()));
+	}
+
+	boost::property_tree::ptree wallet_request;
+	wallet_request.put ("action", "wallet_receivable");
+	wallet_request.put ("wallet", node->wallets.items.begin ()->first.to_string ());
+	wallet_request.put ("sorting", "true");
+	wallet_request.put ("count", "2");
+	{
+		auto response (wait_response (system, rpc_ctx, wallet_request));
+		check (response.get_child ("blocks").get_child (key1.pub.to_account ()));
+	}
+}
+
 TEST (rpc, accounts_receivable_threshold)
 {
 	nano::test::system system;
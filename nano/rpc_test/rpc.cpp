@@ -911,6 +911,338 @@ TEST (rpc, frontier_startpoint)
 	ASSERT_EQ (source.begin ()->first.to_account (), frontiers_node.begin ()->first);
 }
 
+TEST (rpc, frontier_cursor)
+{
+	nano::test::system system;
+	auto node = add_ipc_enabled_node (system);
+	std::unordered_map<nano::account, nano::block_hash> source;
+	{
+		auto transaction (node->store.tx_begin_write ());
+		for (auto i (0); i < 1000; ++i)
+		{
+			nano::keypair key;
+			nano::block_hash hash;
+			nano::random_pool::generate_block (hash.bytes.data (), hash.bytes.size ());
+			source[key.pub] = hash;
+			node->store.confirmation_height.put (transaction, key.pub, { 0, nano::block_hash (0) });
+			node->store.account.put (transaction, key.pub, nano::account_info (hash, 0, 0, 0, 0, 0, nano::epoch::epoch_0));
+		}
+	}
+	auto const rpc_ctx = add_rpc (system, node);
+	std::unordered_map<nano::account, nano::block_hash> frontiers;
+	boost::optional<std::string> cursor;
+	auto pages (0);
+	do
+	{
+		boost::property_tree::ptree request;
+		request.put ("action", "frontiers");
+		if (cursor)
+		{
+			request.put ("cursor", *cursor);
+		}
+		else
+		{
+			request.put ("account", nano::account{}.to_account ());
+		}
+		request.put ("count", std::to_string (300));
+		auto response (wait_response (system, rpc_ctx, request));
+		for (auto & [account_text, frontier_text] : response.get_child ("frontiers"))
+		{
+			nano::account account;
+			ASSERT_FALSE (account.decode_account (account_text));
+			nano::block_hash frontier;
+			ASSERT_FALSE (frontier.decode_hex (frontier_text.get<std::string> ("")));
+			ASSERT_TRUE (frontiers.emplace (account, frontier).second);
+		}
+		cursor = response.get_optional<std::string> ("cursor");
+		++pages;
+	} while (cursor);
+	ASSERT_EQ (4, pages);
+	ASSERT_EQ (1, frontiers.erase (nano::dev::genesis_key.pub));
+	ASSERT_EQ (source, frontiers);
+	boost::property_tree::ptree request;
+	request.put ("action", "frontiers");
+	request.put ("cursor", "not a cursor");
+	request.put ("count", std::to_string (1));
+	auto response (wait_response (system, rpc_ctx, request));
+	ASSERT_EQ (std::error_code (nano::error_rpc::invalid_cursor).message (), response.get<std::string> ("error"));
+}
+
+TEST (rpc, batch)
+{
+	nano::test::system system;
+	auto node = add_ipc_enabled_node (system);
+	auto const rpc_ctx = add_rpc (system, node);
+	boost::property_tree::ptree request;
+	boost::property_tree::ptree block_count;
+	block_count.put ("action", "block_count");
+	request.push_back (std::make_pair ("", block_count));
+	boost::property_tree::ptree account_info;
+	account_info.put ("action", "account_info");
+	account_info.put ("account", nano::dev::genesis_key.pub.to_account ());
+	request.push_back (std::make_pair ("", account_info));
+	boost::property_tree::ptree invalid;
+	invalid.put ("action", "account_info");
+	invalid.put ("account", "not an account");
+	request.push_back (std::make_pair ("", invalid));
+	boost::property_tree::ptree block_info;
+	block_info.put ("action", "block_info");
+	block_info.put ("hash", nano::dev::genesis->hash ().to_string ());
+	request.push_back (std::make_pair ("", block_info));
+	auto response (wait_response (system, rpc_ctx, request));
+	// Responses come back in request order, an action failing does not fail the others
+	std::vector<boost::property_tree::ptree> responses;
+	for (auto & [key, value] : response)
+	{
+		ASSERT_TRUE (key.empty ());
+		responses.push_back (value);
+	}
+	ASSERT_EQ (4, responses.size ());
+	ASSERT_EQ ("1", responses[0].get<std::string> ("count"));
+	ASSERT_EQ (nano::dev::genesis->hash ().to_string (), responses[1].get<std::string> ("frontier"));
+	ASSERT_EQ (std::error_code (nano::error_common::bad_account_number).message (), responses[2].get<std::string> ("error"));
+	ASSERT_EQ (nano::dev::genesis_key.pub.to_account (), responses[3].get<std::string> ("block_account"));
+	// Stopping the node cannot be batched
+	boost::property_tree::ptree stop;
+	stop.put ("action", "stop");
+	request.push_back (std::make_pair ("", stop));
+	response = wait_response (system, rpc_ctx, request);
+	ASSERT_EQ ("Action stop cannot be batched", response.get<std::string> ("error"));
+	// An action needing control refuses the whole batch, the actions before it do not run either
+	boost::property_tree::ptree control_request;
+	boost::property_tree::ptree wallet_create;
+	wallet_create.put ("action", "wallet_create");
+	control_request.push_back (std::make_pair ("", wallet_create));
+	control_request.push_back (std::make_pair ("", block_count));
+	auto const wallets = node->wallets.items.size ();
+	rpc_ctx.rpc->config.enable_control = false;
+	response = wait_response (system, rpc_ctx, control_request);
+	ASSERT_EQ (std::error_code (nano::error_rpc::rpc_control_disabled).message (), response.get<std::string> ("error"));
+	ASSERT_EQ (wallets, node->wallets.items.size ());
+	rpc_ctx.rpc->config.enable_control = true;
+	// The node enforces its own limit for IPC clients
+	rpc_ctx.node_rpc_config->max_batch_size = 1;
+	response = wait_response (system, rpc_ctx, control_request);
+	ASSERT_EQ ("Invalid batch size", response.get<std::string> ("error"));
+	ASSERT_EQ (wallets, node->wallets.items.size ());
+}
+
+namespace
+{
+/** Entries of the `child` listing of a response in order, values with children are written as JSON */
+std::vector<std::pair<std::string, std::string>> listing (boost::property_tree::ptree const & response, std::string const & child)
+{
+	std::vector<std::pair<std::string, std::string>> result;
+	for (auto const & [key, value] : response.get_child (child))
+	{
+		if (value.empty ())
+		{
+			result.emplace_back (key, value.data ());
+		}
+		else
+		{
+			std::ostringstream json;
+			boost::property_tree::write_json (json, value);
+			result.emplace_back (key, json.str ());
+		}
+	}
+	return result;
+}
+
+/** Requests pages of `count` entries, passing back the cursor of each response until one has none */
+std::vector<std::pair<std::string, std::string>> listing_pages (nano::test::system & system, rpc_context const & rpc_ctx, boost::property_tree::ptree request, std::string const & child, std::size_t count, std::size_t & pages)
+{
+	std::vector<std::pair<std::string, std::string>> result;
+	request.put ("count", std::to_string (count));
+	boost::optional<std::string> cursor;
+	pages = 0;
+	do
+	{
+		if (cursor)
+		{
+			request.put ("cursor", *cursor);
+		}
+		auto response (wait_response (system, rpc_ctx, request));
+		auto page (listing (response, child));
+		EXPECT_GE (count, page.size ());
+		result.insert (result.end (), page.begin (), page.end ());
+		cursor = response.get_optional<std::string> ("cursor");
+		++pages;
+	} while (cursor && pages < 1000);
+	return result;
+}
+
+/** Opens `count` accounts from genesis which delegate to `representative`, balances repeat every four accounts */
+std::vector<nano::keypair> open_accounts (nano::node & node, std::size_t count, nano::account const & representative)
+{
+	std::vector<nano::keypair> keys (count);
+	std::vector<std::shared_ptr<nano::block>> blocks;
+	nano::block_builder builder;
+	auto latest (node.latest (nano::dev::genesis_key.pub));
+	auto balance (node.balance (nano::dev::genesis_key.pub));
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		nano::uint128_t const amount = i % 4 + 1;
+		balance -= amount;
+		auto send = builder
+					.state ()
+					.account (nano::dev::genesis_key.pub)
+					.previous (latest)
+					.representative (nano::dev::genesis_key.pub)
+					.balance (balance)
+					.link (keys[i].pub)
+					.sign (nano::dev::genesis_key.prv, nano::dev::genesis_key.pub)
+					.work (*node.work_generate_blocking (latest))
+					.build_shared ();
+		latest = send->hash ();
+		auto open = builder
+					.state ()
+					.account (keys[i].pub)
+					.previous (0)
+					.representative (representative)
+					.balance (amount)
+					.link (send->hash ())
+					.sign (keys[i].prv, keys[i].pub)
+					.work (*node.work_generate_blocking (keys[i].pub))
+					.build_shared ();
+		blocks.push_back (send);
+		blocks.push_back (open);
+	}
+	EXPECT_TRUE (nano::test::process (node, blocks));
+	return keys;
+}
+}
+
+TEST (rpc, ledger_sorting_cursor)
+{
+	nano::test::system system;
+	auto node = add_ipc_enabled_node (system);
+	open_accounts (*node, 30, nano::dev::genesis_key.pub);
+	auto const rpc_ctx = add_rpc (system, node);
+	boost::property_tree::ptree request;
+	request.put ("action", "ledger");
+	request.put ("sorting", true);
+	auto response (wait_response (system, rpc_ctx, request));
+	ASSERT_FALSE (response.get_optional<std::string> ("cursor"));
+	auto const expected (listing (response, "accounts"));
+	ASSERT_EQ (31, expected.size ());
+	// Pages end between accounts of equal balance, the cursor orders them by account
+	std::size_t pages (0);
+	ASSERT_EQ (expected, listing_pages (system, rpc_ctx, request, "accounts", 7, pages));
+	ASSERT_EQ (5, pages);
+	request.put ("cursor", nano::account{}.to_string ());
+	auto response2 (wait_response (system, rpc_ctx, request));
+	ASSERT_EQ (std::error_code (nano::error_rpc::invalid_cursor).message (), response2.get<std::string> ("error"));
+}
+
+TEST (rpc, unopened_cursor)
+{
+	nano::test::system system;
+	auto node = add_ipc_enabled_node (system);
+	{
+		auto transaction (node->store.tx_begin_write ());
+		for (auto i (0); i < 40; ++i)
+		{
+			auto const account (nano::test::random_account ());
+			for (auto j (0); j <= i % 3; ++j)
+			{
+				node->store.pending.put (transaction, nano::pending_key (account, nano::test::random_hash ()), nano::pending_info (nano::dev::genesis_key.pub, j + 1, nano::epoch::epoch_0));
+			}
+		}
+	}
+	auto const rpc_ctx = add_rpc (system, node);
+	boost::property_tree::ptree request;
+	request.put ("action", "unopened");
+	auto response (wait_response (system, rpc_ctx, request));
+	ASSERT_FALSE (response.get_optional<std::string> ("cursor"));
+	auto const expected (listing (response, "accounts"));
+	ASSERT_EQ (40, expected.size ());
+	std::size_t pages (0);
+	ASSERT_EQ (expected, listing_pages (system, rpc_ctx, request, "accounts", 7, pages));
+	ASSERT_LE (6, pages);
+}
+
+TEST (rpc, delegators_cursor)
+{
+	for (auto index : { false, true })
+	{
+		nano::test::system system;
+		nano::node_config node_config = system.default_config ();
+		nano::node_flags node_flags;
+		node_flags.enable_delegators_index = index;
+		auto node = add_ipc_enabled_node (system, node_config, node_flags);
+		ASSERT_EQ (index, node->ledger.delegators_index);
+		nano::keypair representative;
+		open_accounts (*node, 30, representative.pub);
+		auto const rpc_ctx = add_rpc (system, node);
+		boost::property_tree::ptree request;
+		request.put ("action", "delegators");
+		request.put ("account", representative.pub.to_account ());
+		auto response (wait_response (system, rpc_ctx, request));
+		ASSERT_FALSE (response.get_optional<std::string> ("cursor"));
+		auto const expected (listing (response, "delegators"));
+		ASSERT_EQ (30, expected.size ());
+		std::size_t pages (0);
+		ASSERT_EQ (expected, listing_pages (system, rpc_ctx, request, "delegators", 7, pages));
+		ASSERT_LE (5, pages);
+	}
+}
+
+TEST (rpc, wallet_history_cursor)
+{
+	nano::test::system system;
+	auto node = add_ipc_enabled_node (system);
+	system.wallet (0)->insert_adhoc (nano::dev::genesis_key.prv);
+	for (auto const & key : open_accounts (*node, 10, nano::dev::genesis_key.pub))
+	{
+		system.wallet (0)->insert_adhoc (key.prv);
+	}
+	auto const rpc_ctx = add_rpc (system, node);
+	boost::property_tree::ptree request;
+	request.put ("action", "wallet_history");
+	request.put ("wallet", node->wallets.items.begin ()->first.to_string ());
+	auto response (wait_response (system, rpc_ctx, request));
+	ASSERT_FALSE (response.get_optional<std::string> ("cursor"));
+	auto const expected (listing (response, "history"));
+	// A send and an open per account besides genesis
+	ASSERT_EQ (21, expected.size ());
+	std::size_t pages (0);
+	ASSERT_EQ (expected, listing_pages (system, rpc_ctx, request, "history", 3, pages));
+	ASSERT_EQ (7, pages);
+	request.put ("cursor", nano::block_hash{ 1 }.to_string ());
+	auto response2 (wait_response (system, rpc_ctx, request));
+	ASSERT_EQ (std::error_code (nano::error_rpc::invalid_cursor).message (), response2.get<std::string> ("error"));
+}
+
+TEST (rpc, listing_count_limit)
+{
+	nano::test::system system;
+	auto node = add_ipc_enabled_node (system);
+	open_accounts (*node, 10, nano::dev::genesis_key.pub);
+	auto const rpc_ctx = add_rpc (system, node);
+	boost::property_tree::ptree request;
+	request.put ("action", "ledger");
+	auto response (wait_response (system, rpc_ctx, request));
+	auto const expected (listing (response, "accounts"));
+	ASSERT_EQ (11, expected.size ());
+	// Requests without a count are limited by the node and continue through their cursor like any other
+	rpc_ctx.node_rpc_config->max_listing_count = 4;
+	auto limited (wait_response (system, rpc_ctx, request));
+	ASSERT_EQ (4, listing (limited, "accounts").size ());
+	ASSERT_TRUE (limited.get_optional<std::string> ("cursor"));
+	// Larger counts are limited the same way
+	std::size_t pages (0);
+	ASSERT_EQ (expected, listing_pages (system, rpc_ctx, request, "accounts", 100, pages));
+	ASSERT_EQ (3, pages);
+	boost::property_tree::ptree frontiers;
+	frontiers.put ("action", "frontiers");
+	frontiers.put ("account", nano::account{}.to_account ());
+	frontiers.put ("count", "100");
+	auto response2 (wait_response (system, rpc_ctx, frontiers));
+	ASSERT_EQ (4, listing (response2, "frontiers").size ());
+	ASSERT_TRUE (response2.get_optional<std::string> ("cursor"));
+}
+
 TEST (rpc, history)
 {
 	nano::test::system system;
@@ -5818,6 +6150,15 @@ TEST (rpc, memory_stats)
 		auto response (wait_response (system, rpc_ctx, request));
 		ASSERT_TRUE (!response.empty ());
 	}
+
+	node->store.instrumentation.enable (true);
+	ASSERT_TRUE (node->ledger.block_or_pruned_exists (nano::dev::genesis->hash ()));
+	request.put ("type", "store");
+	{
+		auto response (wait_response (system, rpc_ctx, request));
+		ASSERT_EQ ("true", response.get<std::string> ("enabled"));
+		ASSERT_LE (1, response.get<uint64_t> ("tables.blocks.get.count"));
+	}
 }
 
 TEST (rpc, block_confirmed)
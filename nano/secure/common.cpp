@@ -232,6 +232,17 @@ nano::account_info::account_info (nano::block_hash const & head_a, nano::account
 {
 }
 
+void nano::account_info::serialize (nano::stream & stream_a) const
+{
+	nano::write (stream_a, head.bytes);
+	nano::write (stream_a, representative.bytes);
+	nano::write (stream_a, open_block.bytes);
+	nano::write (stream_a, balance.bytes);
+	nano::write (stream_a, modified);
+	nano::write (stream_a, block_count);
+	nano::write (stream_a, epoch_m);
+}
+
 bool nano::account_info::deserialize (nano::stream & stream_a)
 {
 	auto error (false);
@@ -287,6 +298,13 @@ nano::pending_info::pending_info (nano::account const & source_a, nano::amount c
 {
 }
 
+void nano::pending_info::serialize (nano::stream & stream_a) const
+{
+	nano::write (stream_a, source.bytes);
+	nano::write (stream_a, amount.bytes);
+	nano::write (stream_a, epoch);
+}
+
 bool nano::pending_info::deserialize (nano::stream & stream_a)
 {
 	auto error (false);
@@ -320,6 +338,12 @@ nano::pending_key::pending_key (nano::account const & account_a, nano::block_has
 {
 }
 
+void nano::pending_key::serialize (nano::stream & stream_a) const
+{
+	nano::write (stream_a, account.bytes);
+	nano::write (stream_a, hash.bytes);
+}
+
 bool nano::pending_key::deserialize (nano::stream & stream_a)
 {
 	auto error (false);
@@ -346,6 +370,34 @@ nano::account const & nano::pending_key::key () const
 	return account;
 }
 
+nano::delegator_key::delegator_key (nano::account const & representative_a, nano::account const & account_a) :
+	representative (representative_a),
+	account (account_a)
+{
+}
+
+bool nano::delegator_key::operator== (nano::delegator_key const & other_a) const
+{
+	return representative == other_a.representative && account == other_a.account;
+}
+
+nano::receivable_amount_key::receivable_amount_key (nano::account const & account_a, nano::amount const & amount_a, nano::block_hash const & hash_a) :
+	account (account_a),
+	amount_complement (~amount_a.number ()),
+	hash (hash_a)
+{
+}
+
+bool nano::receivable_amount_key::operator== (nano::receivable_amount_key const & other_a) const
+{
+	return account == other_a.account && amount_complement == other_a.amount_complement && hash == other_a.hash;
+}
+
+nano::amount nano::receivable_amount_key::amount () const
+{
+	return ~amount_complement.number ();
+}
+
 nano::unchecked_info::unchecked_info (std::shared_ptr<nano::block> const & block_a) :
 	block (block_a),
 	modified_m (nano::seconds_since_epoch ())
@@ -105,6 +105,7 @@ class account_info final
 public:
 	account_info () = default;
 	account_info (nano::block_hash const &, nano::account const &, nano::block_hash const &, nano::amount const &, nano::seconds_t modified, uint64_t, epoch);
+	void serialize (nano::stream &) const;
 	bool deserialize (nano::stream &);
 	bool operator== (nano::account_info const &) const;
 	bool operator!= (nano::account_info const &) const;
@@ -129,6 +130,7 @@ public:
 	pending_info () = default;
 	pending_info (nano::account const &, nano::amount const &, nano::epoch);
 	size_t db_size () const;
+	void serialize (nano::stream &) const;
 	bool deserialize (nano::stream &);
 	bool operator== (nano::pending_info const &) const;
 	nano::account source{};
@@ -140,12 +142,40 @@ class pending_key final
 public:
 	pending_key () = default;
 	pending_key (nano::account const &, nano::block_hash const &);
+	void serialize (nano::stream &) const;
 	bool deserialize (nano::stream &);
 	bool operator== (nano::pending_key const &) const;
 	nano::account const & key () const;
 	nano::account account{};
 	nano::block_hash hash{ 0 };
 };
+/**
+ * Key of the representative to delegators index, keys are ordered by representative so the delegators of one representative are adjacent
+ */
+class delegator_key final
+{
+public:
+	delegator_key () = default;
+	delegator_key (nano::account const &, nano::account const &);
+	bool operator== (nano::delegator_key const &) const;
+	nano::account representative{};
+	nano::account account{};
+};
+/**
+ * Key of the receivable amount index, the receivable entries of an account are adjacent and ordered by descending amount.
+ * The amount is stored complemented so the largest amounts sort first.
+ */
+class receivable_amount_key final
+{
+public:
+	receivable_amount_key () = default;
+	receivable_amount_key (nano::account const &, nano::amount const &, nano::block_hash const &);
+	bool operator== (nano::receivable_amount_key const &) const;
+	nano::amount amount () const;
+	nano::account account{};
+	nano::amount amount_complement{};
+	nano::block_hash hash{ 0 };
+};
 
 class endpoint_key final
 {
@@ -1,3 +1,4 @@
+#include <nano/lib/locks.hpp>
 #include <nano/lib/rep_weights.hpp>
 #include <nano/lib/stats.hpp>
 #include <nano/lib/utility.hpp>
@@ -9,16 +10,24 @@
 #include <nano/store/block.hpp>
 #include <nano/store/component.hpp>
 #include <nano/store/confirmation_height.hpp>
+#include <nano/store/delegator.hpp>
 #include <nano/store/final.hpp>
 #include <nano/store/frontier.hpp>
 #include <nano/store/online_weight.hpp>
 #include <nano/store/peer.hpp>
 #include <nano/store/pending.hpp>
 #include <nano/store/pruned.hpp>
+#include <nano/store/receivable_amount.hpp>
 #include <nano/store/version.hpp>
+#include <nano/store/views.hpp>
+
+#include <boost/format.hpp>
 
 #include <cryptopp/words.h>
 
+#include <atomic>
+#include <chrono>
+
 namespace
 {
 /**
@@ -47,7 +56,7 @@ public:
 		{
 			auto info = ledger.account_info (transaction, pending.source);
 			debug_assert (info);
-			ledger.store.pending.del (transaction, key);
+			ledger.pending_del (transaction, key);
 			ledger.cache.rep_weights.representation_add (info->representative, pending.amount.number ());
 			nano::account_info new_info (block_a.hashables.previous, info->representative, info->open_block, ledger.balance (transaction, block_a.hashables.previous), nano::seconds_since_epoch (), info->block_count - 1, nano::epoch::epoch_0);
 			ledger.update_account (transaction, pending.source, *info, new_info);
@@ -72,7 +81,7 @@ public:
 		nano::account_info new_info (block_a.hashables.previous, info->representative, info->open_block, ledger.balance (transaction, block_a.hashables.previous), nano::seconds_since_epoch (), info->block_count - 1, nano::epoch::epoch_0);
 		ledger.update_account (transaction, destination_account, *info, new_info);
 		ledger.store.block.del (transaction, hash);
-		ledger.store.pending.put (transaction, nano::pending_key (destination_account, block_a.hashables.source), { source_account, amount, nano::epoch::epoch_0 });
+		ledger.pending_put (transaction, nano::pending_key (destination_account, block_a.hashables.source), { source_account, amount, nano::epoch::epoch_0 });
 		ledger.store.frontier.del (transaction, hash);
 		ledger.store.frontier.put (transaction, block_a.hashables.previous, destination_account);
 		ledger.store.block.successor_clear (transaction, block_a.hashables.previous);
@@ -87,10 +96,12 @@ public:
 		[[maybe_unused]] bool is_pruned (false);
 		auto source_account (ledger.account_safe (transaction, block_a.hashables.source, is_pruned));
 		ledger.cache.rep_weights.representation_add (block_a.representative (), 0 - amount);
+		auto info = ledger.account_info (transaction, destination_account);
+		debug_assert (info);
 		nano::account_info new_info;
-		ledger.update_account (transaction, destination_account, new_info, new_info);
+		ledger.update_account (transaction, destination_account, *info, new_info);
 		ledger.store.block.del (transaction, hash);
-		ledger.store.pending.put (transaction, nano::pending_key (destination_account, block_a.hashables.source), { source_account, amount, nano::epoch::epoch_0 });
+		ledger.pending_put (transaction, nano::pending_key (destination_account, block_a.hashables.source), { source_account, amount, nano::epoch::epoch_0 });
 		ledger.store.frontier.del (transaction, hash);
 		ledger.stats.inc (nano::stat::type::rollback, nano::stat::detail::open);
 	}
@@ -149,7 +160,7 @@ public:
 			{
 				error = ledger.rollback (transaction, ledger.latest (transaction, block_a.hashables.link.as_account ()), list);
 			}
-			ledger.store.pending.del (transaction, key);
+			ledger.pending_del (transaction, key);
 			ledger.stats.inc (nano::stat::type::rollback, nano::stat::detail::send);
 		}
 		else if (!block_a.hashables.link.is_zero () && !ledger.is_epoch_link (block_a.hashables.link))
@@ -158,7 +169,7 @@ public:
 			[[maybe_unused]] bool is_pruned (false);
 			auto source_account (ledger.account_safe (transaction, block_a.hashables.link.as_block_hash (), is_pruned));
 			nano::pending_info pending_info (source_account, block_a.hashables.balance.number () - balance, block_a.sideband ().source_epoch);
-			ledger.store.pending.put (transaction, nano::pending_key (block_a.hashables.account, block_a.hashables.link.as_block_hash ()), pending_info);
+			ledger.pending_put (transaction, nano::pending_key (block_a.hashables.account, block_a.hashables.link.as_block_hash ()), pending_info);
 			ledger.stats.inc (nano::stat::type::rollback, nano::stat::detail::receive);
 		}
 
@@ -191,7 +202,7 @@ public:
 class ledger_processor : public nano::mutable_block_visitor
 {
 public:
-	ledger_processor (nano::ledger &, nano::store::write_transaction const &);
+	ledger_processor (nano::ledger &, nano::store::write_transaction const &, nano::block_verification const &);
 	virtual ~ledger_processor () = default;
 	void send_block (nano::send_block &) override;
 	void receive_block (nano::receive_block &) override;
@@ -206,8 +217,27 @@ public:
 
 private:
 	bool validate_epoch_block (nano::state_block const & block_a);
+	/** Whether `signer` did not sign the block, trusting an earlier verification by the same signer */
+	bool invalid_signature (nano::account const & signer, nano::block_hash const & hash, nano::signature const & signature) const;
+	/** Work difficulty of the block, reusing an earlier computation */
+	uint64_t difficulty (nano::block const & block_a) const;
+	nano::block_verification const & verification;
 };
 
+bool ledger_processor::invalid_signature (nano::account const & signer, nano::block_hash const & hash, nano::signature const & signature) const
+{
+	if (!verification.signer.is_zero () && verification.signer == signer)
+	{
+		return false;
+	}
+	return validate_message (signer, hash, signature);
+}
+
+uint64_t ledger_processor::difficulty (nano::block const & block_a) const
+{
+	return verification.difficulty != 0 ? verification.difficulty : ledger.constants.work.difficulty (block_a);
+}
+
 // Returns true if this block which has an epoch link is correctly formed.
 bool ledger_processor::validate_epoch_block (nano::state_block const & block_a)
 {
@@ -223,10 +253,10 @@ bool ledger_processor::validate_epoch_block (nano::state_block const & block_a)
 		else
 		{
 			// Check for possible regular state blocks with epoch link (send subtype)
-			if (validate_message (block_a.hashables.account, block_a.hash (), block_a.signature))
+			if (invalid_signature (block_a.hashables.account, block_a.hash (), block_a.signature))
 			{
 				// Is epoch block signed correctly
-				if (validate_message (ledger.epoch_signer (block_a.link ()), block_a.hash (), block_a.signature))
+				if (invalid_signature (ledger.epoch_signer (block_a.link ()), block_a.hash (), block_a.signature))
 				{
 					result.code = nano::process_result::bad_signature;
 				}
@@ -266,7 +296,7 @@ void ledger_processor::state_block_impl (nano::state_block & block_a)
 	result.code = existing ? nano::process_result::old : nano::process_result::progress; // Have we seen this block before? (Unambiguous)
 	if (result.code == nano::process_result::progress)
 	{
-		result.code = validate_message (block_a.hashables.account, hash, block_a.signature) ? nano::process_result::bad_signature : nano::process_result::progress; // Is this block signed correctly (Unambiguous)
+		result.code = invalid_signature (block_a.hashables.account, hash, block_a.signature) ? nano::process_result::bad_signature : nano::process_result::progress; // Is this block signed correctly (Unambiguous)
 		if (result.code == nano::process_result::progress)
 		{
 			debug_assert (!validate_message (block_a.hashables.account, hash, block_a.signature));
@@ -337,7 +367,7 @@ void ledger_processor::state_block_impl (nano::state_block & block_a)
 				if (result.code == nano::process_result::progress)
 				{
 					nano::block_details block_details (epoch, is_send, is_receive, false);
-					result.code = ledger.constants.work.difficulty (block_a) >= ledger.constants.work.threshold (block_a.work_version (), block_details) ? nano::process_result::progress : nano::process_result::insufficient_work; // Does this block have sufficient work? (Malformed)
+					result.code = difficulty (block_a) >= ledger.constants.work.threshold (block_a.work_version (), block_details) ? nano::process_result::progress : nano::process_result::insufficient_work; // Does this block have sufficient work? (Malformed)
 					if (result.code == nano::process_result::progress)
 					{
 						ledger.stats.inc (nano::stat::type::ledger, nano::stat::detail::state_block);
@@ -359,11 +389,11 @@ void ledger_processor::state_block_impl (nano::state_block & block_a)
 						{
 							nano::pending_key key (block_a.hashables.link.as_account (), hash);
 							nano::pending_info info (block_a.hashables.account, amount.number (), epoch);
-							ledger.store.pending.put (transaction, key, info);
+							ledger.pending_put (transaction, key, info);
 						}
 						else if (!block_a.hashables.link.is_zero ())
 						{
-							ledger.store.pending.del (transaction, nano::pending_key (block_a.hashables.account, block_a.hashables.link.as_block_hash ()));
+							ledger.pending_del (transaction, nano::pending_key (block_a.hashables.account, block_a.hashables.link.as_block_hash ()));
 						}
 
 						nano::account_info new_info (hash, block_a.representative (), info.open_block.is_zero () ? hash : info.open_block, block_a.hashables.balance, nano::seconds_since_epoch (), info.block_count + 1, epoch);
@@ -386,7 +416,7 @@ void ledger_processor::epoch_block_impl (nano::state_block & block_a)
 	result.code = existing ? nano::process_result::old : nano::process_result::progress; // Have we seen this block before? (Unambiguous)
 	if (result.code == nano::process_result::progress)
 	{
-		result.code = validate_message (ledger.epoch_signer (block_a.hashables.link), hash, block_a.signature) ? nano::process_result::bad_signature : nano::process_result::progress; // Is this block signed correctly (Unambiguous)
+		result.code = invalid_signature (ledger.epoch_signer (block_a.hashables.link), hash, block_a.signature) ? nano::process_result::bad_signature : nano::process_result::progress; // Is this block signed correctly (Unambiguous)
 		if (result.code == nano::process_result::progress)
 		{
 			debug_assert (!validate_message (ledger.epoch_signer (block_a.hashables.link), hash, block_a.signature));
@@ -430,7 +460,7 @@ void ledger_processor::epoch_block_impl (nano::state_block & block_a)
 						if (result.code == nano::process_result::progress)
 						{
 							nano::block_details block_details (epoch, false, false, true);
-							result.code = ledger.constants.work.difficulty (block_a) >= ledger.constants.work.threshold (block_a.work_version (), block_details) ? nano::process_result::progress : nano::process_result::insufficient_work; // Does this block have sufficient work? (Malformed)
+							result.code = difficulty (block_a) >= ledger.constants.work.threshold (block_a.work_version (), block_details) ? nano::process_result::progress : nano::process_result::insufficient_work; // Does this block have sufficient work? (Malformed)
 							if (result.code == nano::process_result::progress)
 							{
 								ledger.stats.inc (nano::stat::type::ledger, nano::stat::detail::epoch_block);
@@ -472,11 +502,11 @@ void ledger_processor::change_block (nano::change_block & block_a)
 					auto info = ledger.account_info (transaction, account);
 					debug_assert (info);
 					debug_assert (info->head == block_a.hashables.previous);
-					result.code = validate_message (account, hash, block_a.signature) ? nano::process_result::bad_signature : nano::process_result::progress; // Is this block signed correctly (Malformed)
+					result.code = invalid_signature (account, hash, block_a.signature) ? nano::process_result::bad_signature : nano::process_result::progress; // Is this block signed correctly (Malformed)
 					if (result.code == nano::process_result::progress)
 					{
 						nano::block_details block_details (nano::epoch::epoch_0, false /* unused */, false /* unused */, false /* unused */);
-						result.code = ledger.constants.work.difficulty (block_a) >= ledger.constants.work.threshold (block_a.work_version (), block_details) ? nano::process_result::progress : nano::process_result::insufficient_work; // Does this block have sufficient work? (Malformed)
+						result.code = difficulty (block_a) >= ledger.constants.work.threshold (block_a.work_version (), block_details) ? nano::process_result::progress : nano::process_result::insufficient_work; // Does this block have sufficient work? (Malformed)
 						if (result.code == nano::process_result::progress)
 						{
 							debug_assert (!validate_message (account, hash, block_a.signature));
@@ -515,11 +545,11 @@ void ledger_processor::send_block (nano::send_block & block_a)
 				result.code = account.is_zero () ? nano::process_result::fork : nano::process_result::progress;
 				if (result.code == nano::process_result::progress)
 				{
-					result.code = validate_message (account, hash, block_a.signature) ? nano::process_result::bad_signature : nano::process_result::progress; // Is this block signed correctly (Malformed)
+					result.code = invalid_signature (account, hash, block_a.signature) ? nano::process_result::bad_signature : nano::process_result::progress; // Is this block signed correctly (Malformed)
 					if (result.code == nano::process_result::progress)
 					{
 						nano::block_details block_details (nano::epoch::epoch_0, false /* unused */, false /* unused */, false /* unused */);
-						result.code = ledger.constants.work.difficulty (block_a) >= ledger.constants.work.threshold (block_a.work_version (), block_details) ? nano::process_result::progress : nano::process_result::insufficient_work; // Does this block have sufficient work? (Malformed)
+						result.code = difficulty (block_a) >= ledger.constants.work.threshold (block_a.work_version (), block_details) ? nano::process_result::progress : nano::process_result::insufficient_work; // Does this block have sufficient work? (Malformed)
 						if (result.code == nano::process_result::progress)
 						{
 							debug_assert (!validate_message (account, hash, block_a.signature));
@@ -535,7 +565,7 @@ void ledger_processor::send_block (nano::send_block & block_a)
 								ledger.store.block.put (transaction, hash, block_a);
 								nano::account_info new_info (hash, info->representative, info->open_block, block_a.hashables.balance, nano::seconds_since_epoch (), info->block_count + 1, nano::epoch::epoch_0);
 								ledger.update_account (transaction, account, *info, new_info);
-								ledger.store.pending.put (transaction, nano::pending_key (block_a.hashables.destination, hash), { account, amount, nano::epoch::epoch_0 });
+								ledger.pending_put (transaction, nano::pending_key (block_a.hashables.destination, hash), { account, amount, nano::epoch::epoch_0 });
 								ledger.store.frontier.del (transaction, block_a.hashables.previous);
 								ledger.store.frontier.put (transaction, hash, account);
 								ledger.stats.inc (nano::stat::type::ledger, nano::stat::detail::send);
@@ -566,7 +596,7 @@ void ledger_processor::receive_block (nano::receive_block & block_a)
 				result.code = account.is_zero () ? nano::process_result::gap_previous : nano::process_result::progress; // Have we seen the previous block? No entries for account at all (Harmless)
 				if (result.code == nano::process_result::progress)
 				{
-					result.code = validate_message (account, hash, block_a.signature) ? nano::process_result::bad_signature : nano::process_result::progress; // Is the signature valid (Malformed)
+					result.code = invalid_signature (account, hash, block_a.signature) ? nano::process_result::bad_signature : nano::process_result::progress; // Is the signature valid (Malformed)
 					if (result.code == nano::process_result::progress)
 					{
 						debug_assert (!validate_message (account, hash, block_a.signature));
@@ -587,7 +617,7 @@ void ledger_processor::receive_block (nano::receive_block & block_a)
 									if (result.code == nano::process_result::progress)
 									{
 										nano::block_details block_details (nano::epoch::epoch_0, false /* unused */, false /* unused */, false /* unused */);
-										result.code = ledger.constants.work.difficulty (block_a) >= ledger.constants.work.threshold (block_a.work_version (), block_details) ? nano::process_result::progress : nano::process_result::insufficient_work; // Does this block have sufficient work? (Malformed)
+										result.code = difficulty (block_a) >= ledger.constants.work.threshold (block_a.work_version (), block_details) ? nano::process_result::progress : nano::process_result::insufficient_work; // Does this block have sufficient work? (Malformed)
 										if (result.code == nano::process_result::progress)
 										{
 											auto new_balance (info->balance.number () + pending.amount.number ());
@@ -598,7 +628,7 @@ void ledger_processor::receive_block (nano::receive_block & block_a)
 												debug_assert (info);
 											}
 #endif
-											ledger.store.pending.del (transaction, key);
+											ledger.pending_del (transaction, key);
 											block_a.sideband_set (nano::block_sideband (account, 0, new_balance, info->block_count + 1, nano::seconds_since_epoch (), block_details, nano::epoch::epoch_0 /* unused */));
 											ledger.store.block.put (transaction, hash, block_a);
 											nano::account_info new_info (hash, info->representative, info->open_block, new_balance, nano::seconds_since_epoch (), info->block_count + 1, nano::epoch::epoch_0);
@@ -630,7 +660,7 @@ void ledger_processor::open_block (nano::open_block & block_a)
 	result.code = existing ? nano::process_result::old : nano::process_result::progress; // Have we seen this block already? (Harmless)
 	if (result.code == nano::process_result::progress)
 	{
-		result.code = validate_message (block_a.hashables.account, hash, block_a.signature) ? nano::process_result::bad_signature : nano::process_result::progress; // Is the signature valid (Malformed)
+		result.code = invalid_signature (block_a.hashables.account, hash, block_a.signature) ? nano::process_result::bad_signature : nano::process_result::progress; // Is the signature valid (Malformed)
 		if (result.code == nano::process_result::progress)
 		{
 			debug_assert (!validate_message (block_a.hashables.account, hash, block_a.signature));
@@ -653,7 +683,7 @@ void ledger_processor::open_block (nano::open_block & block_a)
 							if (result.code == nano::process_result::progress)
 							{
 								nano::block_details block_details (nano::epoch::epoch_0, false /* unused */, false /* unused */, false /* unused */);
-								result.code = ledger.constants.work.difficulty (block_a) >= ledger.constants.work.threshold (block_a.work_version (), block_details) ? nano::process_result::progress : nano::process_result::insufficient_work; // Does this block have sufficient work? (Malformed)
+								result.code = difficulty (block_a) >= ledger.constants.work.threshold (block_a.work_version (), block_details) ? nano::process_result::progress : nano::process_result::insufficient_work; // Does this block have sufficient work? (Malformed)
 								if (result.code == nano::process_result::progress)
 								{
 #ifdef NDEBUG
@@ -664,7 +694,7 @@ void ledger_processor::open_block (nano::open_block & block_a)
 										debug_assert (!error);
 									}
 #endif
-									ledger.store.pending.del (transaction, key);
+									ledger.pending_del (transaction, key);
 									block_a.sideband_set (nano::block_sideband (block_a.hashables.account, 0, pending.amount, 1, nano::seconds_since_epoch (), block_details, nano::epoch::epoch_0 /* unused */));
 									ledger.store.block.put (transaction, hash, block_a);
 									nano::account_info new_info (hash, block_a.representative (), hash, pending.amount.number (), nano::seconds_since_epoch (), 1, nano::epoch::epoch_0);
@@ -682,9 +712,10 @@ void ledger_processor::open_block (nano::open_block & block_a)
 	}
 }
 
-ledger_processor::ledger_processor (nano::ledger & ledger_a, nano::store::write_transaction const & transaction_a) :
+ledger_processor::ledger_processor (nano::ledger & ledger_a, nano::store::write_transaction const & transaction_a, nano::block_verification const & verification_a) :
 	ledger (ledger_a),
-	transaction (transaction_a)
+	transaction (transaction_a),
+	verification (verification_a)
 {
 }
 
@@ -773,12 +804,12 @@ void nano::ledger::initialize (nano::generate_cache const & generate_cache_a)
 			uint64_t block_count_l{ 0 };
 			uint64_t account_count_l{ 0 };
 			decltype (this->cache.rep_weights) rep_weights_l;
-			for (; i != n; ++i)
+			for (store::view_iterator<nano::account, nano::account_info> j{ std::move (i) }; j != n; ++j)
 			{
-				nano::account_info const & info (i->second);
-				block_count_l += info.block_count;
+				store::account_info_view const info{ j.view ().value };
+				block_count_l += info.block_count ();
 				++account_count_l;
-				rep_weights_l.representation_add (info.representative, info.balance.number ());
+				rep_weights_l.representation_add (info.representative (), info.balance ().number ());
 			}
 			this->cache.block_count += block_count_l;
 			this->cache.account_count += account_count_l;
@@ -791,9 +822,9 @@ void nano::ledger::initialize (nano::generate_cache const & generate_cache_a)
 		store.confirmation_height.for_each_par (
 		[this] (store::read_transaction const & /*unused*/, store::iterator<nano::account, nano::confirmation_height_info> i, store::iterator<nano::account, nano::confirmation_height_info> n) {
 			uint64_t cemented_count_l (0);
-			for (; i != n; ++i)
+			for (store::view_iterator<nano::account, nano::confirmation_height_info> j{ std::move (i) }; j != n; ++j)
 			{
-				cemented_count_l += i->second.height;
+				cemented_count_l += store::confirmation_height_info_view{ j.view ().value }.height ();
 			}
 			this->cache.cemented_count += cemented_count_l;
 		});
@@ -915,9 +946,14 @@ std::optional<nano::pending_info> nano::ledger::pending_info (store::transaction
 }
 
 nano::process_return nano::ledger::process (store::write_transaction const & transaction_a, nano::block & block_a)
+{
+	return process (transaction_a, block_a, nano::block_verification{});
+}
+
+nano::process_return nano::ledger::process (store::write_transaction const & transaction_a, nano::block & block_a, nano::block_verification const & verification_a)
 {
 	debug_assert (!constants.work.validate_entry (block_a) || constants.genesis == nano::dev::genesis);
-	ledger_processor processor (*this, transaction_a);
+	ledger_processor processor (*this, transaction_a, verification_a);
 	block_a.visit (processor);
 	if (processor.result.code == nano::process_result::progress)
 	{
@@ -1407,6 +1443,98 @@ void nano::ledger::update_account (store::write_transaction const & transaction_
 		debug_assert (cache.account_count > 0);
 		--cache.account_count;
 	}
+	if (delegators_index)
+	{
+		update_delegators_index (transaction_a, account_a, old_a, new_a);
+	}
+}
+
+void nano::ledger::update_delegators_index (store::write_transaction const & transaction_a, nano::account const & account_a, nano::account_info const & old_a, nano::account_info const & new_a)
+{
+	auto const existed = !old_a.head.is_zero ();
+	auto const exists = !new_a.head.is_zero ();
+	if (existed && exists && old_a.representative == new_a.representative)
+	{
+		return;
+	}
+	if (existed)
+	{
+		store.delegator.del (transaction_a, nano::delegator_key{ old_a.representative, account_a });
+	}
+	if (exists)
+	{
+		store.delegator.put (transaction_a, nano::delegator_key{ new_a.representative, account_a });
+	}
+}
+
+uint64_t nano::ledger::delegators_index_set (bool enable_a)
+{
+	uint64_t built{ 0 };
+	auto transaction (store.tx_begin_write ({ tables::delegators }));
+	auto const empty = store.delegator.begin (transaction) == store.delegator.end ();
+	if (enable_a && empty)
+	{
+		// Built in a single transaction so an interrupted build never leaves a partial index behind
+		store::view_iterator<nano::account, nano::account_info> i{ store.account.begin (transaction) };
+		for (auto n (store.account.end ()); i != n; ++i, ++built)
+		{
+			auto const view (i.view ());
+			store.delegator.put (transaction, nano::delegator_key{ store::account_info_view{ view.value }.representative (), view.key_as<nano::account> () });
+		}
+	}
+	else if (!enable_a && !empty)
+	{
+		store.delegator.clear (transaction);
+	}
+	delegators_index = enable_a;
+	return built;
+}
+
+void nano::ledger::pending_put (store::write_transaction const & transaction_a, nano::pending_key const & key_a, nano::pending_info const & info_a)
+{
+	store.pending.put (transaction_a, key_a, info_a);
+	if (receivable_index)
+	{
+		store.receivable_amount.put (transaction_a, nano::receivable_amount_key{ key_a.account, info_a.amount, key_a.hash });
+	}
+}
+
+void nano::ledger::pending_del (store::write_transaction const & transaction_a, nano::pending_key const & key_a)
+{
+	if (receivable_index)
+	{
+		auto const info = pending_info (transaction_a, key_a);
+		debug_assert (info);
+		if (info)
+		{
+			store.receivable_amount.del (transaction_a, nano::receivable_amount_key{ key_a.account, info->amount, key_a.hash });
+		}
+	}
+	store.pending.del (transaction_a, key_a);
+}
+
+uint64_t nano::ledger::receivable_index_set (bool enable_a)
+{
+	uint64_t built{ 0 };
+	auto transaction (store.tx_begin_write ({ tables::receivable_amounts }));
+	auto const empty = store.receivable_amount.begin (transaction) == store.receivable_amount.end ();
+	if (enable_a && empty)
+	{
+		// Built in a single transaction so an interrupted build never leaves a partial index behind
+		store::view_iterator<nano::pending_key, nano::pending_info> i{ store.pending.begin (transaction) };
+		for (auto n (store.pending.end ()); i != n; ++i, ++built)
+		{
+			auto const view (i.view ());
+			auto const key (view.key_as<nano::pending_key> ());
+			store.receivable_amount.put (transaction, nano::receivable_amount_key{ key.account, store::pending_info_view{ view.value }.amount (), key.hash });
+		}
+	}
+	else if (!enable_a && !empty)
+	{
+		store.receivable_amount.clear (transaction);
+	}
+	receivable_index = enable_a;
+	return built;
 }
 
 std::shared_ptr<nano::block> nano::ledger::successor (store::transaction const & transaction_a, nano::qualified_root const & root_a)
@@ -1551,7 +1679,116 @@ std::multimap<uint64_t, nano::uncemented_info, std::greater<>> nano::ledger::unc
 }
 
 // A precondition is that the store is an LMDB store
-bool nano::ledger::migrate_lmdb_to_rocksdb (std::filesystem::path const & data_path_a) const
+namespace
+{
+/** Prints the number of migrated records at most every few seconds, shared by all migration threads */
+class migration_progress final
+{
+public:
+	explicit migration_progress (std::ostream & stream_a) :
+		stream{ stream_a }
+	{
+	}
+
+	void add (nano::tables table, uint64_t count)
+	{
+		nano::lock_guard<nano::mutex> guard{ mutex };
+		migrated += count;
+		auto now = std::chrono::steady_clock::now ();
+		if (now - last_report >= report_interval)
+		{
+			last_report = now;
+			stream << boost::str (boost::format ("Migrating %1%, %2% records done") % table_name (table) % migrated) << std::endl;
+		}
+	}
+
+	void table_done (nano::tables table, uint64_t count, std::chrono::steady_clock::duration duration)
+	{
+		nano::lock_guard<nano::mutex> guard{ mutex };
+		stream << boost::str (boost::format ("Migrated %1% %2% records in %3% seconds") % count % table_name (table) % std::chrono::duration_cast<std::chrono::seconds> (duration).count ()) << std::endl;
+	}
+
+private:
+	static std::string table_name (nano::tables table)
+	{
+		switch (table)
+		{
+			case nano::tables::accounts:
+				return "accounts";
+			case nano::tables::blocks:
+				return "blocks";
+			case nano::tables::confirmation_height:
+				return "confirmation_height";
+			case nano::tables::final_votes:
+				return "final_votes";
+			case nano::tables::frontiers:
+				return "frontiers";
+			case nano::tables::pending:
+				return "pending";
+			case nano::tables::pruned:
+				return "pruned";
+			default:
+				return "other";
+		}
+	}
+
+	static std::chrono::seconds constexpr report_interval{ 10 };
+
+	nano::mutex mutex;
+	std::ostream & stream;
+	uint64_t migrated{ 0 };
+	std::chrono::steady_clock::time_point last_report{ std::chrono::steady_clock::now () };
+};
+
+/** Records copied per RocksDB write transaction, the previous one record per transaction approach dominated migration time */
+std::size_t constexpr migration_batch_size = 16 * 1024;
+
+/**
+ * Copies one table to RocksDB, each key range of the parallel traversal is written by its own thread in batched write transactions
+ * @return number of records copied
+ */
+template <typename Table, typename Put>
+uint64_t migrate_table (Table const & table, nano::store::component & rocksdb_store, nano::tables table_id, migration_progress & progress, Put const & put)
+{
+	auto const start = std::chrono::steady_clock::now ();
+	std::atomic<uint64_t> count{ 0 };
+	table.for_each_par (
+	[&] (nano::store::read_transaction const & /*unused*/, auto i, auto n) {
+		auto transaction (rocksdb_store.tx_begin_write ({}, { table_id }));
+		uint64_t batched{ 0 };
+		for (; i != n; ++i)
+		{
+			put (transaction, i);
+			if (++batched == migration_batch_size)
+			{
+				transaction.commit ();
+				transaction.renew ();
+				count += batched;
+				progress.add (table_id, batched);
+				batched = 0;
+			}
+		}
+		count += batched;
+		progress.add (table_id, batched);
+	});
+	progress.table_done (table_id, count, std::chrono::steady_clock::now () - start);
+	return count;
+}
+
+/** Counts the records of a table without a count of its own by iterating over them */
+template <typename Table>
+uint64_t iterated_count (Table const & table, nano::store::transaction const & transaction)
+{
+	uint64_t result{ 0 };
+	for (auto i (table.begin (transaction)), n (table.end ()); i != n; ++i)
+	{
+		++result;
+	}
+	return result;
+}
+}
+
+bool nano::ledger::migrate_lmdb_to_rocksdb (std::filesystem::path const & data_path_a, std::ostream & progress_a) const
 {
 	boost::system::error_code error_chmod;
 	nano::set_secure_perm_directory (data_path_a, error_chmod);
@@ -1568,74 +1805,40 @@ bool nano::ledger::migrate_lmdb_to_rocksdb (std::filesystem::path const & data_p
 
 	if (!rocksdb_store->init_error ())
 	{
-		store.block.for_each_par (
-		[&rocksdb_store] (store::read_transaction const & /*unused*/, auto i, auto n) {
-			for (; i != n; ++i)
-			{
-				auto rocksdb_transaction (rocksdb_store->tx_begin_write ({}, { nano::tables::blocks }));
+		migration_progress progress{ progress_a };
 
-				std::vector<uint8_t> vector;
-				{
-					nano::vectorstream stream (vector);
-					nano::serialize_block (stream, *i->second.block);
-					i->second.sideband.serialize (stream, i->second.block->type ());
-				}
-				rocksdb_store->block.raw_put (rocksdb_transaction, vector, i->first);
+		auto blocks = migrate_table (store.block, *rocksdb_store, nano::tables::blocks, progress, [&rocksdb_store] (auto const & transaction, auto & i) {
+			std::vector<uint8_t> vector;
+			{
+				nano::vectorstream stream (vector);
+				nano::serialize_block (stream, *i->second.block);
+				i->second.sideband.serialize (stream, i->second.block->type ());
 			}
+			rocksdb_store->block.raw_put (transaction, vector, i->first);
 		});
 
-		store.pending.for_each_par (
-		[&rocksdb_store] (store::read_transaction const & /*unused*/, auto i, auto n) {
-			for (; i != n; ++i)
-			{
-				auto rocksdb_transaction (rocksdb_store->tx_begin_write ({}, { nano::tables::pending }));
-				rocksdb_store->pending.put (rocksdb_transaction, i->first, i->second);
-			}
+		auto pending = migrate_table (store.pending, *rocksdb_store, nano::tables::pending, progress, [&rocksdb_store] (auto const & transaction, auto & i) {
+			rocksdb_store->pending.put (transaction, i->first, i->second);
 		});
 
-		store.confirmation_height.for_each_par (
-		[&rocksdb_store] (store::read_transaction const & /*unused*/, auto i, auto n) {
-			for (; i != n; ++i)
-			{
-				auto rocksdb_transaction (rocksdb_store->tx_begin_write ({}, { nano::tables::confirmation_height }));
-				rocksdb_store->confirmation_height.put (rocksdb_transaction, i->first, i->second);
-			}
+		auto confirmation_heights = migrate_table (store.confirmation_height, *rocksdb_store, nano::tables::confirmation_height, progress, [&rocksdb_store] (auto const & transaction, auto & i) {
+			rocksdb_store->confirmation_height.put (transaction, i->first, i->second);
 		});
 
-		store.account.for_each_par (
-		[&rocksdb_store] (store::read_transaction const & /*unused*/, auto i, auto n) {
-			for (; i != n; ++i)
-			{
-				auto rocksdb_transaction (rocksdb_store->tx_begin_write ({}, { nano::tables::accounts }));
-				rocksdb_store->account.put (rocksdb_transaction, i->first, i->second);
-			}
+		auto accounts = migrate_table (store.account, *rocksdb_store, nano::tables::accounts, progress, [&rocksdb_store] (auto const & transaction, auto & i) {
+			rocksdb_store->account.put (transaction, i->first, i->second);
 		});
 
-		store.frontier.for_each_par (
-		[&rocksdb_store] (store::read_transaction const & /*unused*/, auto i, auto n) {
-			for (; i != n; ++i)
-			{
-				auto rocksdb_transaction (rocksdb_store->tx_begin_write ({}, { nano::tables::frontiers }));
-				rocksdb_store->frontier.put (rocksdb_transaction, i->first, i->second);
-			}
+		auto frontiers = migrate_table (store.frontier, *rocksdb_store, nano::tables::frontiers, progress, [&rocksdb_store] (auto const & transaction, auto & i) {
+			rocksdb_store->frontier.put (transaction, i->first, i->second);
 		});
 
-		store.pruned.for_each_par (
-		[&rocksdb_store] (store::read_transaction const & /*unused*/, auto i, auto n) {
-			for (; i != n; ++i)
-			{
-				auto rocksdb_transaction (rocksdb_store->tx_begin_write ({}, { nano::tables::pruned }));
-				rocksdb_store->pruned.put (rocksdb_transaction, i->first);
-			}
+		auto pruned = migrate_table (store.pruned, *rocksdb_store, nano::tables::pruned, progress, [&rocksdb_store] (auto const & transaction, auto & i) {
+			rocksdb_store->pruned.put (transaction, i->first);
 		});
 
-		store.final_vote.for_each_par (
-		[&rocksdb_store] (store::read_transaction const & /*unused*/, auto i, auto n) {
-			for (; i != n; ++i)
-			{
-				auto rocksdb_transaction (rocksdb_store->tx_begin_write ({}, { nano::tables::final_votes }));
-				rocksdb_store->final_vote.put (rocksdb_transaction, i->first, i->second);
-			}
+		auto final_votes = migrate_table (store.final_vote, *rocksdb_store, nano::tables::final_votes, progress, [&rocksdb_store] (auto const & transaction, auto & i) {
+			rocksdb_store->final_vote.put (transaction, i->first, i->second);
 		});
 
 		auto lmdb_transaction (store.tx_begin_read ());
@@ -1653,10 +1856,22 @@ bool nano::ledger::migrate_lmdb_to_rocksdb (std::filesystem::path const & data_p
 			rocksdb_store->peer.put (rocksdb_transaction, i->first);
 		}
 
-		// Compare counts
+		// Every record read from LMDB has to have been written
+		error |= blocks != store.block.count (lmdb_transaction);
+		error |= confirmation_heights != store.confirmation_height.count (lmdb_transaction);
+		error |= accounts != store.account.count (lmdb_transaction);
+		error |= pruned != store.pruned.count (lmdb_transaction);
+		error |= final_votes != store.final_vote.count (lmdb_transaction);
+		// Pending and frontier tables have no count, both sides are iterated instead
+		auto const lmdb_pending = iterated_count (store.pending, lmdb_transaction);
+		error |= pending != lmdb_pending || lmdb_pending != iterated_count (rocksdb_store->pending, rocksdb_transaction);
+		auto const lmdb_frontiers = iterated_count (store.frontier, lmdb_transaction);
+		error |= frontiers != lmdb_frontiers || lmdb_frontiers != iterated_count (rocksdb_store->frontier, rocksdb_transaction);
+
+		// Compare counts, RocksDB only has exact counts for these tables
+		error |= store.block.count (lmdb_transaction) != rocksdb_store->block.count (rocksdb_transaction);
+		error |= store.account.count (lmdb_transaction) != rocksdb_store->account.count (rocksdb_transaction);
 		error |= store.peer.count (lmdb_transaction) != rocksdb_store->peer.count (rocksdb_transaction);
-		error |= store.pruned.count (lmdb_transaction) != rocksdb_store->pruned.count (rocksdb_transaction);
-		error |= store.final_vote.count (lmdb_transaction) != rocksdb_store->final_vote.count (rocksdb_transaction);
 		error |= store.online_weight.count (lmdb_transaction) != rocksdb_store->online_weight.count (rocksdb_transaction);
 		error |= store.version.get (lmdb_transaction) != rocksdb_store->version.get (rocksdb_transaction);
 
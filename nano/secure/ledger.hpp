@@ -29,6 +29,18 @@ public:
 	nano::account account;
 };
 
+/**
+ * Checks done on a block ahead of ledger::process, typically on several threads, which the ledger trusts instead of repeating them
+ */
+class block_verification final
+{
+public:
+	/** Key whose signature of the block was validated, zero if none was. The ledger only trusts it if it is the signer the block requires */
+	nano::account signer{ 0 };
+	/** Work difficulty of the block, zero if not computed */
+	uint64_t difficulty{ 0 };
+};
+
 class ledger final
 {
 public:
@@ -77,10 +89,27 @@ public:
 	std::pair<nano::block_hash, nano::block_hash> hash_root_random (store::transaction const &) const;
 	std::optional<nano::pending_info> pending_info (store::transaction const & transaction, nano::pending_key const & key) const;
 	nano::process_return process (store::write_transaction const &, nano::block &);
+	/** Processes a block whose signature and work were already checked by the caller, as described by `verification` */
+	nano::process_return process (store::write_transaction const &, nano::block &, nano::block_verification const & verification);
 	bool rollback (store::write_transaction const &, nano::block_hash const &, std::vector<std::shared_ptr<nano::block>> &);
 	bool rollback (store::write_transaction const &, nano::block_hash const &);
 	void update_account (store::write_transaction const &, nano::account const &, nano::account_info const &, nano::account_info const &);
 	uint64_t pruning_action (store::write_transaction &, nano::block_hash const &, uint64_t const);
+	/**
+	 * Starts or stops maintaining the representative to delegators index.
+	 * Enabling builds the index from the accounts table if it is empty, disabling removes the index as it would go stale.
+	 * @return number of index entries built
+	 */
+	uint64_t delegators_index_set (bool);
+	/** Writes a pending entry along with its receivable amount index entry if the index is maintained */
+	void pending_put (store::write_transaction const &, nano::pending_key const &, nano::pending_info const &);
+	void pending_del (store::write_transaction const &, nano::pending_key const &);
+	/**
+	 * Starts or stops maintaining the receivable amount index, ordering the pending entries of each account by descending amount.
+	 * Enabling builds the index from the pending table if it is empty, disabling removes the index as it would go stale.
+	 * @return number of index entries built
+	 */
+	uint64_t receivable_index_set (bool);
 	void dump_account_chain (nano::account const &, std::ostream & = std::cout);
 	bool could_fit (store::transaction const &, nano::block const &) const;
 	bool dependents_confirmed (store::transaction const &, nano::block const &) const;
@@ -90,7 +119,7 @@ public:
 	nano::account const & epoch_signer (nano::link const &) const;
 	nano::link const & epoch_link (nano::epoch) const;
 	std::multimap<uint64_t, uncemented_info, std::greater<>> unconfirmed_frontiers () const;
-	bool migrate_lmdb_to_rocksdb (std::filesystem::path const &) const;
+	bool migrate_lmdb_to_rocksdb (std::filesystem::path const &, std::ostream & = std::cout) const;
 	bool bootstrap_weight_reached () const;
 	static nano::epoch version (nano::block const & block);
 	nano::epoch version (store::transaction const & transaction, nano::block_hash const & hash) const;
@@ -104,9 +133,14 @@ public:
 	uint64_t bootstrap_weight_max_blocks{ 1 };
 	std::atomic<bool> check_bootstrap_weights;
 	bool pruning{ false };
+	/** Account representative changes are written to the delegators index, set through delegators_index_set */
+	bool delegators_index{ false };
+	/** Pending entries are written to the receivable amount index, set through receivable_index_set */
+	bool receivable_index{ false };
 
 private:
 	void initialize (nano::generate_cache const &);
+	void update_delegators_index (store::write_transaction const &, nano::account const &, nano::account_info const &, nano::account_info const &);
 };
 
 std::unique_ptr<container_info_component> collect_container_info (ledger & ledger, std::string const & name);
@@ -582,6 +582,48 @@ TEST (store, pruned_load)
 	}
 }
 
+/**
+ * Compares pending lookups of accounts without receivable entries on RocksDB stores with and without prefix bloom filters.
+ * Enough entries are written for the memtables to be flushed to table files, which is where the filters are used.
+ */
+TEST (store, rocksdb_pending_prefix_bloom)
+{
+	nano::logger_mt logger;
+	constexpr auto num_entries = 1000000;
+	constexpr auto batch_size = 10000;
+	constexpr auto num_lookups = 100000;
+	for (auto prefix_bloom : { false, true })
+	{
+		nano::rocksdb_config config;
+		config.enable = true;
+		config.pending_prefix_bloom = prefix_bloom;
+		auto store = nano::make_store (logger, nano::unique_path (), nano::dev::constants, false, true, config);
+		ASSERT_FALSE (store->init_error ());
+		for (auto i = 0; i < num_entries / batch_size; ++i)
+		{
+			auto transaction = store->tx_begin_write ();
+			for (auto k = 0; k < batch_size; ++k)
+			{
+				nano::pending_key key{ nano::random_pool::generate<nano::account> (), nano::random_pool::generate<nano::block_hash> () };
+				store->pending.put (transaction, key, nano::pending_info{ nano::account{ 1 }, nano::amount{ 1 }, nano::epoch::epoch_0 });
+			}
+		}
+		auto transaction = store->tx_begin_read ();
+		auto const any_start = std::chrono::steady_clock::now ();
+		for (auto i = 0; i < num_lookups; ++i)
+		{
+			ASSERT_FALSE (store->pending.any (transaction, nano::random_pool::generate<nano::account> ()));
+		}
+		auto const exists_start = std::chrono::steady_clock::now ();
+		for (auto i = 0; i < num_lookups; ++i)
+		{
+			ASSERT_FALSE (store->pending.exists (transaction, nano::pending_key{ nano::random_pool::generate<nano::account> (), nano::random_pool::generate<nano::block_hash> () }));
+		}
+		auto const end = std::chrono::steady_clock::now ();
+		std::cout << boost::str (boost::format ("Prefix bloom %1%: %2% any () in %3% ms, %2% exists () in %4% ms\n") % (prefix_bloom ? "enabled" : "disabled") % num_lookups % std::chrono::duration_cast<std::chrono::milliseconds> (exists_start - any_start).count () % std::chrono::duration_cast<std::chrono::milliseconds> (end - exists_start).count ());
+	}
+}
+
 TEST (wallets, rep_scan)
 {
 	nano::test::system system (1);
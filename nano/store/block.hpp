@@ -6,6 +6,8 @@
 #include <nano/store/iterator.hpp>
 
 #include <functional>
+#include <optional>
+#include <vector>
 
 namespace nano
 {
@@ -30,6 +32,11 @@ public:
 	virtual nano::block_hash successor (store::transaction const &, nano::block_hash const &) const = 0;
 	virtual void successor_clear (store::write_transaction const &, nano::block_hash const &) = 0;
 	virtual std::shared_ptr<nano::block> get (store::transaction const &, nano::block_hash const &) const = 0;
+	/**
+	 * Appends the block in its network serialization (block type followed by block contents, without sideband) to `buffer` without deserializing it
+	 * @return successor of the block taken from its sideband, or nullopt if the block does not exist
+	 */
+	virtual std::optional<nano::block_hash> get_serialized (store::transaction const &, nano::block_hash const &, std::vector<uint8_t> & buffer) const = 0;
 	virtual std::shared_ptr<nano::block> random (store::transaction const &) = 0;
 	virtual void del (store::write_transaction const &, nano::block_hash const &) = 0;
 	virtual bool exists (store::transaction const &, nano::block_hash const &) = 0;
@@ -4,6 +4,7 @@
 #include <nano/lib/memory.hpp>
 #include <nano/lib/stream.hpp>
 #include <nano/secure/common.hpp>
+#include <nano/store/instrumentation.hpp>
 #include <nano/store/tables.hpp>
 #include <nano/store/transaction.hpp>
 #include <nano/store/versioning.hpp>
@@ -20,12 +21,14 @@ namespace store
 	class account;
 	class block;
 	class confirmation_height;
+	class delegator;
 	class final_vote;
 	class frontier;
 	class online_weight;
 	class peer;
 	class pending;
 	class pruned;
+	class receivable_amount;
 	class version;
 }
 class ledger_cache;
@@ -52,6 +55,8 @@ namespace store
 		nano::store::peer &,
 		nano::store::confirmation_height &,
 		nano::store::final_vote &,
+		nano::store::delegator &,
+		nano::store::receivable_amount &,
 		nano::store::version &
 	);
 		// clang-format on
@@ -69,7 +74,7 @@ namespace store
 		store::account & account;
 		store::pending & pending;
 		static int constexpr version_minimum{ 21 };
-		static int constexpr version_current{ 22 };
+		static int constexpr version_current{ 24 };
 
 	public:
 		store::online_weight & online_weight;
@@ -77,7 +82,11 @@ namespace store
 		store::peer & peer;
 		store::confirmation_height & confirmation_height;
 		store::final_vote & final_vote;
+		store::delegator & delegator;
+		store::receivable_amount & receivable_amount;
 		store::version & version;
+		/** Per table operation counters, backends record their get, put, del and iterator operations here */
+		store::instrumentation instrumentation;
 
 		virtual unsigned max_block_write_batch_num () const = 0;
 
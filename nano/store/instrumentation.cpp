@@ -0,0 +1,211 @@
+#include <nano/lib/stats.hpp>
+#include <nano/store/instrumentation.hpp>
+
+#include <boost/property_tree/ptree.hpp>
+
+#include <bit>
+
+namespace
+{
+nano::stat::type to_stat_type (nano::store::instrumentation::operation op)
+{
+	switch (op)
+	{
+		case nano::store::instrumentation::operation::get:
+			return nano::stat::type::store_get;
+		case nano::store::instrumentation::operation::put:
+			return nano::stat::type::store_put;
+		case nano::store::instrumentation::operation::del:
+			return nano::stat::type::store_del;
+		case nano::store::instrumentation::operation::iterate:
+			return nano::stat::type::store_iterate;
+	}
+	debug_assert (false);
+	return nano::stat::type::store_get;
+}
+
+/** Returns false for tables which are not in use */
+bool to_stat_detail (nano::tables table, nano::stat::detail & detail)
+{
+	switch (table)
+	{
+		case nano::tables::accounts:
+			detail = nano::stat::detail::accounts;
+			return true;
+		case nano::tables::blocks:
+			detail = nano::stat::detail::blocks;
+			return true;
+		case nano::tables::confirmation_height:
+			detail = nano::stat::detail::confirmation_height;
+			return true;
+		case nano::tables::delegators:
+			detail = nano::stat::detail::delegators;
+			return true;
+		case nano::tables::final_votes:
+			detail = nano::stat::detail::final_votes;
+			return true;
+		case nano::tables::frontiers:
+			detail = nano::stat::detail::frontiers;
+			return true;
+		case nano::tables::meta:
+			detail = nano::stat::detail::meta;
+			return true;
+		case nano::tables::online_weight:
+			detail = nano::stat::detail::online_weight;
+			return true;
+		case nano::tables::peers:
+			detail = nano::stat::detail::peers;
+			return true;
+		case nano::tables::pending:
+			detail = nano::stat::detail::pending;
+			return true;
+		case nano::tables::pruned:
+			detail = nano::stat::detail::pruned;
+			return true;
+		case nano::tables::receivable_amounts:
+			detail = nano::stat::detail::receivable_amounts;
+			return true;
+		case nano::tables::default_unused:
+		case nano::tables::vote:
+			return false;
+	}
+	return false;
+}
+}
+
+void nano::store::instrumentation::enable (bool enable_a)
+{
+	enabled_m = enable_a;
+}
+
+bool nano::store::instrumentation::enabled () const
+{
+	return enabled_m;
+}
+
+void nano::store::instrumentation::record (nano::tables table, operation op, std::size_t bytes, clock::duration duration) const
+{
+	auto & totals = totals_m[table][op];
+	auto const nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds> (duration).count ();
+	auto const microseconds = static_cast<uint64_t> (nanoseconds / 1000);
+	auto const bucket = std::min<std::size_t> (std::bit_width (microseconds), latency_buckets - 1);
+	totals.count.fetch_add (1, std::memory_order_relaxed);
+	totals.bytes.fetch_add (bytes, std::memory_order_relaxed);
+	totals.nanoseconds.fetch_add (nanoseconds, std::memory_order_relaxed);
+	totals.latency[bucket].fetch_add (1, std::memory_order_relaxed);
+	auto & caller = callers_m[table][op][nano::thread_role::get ()];
+	caller.count.fetch_add (1, std::memory_order_relaxed);
+	caller.bytes.fetch_add (bytes, std::memory_order_relaxed);
+}
+
+uint64_t nano::store::instrumentation::count (nano::tables table, operation op) const
+{
+	return totals_m[table][op].count;
+}
+
+uint64_t nano::store::instrumentation::bytes (nano::tables table, operation op) const
+{
+	return totals_m[table][op].bytes;
+}
+
+uint64_t nano::store::instrumentation::count (nano::tables table, operation op, nano::thread_role::name role) const
+{
+	return callers_m[table][op][role].count;
+}
+
+void nano::store::instrumentation::flush (nano::stats & stats)
+{
+	nano::lock_guard<nano::mutex> guard{ flush_mutex };
+	for (auto table : magic_enum::enum_values<nano::tables> ())
+	{
+		nano::stat::detail detail;
+		if (!to_stat_detail (table, detail))
+		{
+			continue;
+		}
+		for (auto op : magic_enum::enum_values<operation> ())
+		{
+			auto const current = count (table, op);
+			auto & flushed_l = flushed[table][op];
+			if (current > flushed_l)
+			{
+				stats.add (to_stat_type (op), detail, nano::stat::dir::in, current - flushed_l);
+			}
+			flushed_l = current;
+		}
+	}
+}
+
+void nano::store::instrumentation::serialize (boost::property_tree::ptree & tree) const
+{
+	tree.put ("enabled", enabled () ? "true" : "false");
+	boost::property_tree::ptree tables_l;
+	for (auto table : magic_enum::enum_values<nano::tables> ())
+	{
+		boost::property_tree::ptree operations_l;
+		for (auto op : magic_enum::enum_values<operation> ())
+		{
+			auto const & totals = totals_m[table][op];
+			if (totals.count == 0)
+			{
+				continue;
+			}
+			boost::property_tree::ptree entry;
+			entry.put ("count", totals.count.load ());
+			entry.put ("bytes", totals.bytes.load ());
+			entry.put ("nanoseconds", totals.nanoseconds.load ());
+			boost::property_tree::ptree latency;
+			for (std::size_t i = 0; i < latency_buckets; ++i)
+			{
+				// Keyed by the exclusive upper bound of the bucket in microseconds
+				auto const key = i + 1 < latency_buckets ? std::to_string (uint64_t{ 1 } << i) : std::string{ "max" };
+				latency.put (key, totals.latency[i].load ());
+			}
+			entry.add_child ("latency_us", latency);
+			boost::property_tree::ptree callers;
+			for (auto role : magic_enum::enum_values<nano::thread_role::name> ())
+			{
+				auto const & caller = callers_m[table][op][role];
+				if (caller.count != 0)
+				{
+					boost::property_tree::ptree caller_l;
+					caller_l.put ("count", caller.count.load ());
+					caller_l.put ("bytes", caller.bytes.load ());
+					callers.add_child (std::string{ magic_enum::enum_name (role) }, caller_l);
+				}
+			}
+			entry.add_child ("callers", callers);
+			operations_l.add_child (std::string{ magic_enum::enum_name (op) }, entry);
+		}
+		if (!operations_l.empty ())
+		{
+			tables_l.add_child (std::string{ magic_enum::enum_name (table) }, operations_l);
+		}
+	}
+	tree.add_child ("tables", tables_l);
+}
+
+void nano::store::instrumentation::clear ()
+{
+	nano::lock_guard<nano::mutex> guard{ flush_mutex };
+	for (auto table : magic_enum::enum_values<nano::tables> ())
+	{
+		for (auto op : magic_enum::enum_values<operation> ())
+		{
+			auto & totals = totals_m[table][op];
+			totals.count = 0;
+			totals.bytes = 0;
+			totals.nanoseconds = 0;
+			for (auto & bucket : totals.latency)
+			{
+				bucket = 0;
+			}
+			for (auto & caller : callers_m[table][op])
+			{
+				caller.count = 0;
+				caller.bytes = 0;
+			}
+			flushed[table][op] = 0;
+		}
+	}
+}
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <nano/lib/locks.hpp>
+#include <nano/lib/thread_roles.hpp>
+#include <nano/lib/utility.hpp>
+#include <nano/store/tables.hpp>
+
+#include <boost/property_tree/ptree_fwd.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace nano
+{
+class stats;
+}
+
+namespace nano::store
+{
+/**
+ * Records the operations performed on each store table: how many, the value bytes moved and how long they took.
+ * Counts and bytes are also kept per thread role of the caller, which identifies the subsystem using the table.
+ * Disabled by default, while disabled an operation only costs a relaxed load of the enabled flag.
+ */
+class instrumentation final
+{
+public:
+	enum class operation : uint8_t
+	{
+		get,
+		put,
+		del,
+		iterate
+	};
+
+	using clock = std::chrono::steady_clock;
+	/** Latency bucket `n` holds operations taking less than 2^n microseconds, the last bucket holds everything slower */
+	static std::size_t constexpr latency_buckets = 16;
+
+	void enable (bool);
+	bool enabled () const;
+
+	/** Start time of an operation, the default time point if instrumentation is disabled which makes `stop` a no-op */
+	clock::time_point start () const
+	{
+		return enabled_m.load (std::memory_order_relaxed) ? clock::now () : clock::time_point{};
+	}
+
+	void stop (clock::time_point start, nano::tables table, operation op, std::size_t bytes) const
+	{
+		if (start != clock::time_point{})
+		{
+			record (table, op, bytes, clock::now () - start);
+		}
+	}
+
+	void record (nano::tables, operation, std::size_t bytes, clock::duration) const;
+
+	uint64_t count (nano::tables, operation) const;
+	uint64_t bytes (nano::tables, operation) const;
+	uint64_t count (nano::tables, operation, nano::thread_role::name) const;
+
+	/** Adds the operation counts recorded since the previous flush to `stats` */
+	void flush (nano::stats &);
+	void serialize (boost::property_tree::ptree &) const;
+	void clear ();
+
+private:
+	class totals final
+	{
+	public:
+		std::atomic<uint64_t> count{ 0 };
+		std::atomic<uint64_t> bytes{ 0 };
+		std::atomic<uint64_t> nanoseconds{ 0 };
+		std::array<std::atomic<uint64_t>, latency_buckets> latency{};
+	};
+
+	class caller final
+	{
+	public:
+		std::atomic<uint64_t> count{ 0 };
+		std::atomic<uint64_t> bytes{ 0 };
+	};
+
+	using callers_t = nano::enum_array<nano::thread_role::name, caller>;
+
+	std::atomic<bool> enabled_m{ false };
+	mutable nano::enum_array<nano::tables, nano::enum_array<operation, totals>> totals_m;
+	mutable nano::enum_array<nano::tables, nano::enum_array<operation, callers_t>> callers_m;
+
+	nano::mutex flush_mutex;
+	/** Counts already added to stats */
+	nano::enum_array<nano::tables, nano::enum_array<operation, uint64_t>> flushed{};
+};
+}
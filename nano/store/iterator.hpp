@@ -1,17 +1,23 @@
 #pragma once
 
+#include <nano/store/instrumentation.hpp>
 #include <nano/store/iterator_impl.hpp>
 
 #include <memory>
 
 namespace nano::store
 {
+template <typename T, typename U>
+class view_iterator;
+
 /**
  * Iterates the key/value pairs of a transaction
  */
 template <typename T, typename U>
 class iterator final
 {
+	friend class view_iterator<T, U>;
+
 public:
 	iterator (std::nullptr_t)
 	{
@@ -21,27 +27,51 @@ public:
 	{
 		impl->fill (current);
 	}
+	/**
+	 * Iterator whose positioning is recorded as `iterate` operations on `table_a`, starting with the seek that began at `start_a`.
+	 * Steps are only recorded if instrumentation was enabled when the iterator was created.
+	 */
+	iterator (std::unique_ptr<iterator_impl<T, U>> impl_a, store::instrumentation const & instrumentation_a, nano::tables table_a, store::instrumentation::clock::time_point start_a) :
+		impl (std::move (impl_a)),
+		table (table_a)
+	{
+		impl->fill (current);
+		if (start_a != store::instrumentation::clock::time_point{})
+		{
+			instrumentation = &instrumentation_a;
+			instrumentation->stop (start_a, table, store::instrumentation::operation::iterate, 0);
+		}
+	}
 	iterator (iterator<T, U> && other_a) :
 		current (std::move (other_a.current)),
-		impl (std::move (other_a.impl))
+		impl (std::move (other_a.impl)),
+		instrumentation (other_a.instrumentation),
+		table (other_a.table)
 	{
 	}
 	iterator<T, U> & operator++ ()
 	{
-		++*impl;
+		increment ();
 		impl->fill (current);
 		return *this;
 	}
 	iterator<T, U> & operator-- ()
 	{
+		auto const start = instrumentation != nullptr ? instrumentation->start () : store::instrumentation::clock::time_point{};
 		--*impl;
 		impl->fill (current);
+		if (instrumentation != nullptr)
+		{
+			instrumentation->stop (start, table, store::instrumentation::operation::iterate, 0);
+		}
 		return *this;
 	}
 	iterator<T, U> & operator= (iterator<T, U> && other_a) noexcept
 	{
 		impl = std::move (other_a.impl);
 		current = std::move (other_a.current);
+		instrumentation = other_a.instrumentation;
+		table = other_a.table;
 		return *this;
 	}
 	iterator<T, U> & operator= (iterator<T, U> const &) = delete;
@@ -59,7 +89,62 @@ public:
 	}
 
 private:
+	/** Moves to the next entry without decoding it */
+	void increment ()
+	{
+		auto const start = instrumentation != nullptr ? instrumentation->start () : store::instrumentation::clock::time_point{};
+		++*impl;
+		if (instrumentation != nullptr)
+		{
+			instrumentation->stop (start, table, store::instrumentation::operation::iterate, 0);
+		}
+	}
+
 	std::pair<T, U> current;
 	std::unique_ptr<iterator_impl<T, U>> impl;
+	store::instrumentation const * instrumentation{ nullptr };
+	nano::tables table{ nano::tables::default_unused };
+};
+
+/**
+ * Forward iterator exposing entries as stored instead of decoding each one, for scans reading a few fields of many entries.
+ * Takes over a positioned store::iterator and compares against store::iterator bounds, e.g. the end of a table or of a parallel traversal range.
+ */
+template <typename T, typename U>
+class view_iterator final
+{
+public:
+	explicit view_iterator (store::iterator<T, U> && iterator_a) :
+		inner (std::move (iterator_a))
+	{
+	}
+	view_iterator<T, U> & operator++ ()
+	{
+		inner.increment ();
+		return *this;
+	}
+	bool operator== (store::iterator<T, U> const & other_a) const
+	{
+		return inner == other_a;
+	}
+	bool operator!= (store::iterator<T, U> const & other_a) const
+	{
+		return inner != other_a;
+	}
+	/** Current entry as stored, valid until the iterator moves */
+	store::entry_view view () const
+	{
+		return inner.impl->view ();
+	}
+	/** Decodes the current entry */
+	std::pair<T, U> entry () const
+	{
+		std::pair<T, U> result;
+		inner.impl->fill (result);
+		return result;
+	}
+
+private:
+	store::iterator<T, U> inner;
 };
 } // namespace nano::store
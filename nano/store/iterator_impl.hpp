@@ -1,9 +1,37 @@
 #pragma once
 
+#include <nano/lib/utility.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <type_traits>
 #include <utility>
 
 namespace nano::store
 {
+/**
+ * Key and value bytes of a table entry in their stored form, without copying or deserializing them.
+ * Only valid until the iterator it was taken from moves or its transaction ends.
+ */
+class entry_view final
+{
+public:
+	std::span<uint8_t const> key;
+	std::span<uint8_t const> value;
+
+	/** Key stored as the raw bytes of `T`, integral keys are stored big endian and cannot be read this way */
+	template <typename T>
+	T key_as () const
+	{
+		static_assert (std::is_trivially_copyable_v<T> && !std::is_integral_v<T>);
+		debug_assert (key.size () == sizeof (T));
+		T result;
+		std::memcpy (&result, key.data (), sizeof (T));
+		return result;
+	}
+};
+
 template <typename T, typename U>
 class iterator_impl
 {
@@ -14,6 +42,8 @@ public:
 	virtual bool operator== (iterator_impl<T, U> const & other_a) const = 0;
 	virtual bool is_end_sentinal () const = 0;
 	virtual void fill (std::pair<T, U> &) const = 0;
+	/** Current entry as stored, empty at the end */
+	virtual store::entry_view view () const = 0;
 	iterator_impl<T, U> & operator= (iterator_impl<T, U> const &) = delete;
 	bool operator== (iterator_impl<T, U> const * other_a) const
 	{
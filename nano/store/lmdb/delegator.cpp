@@ -0,0 +1,48 @@
+#include <nano/store/lmdb/delegator.hpp>
+#include <nano/store/lmdb/lmdb.hpp>
+
+nano::store::lmdb::delegator::delegator (nano::store::lmdb::component & store_a) :
+	store{ store_a } {};
+
+void nano::store::lmdb::delegator::put (store::write_transaction const & transaction_a, nano::delegator_key const & key_a)
+{
+	auto status = store.put (transaction_a, tables::delegators, key_a, nullptr);
+	store.release_assert_success (status);
+}
+
+void nano::store::lmdb::delegator::del (store::write_transaction const & transaction_a, nano::delegator_key const & key_a)
+{
+	auto status = store.del (transaction_a, tables::delegators, key_a);
+	store.release_assert_success (status);
+}
+
+bool nano::store::lmdb::delegator::exists (store::transaction const & transaction_a, nano::delegator_key const & key_a) const
+{
+	return store.exists (transaction_a, tables::delegators, key_a);
+}
+
+size_t nano::store::lmdb::delegator::count (store::transaction const & transaction_a) const
+{
+	return store.count (transaction_a, tables::delegators);
+}
+
+void nano::store::lmdb::delegator::clear (store::write_transaction const & transaction_a)
+{
+	auto status = store.drop (transaction_a, tables::delegators);
+	store.release_assert_success (status);
+}
+
+nano::store::iterator<nano::delegator_key, std::nullptr_t> nano::store::lmdb::delegator::begin (store::transaction const & transaction, nano::delegator_key const & key) const
+{
+	return store.make_iterator<nano::delegator_key, std::nullptr_t> (transaction, tables::delegators, key);
+}
+
+nano::store::iterator<nano::delegator_key, std::nullptr_t> nano::store::lmdb::delegator::begin (store::transaction const & transaction) const
+{
+	return store.make_iterator<nano::delegator_key, std::nullptr_t> (transaction, tables::delegators);
+}
+
+nano::store::iterator<nano::delegator_key, std::nullptr_t> nano::store::lmdb::delegator::end () const
+{
+	return store::iterator<nano::delegator_key, std::nullptr_t> (nullptr);
+}
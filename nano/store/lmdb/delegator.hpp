@@ -0,0 +1,35 @@
+#pragma once
+
+#include <nano/store/delegator.hpp>
+
+#include <lmdb/libraries/liblmdb/lmdb.h>
+
+namespace nano::store::lmdb
+{
+class component;
+}
+namespace nano::store::lmdb
+{
+class delegator : public nano::store::delegator
+{
+private:
+	nano::store::lmdb::component & store;
+
+public:
+	explicit delegator (nano::store::lmdb::component & store_a);
+	void put (store::write_transaction const & transaction_a, nano::delegator_key const & key_a) override;
+	void del (store::write_transaction const & transaction_a, nano::delegator_key const & key_a) override;
+	bool exists (store::transaction const & transaction_a, nano::delegator_key const & key_a) const override;
+	size_t count (store::transaction const & transaction_a) const override;
+	void clear (store::write_transaction const & transaction_a) override;
+	store::iterator<nano::delegator_key, std::nullptr_t> begin (store::transaction const & transaction_a, nano::delegator_key const & key_a) const override;
+	store::iterator<nano::delegator_key, std::nullptr_t> begin (store::transaction const & transaction_a) const override;
+	store::iterator<nano::delegator_key, std::nullptr_t> end () const override;
+
+	/**
+	 * Representative to delegators index
+	 * nano::delegator_key -> none
+	 */
+	MDB_dbi delegators_handle{ 0 };
+};
+} // namespace nano::store::lmdb
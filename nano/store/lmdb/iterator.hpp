@@ -143,6 +143,10 @@ public:
 			value_a.second = U ();
 		}
 	}
+	store::entry_view view () const override
+	{
+		return { { static_cast<uint8_t const *> (current.first.data ()), current.first.size () }, { static_cast<uint8_t const *> (current.second.data ()), current.second.size () } };
+	}
 	void clear ()
 	{
 		current.first = store::db_val<MDB_val> ();
@@ -260,6 +264,10 @@ public:
 			value_a.second = U ();
 		}
 	}
+	store::entry_view view () const override
+	{
+		return least_iterator ().view ();
+	}
 	merge_iterator<T, U> & operator= (merge_iterator<T, U> &&) = default;
 	merge_iterator<T, U> & operator= (merge_iterator<T, U> const &) = delete;
 
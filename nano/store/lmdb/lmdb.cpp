@@ -24,6 +24,8 @@ nano::store::lmdb::component::component (nano::logger_mt & logger_a, std::filesy
 		peer_store,
 		confirmation_height_store,
 		final_vote_store,
+		delegator_store,
+		receivable_amount_store,
 		version_store
 	},
 	// clang-format on
@@ -36,6 +38,8 @@ nano::store::lmdb::component::component (nano::logger_mt & logger_a, std::filesy
 	peer_store{ *this },
 	confirmation_height_store{ *this },
 	final_vote_store{ *this },
+	delegator_store{ *this },
+	receivable_amount_store{ *this },
 	version_store{ *this },
 	logger (logger_a),
 	env (error, path_a, nano::store::lmdb::env::options::make ().set_config (lmdb_config_a).set_use_no_mem_init (true)),
@@ -94,6 +98,11 @@ nano::store::lmdb::component::component (nano::logger_mt & logger_a, std::filesy
 			auto transaction (tx_begin_read ());
 			open_databases (error, transaction, 0);
 		}
+		if (!error)
+		{
+			// All databases are open, from now on read transactions can be reused
+			env.read_pool_resize (lmdb_config_a.read_transaction_pool_size);
+		}
 	}
 }
 
@@ -193,6 +202,8 @@ void nano::store::lmdb::component::open_databases (bool & error_a, store::transa
 	error_a |= mdb_dbi_open (env.tx (transaction_a), "pending", flags, &pending_store.pending_v0_handle) != 0;
 	pending_store.pending_handle = pending_store.pending_v0_handle;
 	error_a |= mdb_dbi_open (env.tx (transaction_a), "final_votes", flags, &final_vote_store.final_votes_handle) != 0;
+	error_a |= mdb_dbi_open (env.tx (transaction_a), "delegators", flags, &delegator_store.delegators_handle) != 0;
+	error_a |= mdb_dbi_open (env.tx (transaction_a), "receivable_amounts", flags, &receivable_amount_store.receivable_amounts_handle) != 0;
 	error_a |= mdb_dbi_open (env.tx (transaction_a), "blocks", MDB_CREATE, &block_store.blocks_handle) != 0;
 }
 
@@ -211,6 +222,12 @@ bool nano::store::lmdb::component::do_upgrades (store::write_transaction & trans
 			upgrade_v21_to_v22 (transaction_a);
 			[[fallthrough]];
 		case 22:
+			upgrade_v22_to_v23 (transaction_a);
+			[[fallthrough]];
+		case 23:
+			upgrade_v23_to_v24 (transaction_a);
+			[[fallthrough]];
+		case 24:
 			break;
 		default:
 			logger.always_log (boost::str (boost::format ("The version of the ledger (%1%) is too high for this node") % version_l));
@@ -230,6 +247,22 @@ void nano::store::lmdb::component::upgrade_v21_to_v22 (store::write_transaction
 	logger.always_log ("Finished removing unchecked table");
 }
 
+void nano::store::lmdb::component::upgrade_v22_to_v23 (store::write_transaction const & transaction_a)
+{
+	logger.always_log ("Preparing v22 to v23 database upgrade...");
+	// The delegators table is created empty when opening the databases, it is populated when the node enables the index
+	version.put (transaction_a, 23);
+	logger.always_log ("Finished adding delegators table");
+}
+
+void nano::store::lmdb::component::upgrade_v23_to_v24 (store::write_transaction const & transaction_a)
+{
+	logger.always_log ("Preparing v23 to v24 database upgrade...");
+	// The receivable amounts table is created empty when opening the databases, it is populated when the node enables the index
+	version.put (transaction_a, 24);
+	logger.always_log ("Finished adding receivable amounts table");
+}
+
 /** Takes a filepath, appends '_backup_<timestamp>' to the end (but before any extension) and saves that file in the same directory */
 void nano::store::lmdb::component::create_backup_file (nano::store::lmdb::env & env_a, std::filesystem::path const & filepath_a, nano::logger_mt & logger_a)
 {
@@ -271,17 +304,26 @@ bool nano::store::lmdb::component::exists (store::transaction const & transactio
 
 int nano::store::lmdb::component::get (store::transaction const & transaction_a, tables table_a, nano::store::lmdb::db_val const & key_a, nano::store::lmdb::db_val & value_a) const
 {
-	return mdb_get (env.tx (transaction_a), table_to_dbi (table_a), key_a, value_a);
+	auto const start = instrumentation.start ();
+	auto status = mdb_get (env.tx (transaction_a), table_to_dbi (table_a), key_a, value_a);
+	instrumentation.stop (start, table_a, store::instrumentation::operation::get, value_a.size ());
+	return status;
 }
 
 int nano::store::lmdb::component::put (store::write_transaction const & transaction_a, tables table_a, nano::store::lmdb::db_val const & key_a, nano::store::lmdb::db_val const & value_a) const
 {
-	return (mdb_put (env.tx (transaction_a), table_to_dbi (table_a), key_a, value_a, 0));
+	auto const start = instrumentation.start ();
+	auto status = mdb_put (env.tx (transaction_a), table_to_dbi (table_a), key_a, value_a, 0);
+	instrumentation.stop (start, table_a, store::instrumentation::operation::put, value_a.size ());
+	return status;
 }
 
 int nano::store::lmdb::component::del (store::write_transaction const & transaction_a, tables table_a, nano::store::lmdb::db_val const & key_a) const
 {
-	return (mdb_del (env.tx (transaction_a), table_to_dbi (table_a), key_a, nullptr));
+	auto const start = instrumentation.start ();
+	auto status = mdb_del (env.tx (transaction_a), table_to_dbi (table_a), key_a, nullptr);
+	instrumentation.stop (start, table_a, store::instrumentation::operation::del, 0);
+	return status;
 }
 
 int nano::store::lmdb::component::drop (store::write_transaction const & transaction_a, tables table_a)
@@ -331,6 +373,10 @@ MDB_dbi nano::store::lmdb::component::table_to_dbi (tables table_a) const
 			return confirmation_height_store.confirmation_height_handle;
 		case tables::final_votes:
 			return final_vote_store.final_votes_handle;
+		case tables::delegators:
+			return delegator_store.delegators_handle;
+		case tables::receivable_amounts:
+			return receivable_amount_store.receivable_amounts_handle;
 		default:
 			release_assert (false);
 			return peer_store.peers_handle;
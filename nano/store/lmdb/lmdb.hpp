@@ -9,6 +9,7 @@
 #include <nano/store/lmdb/account.hpp>
 #include <nano/store/lmdb/block.hpp>
 #include <nano/store/lmdb/confirmation_height.hpp>
+#include <nano/store/lmdb/delegator.hpp>
 #include <nano/store/lmdb/db_val.hpp>
 #include <nano/store/lmdb/final_vote.hpp>
 #include <nano/store/lmdb/frontier.hpp>
@@ -18,6 +19,7 @@
 #include <nano/store/lmdb/peer.hpp>
 #include <nano/store/lmdb/pending.hpp>
 #include <nano/store/lmdb/pruned.hpp>
+#include <nano/store/lmdb/receivable_amount.hpp>
 #include <nano/store/lmdb/transaction_impl.hpp>
 #include <nano/store/lmdb/version.hpp>
 #include <nano/store/versioning.hpp>
@@ -43,23 +45,27 @@ private:
 	nano::store::lmdb::account account_store;
 	nano::store::lmdb::block block_store;
 	nano::store::lmdb::confirmation_height confirmation_height_store;
+	nano::store::lmdb::delegator delegator_store;
 	nano::store::lmdb::final_vote final_vote_store;
 	nano::store::lmdb::frontier frontier_store;
 	nano::store::lmdb::online_weight online_weight_store;
 	nano::store::lmdb::peer peer_store;
 	nano::store::lmdb::pending pending_store;
 	nano::store::lmdb::pruned pruned_store;
+	nano::store::lmdb::receivable_amount receivable_amount_store;
 	nano::store::lmdb::version version_store;
 
 	friend class nano::store::lmdb::account;
 	friend class nano::store::lmdb::block;
 	friend class nano::store::lmdb::confirmation_height;
+	friend class nano::store::lmdb::delegator;
 	friend class nano::store::lmdb::final_vote;
 	friend class nano::store::lmdb::frontier;
 	friend class nano::store::lmdb::online_weight;
 	friend class nano::store::lmdb::peer;
 	friend class nano::store::lmdb::pending;
 	friend class nano::store::lmdb::pruned;
+	friend class nano::store::lmdb::receivable_amount;
 	friend class nano::store::lmdb::version;
 
 public:
@@ -96,13 +102,15 @@ public:
 	template <typename Key, typename Value>
 	store::iterator<Key, Value> make_iterator (store::transaction const & transaction_a, tables table_a, bool const direction_asc = true) const
 	{
-		return store::iterator<Key, Value> (std::make_unique<nano::store::lmdb::iterator<Key, Value>> (transaction_a, env, table_to_dbi (table_a), nano::store::lmdb::db_val{}, direction_asc));
+		auto const start = instrumentation.start ();
+		return store::iterator<Key, Value> (std::make_unique<nano::store::lmdb::iterator<Key, Value>> (transaction_a, env, table_to_dbi (table_a), nano::store::lmdb::db_val{}, direction_asc), instrumentation, table_a, start);
 	}
 
 	template <typename Key, typename Value>
 	store::iterator<Key, Value> make_iterator (store::transaction const & transaction_a, tables table_a, nano::store::lmdb::db_val const & key) const
 	{
-		return store::iterator<Key, Value> (std::make_unique<nano::store::lmdb::iterator<Key, Value>> (transaction_a, env, table_to_dbi (table_a), key));
+		auto const start = instrumentation.start ();
+		return store::iterator<Key, Value> (std::make_unique<nano::store::lmdb::iterator<Key, Value>> (transaction_a, env, table_to_dbi (table_a), key), instrumentation, table_a, start);
 	}
 
 	bool init_error () const override;
@@ -113,6 +121,8 @@ public:
 private:
 	bool do_upgrades (store::write_transaction &, nano::ledger_constants & constants, bool &);
 	void upgrade_v21_to_v22 (store::write_transaction const &);
+	void upgrade_v22_to_v23 (store::write_transaction const &);
+	void upgrade_v23_to_v24 (store::write_transaction const &);
 
 	void open_databases (bool &, store::transaction const &, unsigned);
 
@@ -154,6 +164,8 @@ private:
 
 	friend class mdb_block_store_supported_version_upgrades_Test;
 	friend class mdb_block_store_upgrade_v21_v22_Test;
+	friend class mdb_block_store_upgrade_v22_v23_Test;
+	friend class mdb_block_store_upgrade_v23_v24_Test;
 	friend class block_store_DISABLED_change_dupsort_Test;
 };
 } // namespace nano::store::lmdb
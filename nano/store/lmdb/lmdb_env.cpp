@@ -74,6 +74,10 @@ void nano::store::lmdb::env::init (bool & error_a, std::filesystem::path const &
 
 nano::store::lmdb::env::~env ()
 {
+	{
+		nano::lock_guard<nano::mutex> guard{ read_pool_mutex };
+		read_pool_clear ();
+	}
 	if (environment != nullptr)
 	{
 		// Make sure the commits are flushed. This is a no-op unless MDB_NOSYNC is used.
@@ -102,3 +106,72 @@ MDB_txn * nano::store::lmdb::env::tx (store::transaction const & transaction_a)
 	debug_assert (transaction_a.store_id () == store_id);
 	return static_cast<MDB_txn *> (transaction_a.get_handle ());
 }
+
+void nano::store::lmdb::env::read_pool_resize (std::size_t size)
+{
+	nano::lock_guard<nano::mutex> guard{ read_pool_mutex };
+	read_pool_size = size;
+	while (read_pool.size () > read_pool_size)
+	{
+		mdb_txn_abort (read_pool.back ());
+		read_pool.pop_back ();
+	}
+}
+
+MDB_txn * nano::store::lmdb::env::read_acquire () const
+{
+	MDB_txn * handle{ nullptr };
+	{
+		nano::lock_guard<nano::mutex> guard{ read_pool_mutex };
+		if (!read_pool.empty ())
+		{
+			handle = read_pool.back ();
+			read_pool.pop_back ();
+		}
+	}
+	if (handle != nullptr)
+	{
+		if (mdb_txn_renew (handle) == MDB_SUCCESS)
+		{
+			return handle;
+		}
+		mdb_txn_abort (handle);
+	}
+	auto status (mdb_txn_begin (environment, nullptr, MDB_RDONLY, &handle));
+	if (status == MDB_READERS_FULL)
+	{
+		// Pooled transactions keep their reader slots, give them up for active readers
+		{
+			nano::lock_guard<nano::mutex> guard{ read_pool_mutex };
+			read_pool_clear ();
+		}
+		status = mdb_txn_begin (environment, nullptr, MDB_RDONLY, &handle);
+	}
+	release_assert (status == MDB_SUCCESS, mdb_strerror (status));
+	return handle;
+}
+
+void nano::store::lmdb::env::read_release (MDB_txn * handle) const
+{
+	{
+		nano::lock_guard<nano::mutex> guard{ read_pool_mutex };
+		if (read_pool.size () < read_pool_size)
+		{
+			mdb_txn_reset (handle);
+			read_pool.push_back (handle);
+			return;
+		}
+	}
+	// This uses commit rather than abort, as it is needed when opening databases with a read only transaction
+	auto status (mdb_txn_commit (handle));
+	release_assert (status == MDB_SUCCESS);
+}
+
+void nano::store::lmdb::env::read_pool_clear () const
+{
+	for (auto handle : read_pool)
+	{
+		mdb_txn_abort (handle);
+	}
+	read_pool.clear ();
+}
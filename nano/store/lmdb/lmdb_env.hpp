@@ -2,9 +2,12 @@
 
 #include <nano/lib/id_dispenser.hpp>
 #include <nano/lib/lmdbconfig.hpp>
+#include <nano/lib/locks.hpp>
 #include <nano/store/component.hpp>
 #include <nano/store/lmdb/transaction_impl.hpp>
 
+#include <vector>
+
 namespace
 {
 nano::id_dispenser id_gen;
@@ -67,7 +70,26 @@ public:
 	store::read_transaction tx_begin_read (txn_callbacks callbacks = txn_callbacks{}) const;
 	store::write_transaction tx_begin_write (txn_callbacks callbacks = txn_callbacks{}) const;
 	MDB_txn * tx (store::transaction const & transaction_a) const;
+
+	/**
+	 * Keep up to `size` finished read transactions in the reset state so new readers renew them instead of allocating a transaction and acquiring a reader slot.
+	 * Disabled with a size of 0, which is the default. Databases opened within a pooled transaction are discarded when it is reset, so pooling must only be enabled once all databases are open.
+	 */
+	void read_pool_resize (std::size_t size);
+	/** Renews a pooled read transaction or begins a new one */
+	MDB_txn * read_acquire () const;
+	/** Resets `handle` and returns it to the pool, commits it if the pool is full */
+	void read_release (MDB_txn * handle) const;
+
 	MDB_env * environment;
 	nano::id_dispenser::id_t const store_id{ id_gen.next_id () };
+
+private:
+	/** Aborts all pooled transactions, called with `read_pool_mutex` held */
+	void read_pool_clear () const;
+
+	mutable nano::mutex read_pool_mutex;
+	mutable std::vector<MDB_txn *> read_pool;
+	std::size_t read_pool_size{ 0 };
 };
 } // namespace nano::store::lmdb
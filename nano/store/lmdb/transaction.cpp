@@ -37,18 +37,16 @@ private:
 
 nano::store::lmdb::read_transaction_impl::read_transaction_impl (nano::store::lmdb::env const & environment_a, nano::store::lmdb::txn_callbacks txn_callbacks_a) :
 	store::read_transaction_impl (environment_a.store_id),
+	handle (environment_a.read_acquire ()),
+	env (environment_a),
 	txn_callbacks (txn_callbacks_a)
 {
-	auto status (mdb_txn_begin (environment_a, nullptr, MDB_RDONLY, &handle));
-	release_assert (status == 0);
 	txn_callbacks.txn_start (this);
 }
 
 nano::store::lmdb::read_transaction_impl::~read_transaction_impl ()
 {
-	// This uses commit rather than abort, as it is needed when opening databases with a read only transaction
-	auto status (mdb_txn_commit (handle));
-	release_assert (status == MDB_SUCCESS);
+	env.read_release (handle);
 	txn_callbacks.txn_end (this);
 }
 
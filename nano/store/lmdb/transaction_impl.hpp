@@ -38,6 +38,7 @@ public:
 	void renew () override;
 	void * get_handle () const override;
 	MDB_txn * handle;
+	nano::store::lmdb::env const & env;
 	lmdb::txn_callbacks txn_callbacks;
 };
 
@@ -0,0 +1,65 @@
+#include <nano/secure/parallel_traversal.hpp>
+#include <nano/store/memory/account.hpp>
+#include <nano/store/memory/memory.hpp>
+
+nano::store::memory::account::account (nano::store::memory::component & store_a) :
+	store (store_a){};
+
+void nano::store::memory::account::put (store::write_transaction const & transaction, nano::account const & account, nano::account_info const & info)
+{
+	accounts.put (view_of (transaction), account, info);
+}
+
+bool nano::store::memory::account::get (store::transaction const & transaction, nano::account const & account, nano::account_info & info)
+{
+	auto existing = accounts.get (view_of (transaction), account);
+	if (existing)
+	{
+		info = *existing;
+	}
+	return !existing;
+}
+
+void nano::store::memory::account::del (store::write_transaction const & transaction_a, nano::account const & account_a)
+{
+	accounts.del (view_of (transaction_a), account_a);
+}
+
+bool nano::store::memory::account::exists (store::transaction const & transaction_a, nano::account const & account_a)
+{
+	return accounts.exists (view_of (transaction_a), account_a);
+}
+
+size_t nano::store::memory::account::count (store::transaction const & transaction_a)
+{
+	return accounts.count (view_of (transaction_a));
+}
+
+nano::store::iterator<nano::account, nano::account_info> nano::store::memory::account::begin (store::transaction const & transaction, nano::account const & account) const
+{
+	return make_iterator (accounts, transaction, account);
+}
+
+nano::store::iterator<nano::account, nano::account_info> nano::store::memory::account::begin (store::transaction const & transaction) const
+{
+	return make_iterator (accounts, transaction);
+}
+
+nano::store::iterator<nano::account, nano::account_info> nano::store::memory::account::rbegin (store::transaction const & transaction_a) const
+{
+	return make_reverse_iterator (accounts, transaction_a);
+}
+
+nano::store::iterator<nano::account, nano::account_info> nano::store::memory::account::end () const
+{
+	return store::iterator<nano::account, nano::account_info> (nullptr);
+}
+
+void nano::store::memory::account::for_each_par (std::function<void (store::read_transaction const &, store::iterator<nano::account, nano::account_info>, store::iterator<nano::account, nano::account_info>)> const & action_a) const
+{
+	parallel_traversal<nano::uint256_t> (
+	[&action_a, this] (nano::uint256_t const & start, nano::uint256_t const & end, bool const is_last) {
+		auto transaction (this->store.tx_begin_read ());
+		action_a (transaction, this->begin (transaction, start), !is_last ? this->begin (transaction, end) : this->end ());
+	});
+}
@@ -0,0 +1,159 @@
+#include <nano/crypto_lib/random_pool.hpp>
+#include <nano/secure/parallel_traversal.hpp>
+#include <nano/store/memory/block.hpp>
+#include <nano/store/memory/memory.hpp>
+
+nano::store::memory::block::block (nano::store::memory::component & store_a) :
+	store{ store_a } {};
+
+void nano::store::memory::block::put (store::write_transaction const & transaction, nano::block_hash const & hash, nano::block const & block)
+{
+	debug_assert (block.sideband ().successor.is_zero () || exists (transaction, block.sideband ().successor));
+	std::vector<uint8_t> vector;
+	{
+		nano::vectorstream stream (vector);
+		nano::serialize_block (stream, block);
+		block.sideband ().serialize (stream, block.type ());
+	}
+	raw_put (transaction, vector, hash);
+	// Open blocks and state blocks opening an account have no predecessor
+	if (!block.previous ().is_zero ())
+	{
+		successor_set (transaction, block.previous (), hash);
+	}
+	debug_assert (block.previous ().is_zero () || successor (transaction, block.previous ()) == hash);
+}
+
+void nano::store::memory::block::raw_put (store::write_transaction const & transaction_a, std::vector<uint8_t> const & data, nano::block_hash const & hash_a)
+{
+	blocks.put (view_of (transaction_a), hash_a, data);
+}
+
+nano::block_hash nano::store::memory::block::successor (store::transaction const & transaction_a, nano::block_hash const & hash_a) const
+{
+	nano::block_hash result{ 0 };
+	auto data = blocks.get (view_of (transaction_a), hash_a);
+	if (data)
+	{
+		auto offset = block_successor_offset (*data);
+		std::copy (data->begin () + offset, data->begin () + offset + result.bytes.size (), result.bytes.begin ());
+	}
+	return result;
+}
+
+void nano::store::memory::block::successor_clear (store::write_transaction const & transaction, nano::block_hash const & hash)
+{
+	successor_set (transaction, hash, nano::block_hash{ 0 });
+}
+
+void nano::store::memory::block::successor_set (store::write_transaction const & transaction_a, nano::block_hash const & hash_a, nano::block_hash const & successor_a)
+{
+	auto data = blocks.get (view_of (transaction_a), hash_a);
+	debug_assert (data);
+	if (data)
+	{
+		std::copy (successor_a.bytes.begin (), successor_a.bytes.end (), data->begin () + block_successor_offset (*data));
+		raw_put (transaction_a, *data, hash_a);
+	}
+}
+
+std::shared_ptr<nano::block> nano::store::memory::block::get (store::transaction const & transaction, nano::block_hash const & hash) const
+{
+	auto data = blocks.get (view_of (transaction), hash);
+	return data ? block_w_sideband_from_raw (*data).block : nullptr;
+}
+
+std::optional<nano::block_hash> nano::store::memory::block::get_serialized (store::transaction const & transaction, nano::block_hash const & hash, std::vector<uint8_t> & buffer) const
+{
+	auto data = blocks.get (view_of (transaction), hash);
+	if (!data)
+	{
+		return std::nullopt;
+	}
+	auto sideband_offset = block_successor_offset (*data);
+	release_assert (sideband_offset + sizeof (nano::block_hash) <= data->size ());
+	// Stored value is the network serialization of the block followed by its sideband, which starts with the successor
+	buffer.insert (buffer.end (), data->begin (), data->begin () + sideband_offset);
+	nano::block_hash successor;
+	std::copy (data->begin () + sideband_offset, data->begin () + sideband_offset + sizeof (nano::block_hash), successor.bytes.begin ());
+	return successor;
+}
+
+std::shared_ptr<nano::block> nano::store::memory::block::random (store::transaction const & transaction)
+{
+	nano::block_hash hash;
+	nano::random_pool::generate_block (hash.bytes.data (), hash.bytes.size ());
+	auto existing = begin (transaction, hash);
+	if (existing == end ())
+	{
+		existing = begin (transaction);
+	}
+	debug_assert (existing != end ());
+	return existing->second.block;
+}
+
+void nano::store::memory::block::del (store::write_transaction const & transaction_a, nano::block_hash const & hash_a)
+{
+	blocks.del (view_of (transaction_a), hash_a);
+}
+
+bool nano::store::memory::block::exists (store::transaction const & transaction, nano::block_hash const & hash)
+{
+	return blocks.exists (view_of (transaction), hash);
+}
+
+uint64_t nano::store::memory::block::count (store::transaction const & transaction_a)
+{
+	return blocks.count (view_of (transaction_a));
+}
+
+nano::store::iterator<nano::block_hash, nano::store::block_w_sideband> nano::store::memory::block::begin (store::transaction const & transaction) const
+{
+	auto const & view = view_of (transaction);
+	auto const start = blocks.start ();
+	return blocks.wrap<nano::block_hash, nano::store::block_w_sideband> (std::make_unique<memory::iterator<nano::block_hash, nano::store::block_w_sideband, std::vector<uint8_t>>> (blocks, view, blocks.first (view), block_w_sideband_from_raw), start);
+}
+
+nano::store::iterator<nano::block_hash, nano::store::block_w_sideband> nano::store::memory::block::begin (store::transaction const & transaction, nano::block_hash const & hash) const
+{
+	auto const & view = view_of (transaction);
+	auto const start = blocks.start ();
+	return blocks.wrap<nano::block_hash, nano::store::block_w_sideband> (std::make_unique<memory::iterator<nano::block_hash, nano::store::block_w_sideband, std::vector<uint8_t>>> (blocks, view, blocks.lower_bound (view, hash), block_w_sideband_from_raw), start);
+}
+
+nano::store::iterator<nano::block_hash, nano::store::block_w_sideband> nano::store::memory::block::end () const
+{
+	return store::iterator<nano::block_hash, nano::store::block_w_sideband> (nullptr);
+}
+
+void nano::store::memory::block::for_each_par (std::function<void (store::read_transaction const &, store::iterator<nano::block_hash, block_w_sideband>, store::iterator<nano::block_hash, block_w_sideband>)> const & action_a) const
+{
+	parallel_traversal<nano::uint256_t> (
+	[&action_a, this] (nano::uint256_t const & start, nano::uint256_t const & end, bool const is_last) {
+		auto transaction (this->store.tx_begin_read ());
+		action_a (transaction, this->begin (transaction, start), !is_last ? this->begin (transaction, end) : this->end ());
+	});
+}
+
+size_t nano::store::memory::block::block_successor_offset (std::vector<uint8_t> const & data_a)
+{
+	debug_assert (!data_a.empty ());
+	// The block type is the first byte
+	auto type = static_cast<nano::block_type> (data_a[0]);
+	return data_a.size () - nano::block_sideband::size (type);
+}
+
+nano::store::block_w_sideband nano::store::memory::block::block_w_sideband_from_raw (std::vector<uint8_t> const & data_a)
+{
+	nano::bufferstream stream (data_a.data (), data_a.size ());
+	nano::block_type type;
+	auto error (try_read (stream, type));
+	release_assert (!error);
+	nano::store::block_w_sideband result;
+	result.block = nano::deserialize_block (stream, type);
+	release_assert (result.block != nullptr);
+	error = result.sideband.deserialize (stream, type);
+	release_assert (!error);
+	result.block->sideband_set (result.sideband);
+	return result;
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <nano/store/block.hpp>
+#include <nano/store/memory/table.hpp>
+
+namespace nano::store::memory
+{
+class component;
+}
+namespace nano::store::memory
+{
+class block : public nano::store::block
+{
+public:
+	explicit block (nano::store::memory::component & store_a);
+	void put (store::write_transaction const & transaction_a, nano::block_hash const & hash_a, nano::block const & block_a) override;
+	void raw_put (store::write_transaction const & transaction_a, std::vector<uint8_t> const & data, nano::block_hash const & hash_a) override;
+	nano::block_hash successor (store::transaction const & transaction_a, nano::block_hash const & hash_a) const override;
+	void successor_clear (store::write_transaction const & transaction_a, nano::block_hash const & hash_a) override;
+	std::shared_ptr<nano::block> get (store::transaction const & transaction_a, nano::block_hash const & hash_a) const override;
+	std::optional<nano::block_hash> get_serialized (store::transaction const & transaction_a, nano::block_hash const & hash_a, std::vector<uint8_t> & buffer) const override;
+	std::shared_ptr<nano::block> random (store::transaction const & transaction_a) override;
+	void del (store::write_transaction const & transaction_a, nano::block_hash const & hash_a) override;
+	bool exists (store::transaction const & transaction_a, nano::block_hash const & hash_a) override;
+	uint64_t count (store::transaction const & transaction_a) override;
+	store::iterator<nano::block_hash, nano::store::block_w_sideband> begin (store::transaction const & transaction_a) const override;
+	store::iterator<nano::block_hash, nano::store::block_w_sideband> begin (store::transaction const & transaction_a, nano::block_hash const & hash_a) const override;
+	store::iterator<nano::block_hash, nano::store::block_w_sideband> end () const override;
+	void for_each_par (std::function<void (store::read_transaction const &, store::iterator<nano::block_hash, block_w_sideband>, store::iterator<nano::block_hash, block_w_sideband>)> const & action_a) const override;
+
+	/**
+	 * Maps block hash to the same value the other backends store: block type, serialized block and sideband, which starts with the successor
+	 * nano::block_hash -> nano::block_type, nano::block, nano::block_sideband
+	 */
+	memory::table<nano::block_hash, std::vector<uint8_t>> blocks;
+
+private:
+	nano::store::memory::component & store;
+
+	/** Sets the successor stored in the sideband of `hash_a`, zero clears it */
+	void successor_set (store::write_transaction const & transaction_a, nano::block_hash const & hash_a, nano::block_hash const & successor_a);
+	static size_t block_successor_offset (std::vector<uint8_t> const & data_a);
+	static nano::store::block_w_sideband block_w_sideband_from_raw (std::vector<uint8_t> const & data_a);
+};
+} // namespace nano::store::memory
@@ -0,0 +1,77 @@
+#include <nano/secure/parallel_traversal.hpp>
+#include <nano/store/memory/confirmation_height.hpp>
+#include <nano/store/memory/memory.hpp>
+
+nano::store::memory::confirmation_height::confirmation_height (nano::store::memory::component & store) :
+	store{ store }
+{
+}
+
+void nano::store::memory::confirmation_height::put (store::write_transaction const & transaction, nano::account const & account, nano::confirmation_height_info const & confirmation_height_info)
+{
+	confirmation_heights.put (view_of (transaction), account, confirmation_height_info);
+}
+
+bool nano::store::memory::confirmation_height::get (store::transaction const & transaction, nano::account const & account, nano::confirmation_height_info & confirmation_height_info)
+{
+	auto existing = confirmation_heights.get (view_of (transaction), account);
+	if (existing)
+	{
+		confirmation_height_info = *existing;
+	}
+	else
+	{
+		confirmation_height_info.height = 0;
+		confirmation_height_info.frontier = 0;
+	}
+	return !existing;
+}
+
+bool nano::store::memory::confirmation_height::exists (store::transaction const & transaction, nano::account const & account) const
+{
+	return confirmation_heights.exists (view_of (transaction), account);
+}
+
+void nano::store::memory::confirmation_height::del (store::write_transaction const & transaction, nano::account const & account)
+{
+	confirmation_heights.del (view_of (transaction), account);
+}
+
+uint64_t nano::store::memory::confirmation_height::count (store::transaction const & transaction_a)
+{
+	return confirmation_heights.count (view_of (transaction_a));
+}
+
+void nano::store::memory::confirmation_height::clear (store::write_transaction const & transaction_a, nano::account const & account_a)
+{
+	del (transaction_a, account_a);
+}
+
+void nano::store::memory::confirmation_height::clear (store::write_transaction const & transaction_a)
+{
+	confirmation_heights.clear (view_of (transaction_a));
+}
+
+nano::store::iterator<nano::account, nano::confirmation_height_info> nano::store::memory::confirmation_height::begin (store::transaction const & transaction, nano::account const & account) const
+{
+	return make_iterator (confirmation_heights, transaction, account);
+}
+
+nano::store::iterator<nano::account, nano::confirmation_height_info> nano::store::memory::confirmation_height::begin (store::transaction const & transaction) const
+{
+	return make_iterator (confirmation_heights, transaction);
+}
+
+nano::store::iterator<nano::account, nano::confirmation_height_info> nano::store::memory::confirmation_height::end () const
+{
+	return store::iterator<nano::account, nano::confirmation_height_info> (nullptr);
+}
+
+void nano::store::memory::confirmation_height::for_each_par (std::function<void (store::read_transaction const &, store::iterator<nano::account, nano::confirmation_height_info>, store::iterator<nano::account, nano::confirmation_height_info>)> const & action_a) const
+{
+	parallel_traversal<nano::uint256_t> (
+	[&action_a, this] (nano::uint256_t const & start, nano::uint256_t const & end, bool const is_last) {
+		auto transaction (this->store.tx_begin_read ());
+		action_a (transaction, this->begin (transaction, start), !is_last ? this->begin (transaction, end) : this->end ());
+	});
+}
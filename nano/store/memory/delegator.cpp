@@ -0,0 +1,45 @@
+#include <nano/store/memory/delegator.hpp>
+#include <nano/store/memory/memory.hpp>
+
+nano::store::memory::delegator::delegator (nano::store::memory::component & store_a) :
+	store{ store_a } {};
+
+void nano::store::memory::delegator::put (store::write_transaction const & transaction_a, nano::delegator_key const & key_a)
+{
+	delegators.put (view_of (transaction_a), key_a, nullptr);
+}
+
+void nano::store::memory::delegator::del (store::write_transaction const & transaction_a, nano::delegator_key const & key_a)
+{
+	delegators.del (view_of (transaction_a), key_a);
+}
+
+bool nano::store::memory::delegator::exists (store::transaction const & transaction_a, nano::delegator_key const & key_a) const
+{
+	return delegators.exists (view_of (transaction_a), key_a);
+}
+
+size_t nano::store::memory::delegator::count (store::transaction const & transaction_a) const
+{
+	return delegators.count (view_of (transaction_a));
+}
+
+void nano::store::memory::delegator::clear (store::write_transaction const & transaction_a)
+{
+	delegators.clear (view_of (transaction_a));
+}
+
+nano::store::iterator<nano::delegator_key, std::nullptr_t> nano::store::memory::delegator::begin (store::transaction const & transaction_a, nano::delegator_key const & key_a) const
+{
+	return make_iterator (delegators, transaction_a, key_a);
+}
+
+nano::store::iterator<nano::delegator_key, std::nullptr_t> nano::store::memory::delegator::begin (store::transaction const & transaction_a) const
+{
+	return make_iterator (delegators, transaction_a);
+}
+
+nano::store::iterator<nano::delegator_key, std::nullptr_t> nano::store::memory::delegator::end () const
+{
+	return store::iterator<nano::delegator_key, std::nullptr_t> (nullptr);
+}
@@ -0,0 +1,83 @@
+#include <nano/secure/parallel_traversal.hpp>
+#include <nano/store/memory/final_vote.hpp>
+#include <nano/store/memory/memory.hpp>
+
+nano::store::memory::final_vote::final_vote (nano::store::memory::component & store) :
+	store{ store } {};
+
+bool nano::store::memory::final_vote::put (store::write_transaction const & transaction, nano::qualified_root const & root, nano::block_hash const & hash)
+{
+	auto const & view = view_of (transaction);
+	auto existing = final_votes.get (view, root);
+	if (existing)
+	{
+		return *existing == hash;
+	}
+	final_votes.put (view, root, hash);
+	return true;
+}
+
+std::vector<nano::block_hash> nano::store::memory::final_vote::get (store::transaction const & transaction, nano::root const & root_a)
+{
+	std::vector<nano::block_hash> result;
+	nano::qualified_root key_start{ root_a.raw, 0 };
+	for (auto i = begin (transaction, key_start), n = end (); i != n && nano::qualified_root{ i->first }.root () == root_a; ++i)
+	{
+		result.push_back (i->second);
+	}
+	return result;
+}
+
+void nano::store::memory::final_vote::del (store::write_transaction const & transaction, nano::root const & root)
+{
+	std::vector<nano::qualified_root> final_vote_qualified_roots;
+	for (auto i = begin (transaction, nano::qualified_root{ root.raw, 0 }), n = end (); i != n && nano::qualified_root{ i->first }.root () == root; ++i)
+	{
+		final_vote_qualified_roots.push_back (i->first);
+	}
+
+	auto const & view = view_of (transaction);
+	for (auto & final_vote_qualified_root : final_vote_qualified_roots)
+	{
+		final_votes.del (view, final_vote_qualified_root);
+	}
+}
+
+size_t nano::store::memory::final_vote::count (store::transaction const & transaction_a) const
+{
+	return final_votes.count (view_of (transaction_a));
+}
+
+void nano::store::memory::final_vote::clear (store::write_transaction const & transaction_a, nano::root const & root_a)
+{
+	del (transaction_a, root_a);
+}
+
+void nano::store::memory::final_vote::clear (store::write_transaction const & transaction_a)
+{
+	final_votes.clear (view_of (transaction_a));
+}
+
+nano::store::iterator<nano::qualified_root, nano::block_hash> nano::store::memory::final_vote::begin (store::transaction const & transaction, nano::qualified_root const & root) const
+{
+	return make_iterator (final_votes, transaction, root);
+}
+
+nano::store::iterator<nano::qualified_root, nano::block_hash> nano::store::memory::final_vote::begin (store::transaction const & transaction) const
+{
+	return make_iterator (final_votes, transaction);
+}
+
+nano::store::iterator<nano::qualified_root, nano::block_hash> nano::store::memory::final_vote::end () const
+{
+	return store::iterator<nano::qualified_root, nano::block_hash> (nullptr);
+}
+
+void nano::store::memory::final_vote::for_each_par (std::function<void (store::read_transaction const &, store::iterator<nano::qualified_root, nano::block_hash>, store::iterator<nano::qualified_root, nano::block_hash>)> const & action_a) const
+{
+	parallel_traversal<nano::uint512_t> (
+	[&action_a, this] (nano::uint512_t const & start, nano::uint512_t const & end, bool const is_last) {
+		auto transaction (this->store.tx_begin_read ());
+		action_a (transaction, this->begin (transaction, start), !is_last ? this->begin (transaction, end) : this->end ());
+	});
+}
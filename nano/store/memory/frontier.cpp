@@ -0,0 +1,47 @@
+#include <nano/secure/parallel_traversal.hpp>
+#include <nano/store/memory/frontier.hpp>
+#include <nano/store/memory/memory.hpp>
+
+nano::store::memory::frontier::frontier (nano::store::memory::component & store) :
+	store{ store }
+{
+}
+
+void nano::store::memory::frontier::put (store::write_transaction const & transaction, nano::block_hash const & hash, nano::account const & account)
+{
+	frontiers.put (view_of (transaction), hash, account);
+}
+
+nano::account nano::store::memory::frontier::get (store::transaction const & transaction, nano::block_hash const & hash) const
+{
+	return frontiers.get (view_of (transaction), hash).value_or (nano::account{});
+}
+
+void nano::store::memory::frontier::del (store::write_transaction const & transaction, nano::block_hash const & hash)
+{
+	frontiers.del (view_of (transaction), hash);
+}
+
+nano::store::iterator<nano::block_hash, nano::account> nano::store::memory::frontier::begin (store::transaction const & transaction) const
+{
+	return make_iterator (frontiers, transaction);
+}
+
+nano::store::iterator<nano::block_hash, nano::account> nano::store::memory::frontier::begin (store::transaction const & transaction, nano::block_hash const & hash) const
+{
+	return make_iterator (frontiers, transaction, hash);
+}
+
+nano::store::iterator<nano::block_hash, nano::account> nano::store::memory::frontier::end () const
+{
+	return store::iterator<nano::block_hash, nano::account> (nullptr);
+}
+
+void nano::store::memory::frontier::for_each_par (std::function<void (store::read_transaction const &, store::iterator<nano::block_hash, nano::account>, store::iterator<nano::block_hash, nano::account>)> const & action_a) const
+{
+	parallel_traversal<nano::uint256_t> (
+	[&action_a, this] (nano::uint256_t const & start, nano::uint256_t const & end, bool const is_last) {
+		auto transaction (this->store.tx_begin_read ());
+		action_a (transaction, this->begin (transaction, start), !is_last ? this->begin (transaction, end) : this->end ());
+	});
+}
@@ -0,0 +1,220 @@
+#include <nano/store/memory/memory.hpp>
+
+#include <boost/lexical_cast.hpp>
+#include <boost/property_tree/ptree.hpp>
+
+#include <cstdlib>
+#include <limits>
+
+nano::store::memory::component::component () :
+	// clang-format off
+	nano::store::component{
+		block_store,
+		frontier_store,
+		account_store,
+		pending_store,
+		online_weight_store,
+		pruned_store,
+		peer_store,
+		confirmation_height_store,
+		final_vote_store,
+		delegator_store,
+		receivable_amount_store,
+		version_store
+	},
+	// clang-format on
+	account_store{ *this },
+	block_store{ *this },
+	confirmation_height_store{ *this },
+	delegator_store{ *this },
+	receivable_amount_store{ *this },
+	final_vote_store{ *this },
+	frontier_store{ *this },
+	online_weight_store{ *this },
+	peer_store{ *this },
+	pending_store{ *this },
+	pruned_store{ *this },
+	version_store{ *this }
+{
+	for (auto [id, table] : all_tables ())
+	{
+		table->instrument (instrumentation, id);
+	}
+	// A memory store is always fresh, there is nothing to upgrade
+	version.put (tx_begin_write (), version_current);
+}
+
+nano::store::write_transaction nano::store::memory::component::tx_begin_write (std::vector<nano::tables> const &, std::vector<nano::tables> const &)
+{
+	return store::write_transaction{ std::make_unique<nano::store::memory::write_transaction_impl> (*this) };
+}
+
+nano::store::read_transaction nano::store::memory::component::tx_begin_read () const
+{
+	return store::read_transaction{ std::make_unique<nano::store::memory::read_transaction_impl> (*this) };
+}
+
+std::string nano::store::memory::component::vendor_get () const
+{
+	return "Memory";
+}
+
+void nano::store::memory::component::serialize_memory_stats (boost::property_tree::ptree & json)
+{
+	std::size_t entries{ 0 };
+	for (auto [id, table] : all_tables ())
+	{
+		entries += table->size ();
+	}
+	json.put ("entries", entries);
+	nano::lock_guard<nano::mutex> lock{ readers_mutex };
+	json.put ("version", committed);
+	json.put ("readers", readers.size ());
+}
+
+unsigned nano::store::memory::component::max_block_write_batch_num () const
+{
+	return std::numeric_limits<unsigned>::max ();
+}
+
+uint64_t nano::store::memory::component::count (store::transaction const & transaction_a, tables table_a) const
+{
+	return table_of (table_a).count (view_of (transaction_a));
+}
+
+int nano::store::memory::component::drop (store::write_transaction const & transaction_a, tables table_a)
+{
+	const_cast<memory::table_base &> (table_of (table_a)).clear (view_of (transaction_a));
+	return status_success;
+}
+
+bool nano::store::memory::component::not_found (int status) const
+{
+	return status == status_not_found;
+}
+
+bool nano::store::memory::component::success (int status) const
+{
+	return status == status_success;
+}
+
+int nano::store::memory::component::status_code_not_found () const
+{
+	return status_not_found;
+}
+
+std::string nano::store::memory::component::error_string (int status) const
+{
+	return success (status) ? "Success" : not_found (status) ? "Not found" : "Unknown error";
+}
+
+bool nano::store::memory::component::copy_db (std::filesystem::path const &)
+{
+	return false;
+}
+
+void nano::store::memory::component::rebuild_db (store::write_transaction const &)
+{
+	// Entries are kept sorted in memory, there is nothing to compact
+}
+
+bool nano::store::memory::component::init_error () const
+{
+	return false;
+}
+
+bool nano::store::memory::component::using_memory_store_in_tests ()
+{
+	auto use_memory_store_str = std::getenv ("TEST_USE_MEMORY_STORE");
+	return use_memory_store_str && (boost::lexical_cast<int> (use_memory_store_str) == 1);
+}
+
+nano::store::memory::table_base const & nano::store::memory::component::table_of (tables table_a) const
+{
+	switch (table_a)
+	{
+		case tables::accounts:
+			return account_store.accounts;
+		case tables::blocks:
+			return block_store.blocks;
+		case tables::confirmation_height:
+			return confirmation_height_store.confirmation_heights;
+		case tables::delegators:
+			return delegator_store.delegators;
+		case tables::final_votes:
+			return final_vote_store.final_votes;
+		case tables::frontiers:
+			return frontier_store.frontiers;
+		case tables::meta:
+			return version_store.meta;
+		case tables::online_weight:
+			return online_weight_store.online_weights;
+		case tables::peers:
+			return peer_store.peers;
+		case tables::pending:
+			return pending_store.pendings;
+		case tables::pruned:
+			return pruned_store.pruned_blocks;
+		case tables::receivable_amounts:
+			return receivable_amount_store.receivable_amounts;
+		default:
+			release_assert (false);
+			return version_store.meta;
+	}
+}
+
+std::vector<std::pair<nano::tables, nano::store::memory::table_base *>> nano::store::memory::component::all_tables ()
+{
+	// clang-format off
+	return {
+		{ tables::accounts, &account_store.accounts },
+		{ tables::blocks, &block_store.blocks },
+		{ tables::confirmation_height, &confirmation_height_store.confirmation_heights },
+		{ tables::delegators, &delegator_store.delegators },
+		{ tables::final_votes, &final_vote_store.final_votes },
+		{ tables::frontiers, &frontier_store.frontiers },
+		{ tables::meta, &version_store.meta },
+		{ tables::online_weight, &online_weight_store.online_weights },
+		{ tables::peers, &peer_store.peers },
+		{ tables::pending, &pending_store.pendings },
+		{ tables::pruned, &pruned_store.pruned_blocks },
+		{ tables::receivable_amounts, &receivable_amount_store.receivable_amounts }
+	};
+	// clang-format on
+}
+
+nano::store::memory::view nano::store::memory::component::begin_read () const
+{
+	nano::lock_guard<nano::mutex> lock{ readers_mutex };
+	readers.insert (committed);
+	return memory::view{ committed, false, committed };
+}
+
+void nano::store::memory::component::end_read (memory::view const & view_a) const
+{
+	nano::lock_guard<nano::mutex> lock{ readers_mutex };
+	auto existing = readers.find (view_a.version);
+	debug_assert (existing != readers.end ());
+	readers.erase (existing);
+}
+
+nano::store::memory::view nano::store::memory::component::begin_write ()
+{
+	nano::lock_guard<nano::mutex> lock{ readers_mutex };
+	return memory::view{ committed + 1, true, readers.empty () ? committed : *readers.begin () };
+}
+
+void nano::store::memory::component::commit (memory::view const & view_a)
+{
+	uint64_t oldest{ 0 };
+	{
+		nano::lock_guard<nano::mutex> lock{ readers_mutex };
+		debug_assert (view_a.version == committed + 1);
+		committed = view_a.version;
+		oldest = readers.empty () ? committed : *readers.begin ();
+	}
+	for (auto [id, table] : all_tables ())
+	{
+		table->collect (oldest);
+	}
+}
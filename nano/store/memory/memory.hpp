@@ -0,0 +1,97 @@
+#pragma once
+
+#include <nano/lib/locks.hpp>
+#include <nano/store/component.hpp>
+#include <nano/store/memory/account.hpp>
+#include <nano/store/memory/block.hpp>
+#include <nano/store/memory/confirmation_height.hpp>
+#include <nano/store/memory/delegator.hpp>
+#include <nano/store/memory/final_vote.hpp>
+#include <nano/store/memory/frontier.hpp>
+#include <nano/store/memory/online_weight.hpp>
+#include <nano/store/memory/peer.hpp>
+#include <nano/store/memory/pending.hpp>
+#include <nano/store/memory/pruned.hpp>
+#include <nano/store/memory/receivable_amount.hpp>
+#include <nano/store/memory/table.hpp>
+#include <nano/store/memory/transaction_impl.hpp>
+#include <nano/store/memory/version.hpp>
+
+#include <set>
+
+namespace nano::store::memory
+{
+/**
+ * In-memory implementation of the block store, nothing is persisted.
+ * Every table is a sorted map from key to a short chain of versions. Read transactions are snapshots of the last committed version
+ * and never block, a single write transaction at a time builds the next version which becomes visible to new readers once committed.
+ */
+class component : public nano::store::component
+{
+private:
+	nano::store::memory::account account_store;
+	nano::store::memory::block block_store;
+	nano::store::memory::confirmation_height confirmation_height_store;
+	nano::store::memory::delegator delegator_store;
+	nano::store::memory::final_vote final_vote_store;
+	nano::store::memory::frontier frontier_store;
+	nano::store::memory::online_weight online_weight_store;
+	nano::store::memory::peer peer_store;
+	nano::store::memory::pending pending_store;
+	nano::store::memory::pruned pruned_store;
+	nano::store::memory::receivable_amount receivable_amount_store;
+	nano::store::memory::version version_store;
+
+	friend class nano::store::memory::read_transaction_impl;
+	friend class nano::store::memory::write_transaction_impl;
+
+public:
+	component ();
+	store::write_transaction tx_begin_write (std::vector<nano::tables> const & tables_requiring_lock = {}, std::vector<nano::tables> const & tables_no_lock = {}) override;
+	store::read_transaction tx_begin_read () const override;
+
+	std::string vendor_get () const override;
+
+	void serialize_memory_stats (boost::property_tree::ptree &) override;
+
+	unsigned max_block_write_batch_num () const override;
+
+	uint64_t count (store::transaction const & transaction_a, tables table_a) const override;
+	int drop (store::write_transaction const & transaction_a, tables table_a) override;
+	bool not_found (int status) const override;
+	bool success (int status) const override;
+	int status_code_not_found () const override;
+	std::string error_string (int status) const override;
+
+	/** Snapshots cannot be copied to disk, always fails */
+	bool copy_db (std::filesystem::path const & destination_file) override;
+	void rebuild_db (store::write_transaction const & transaction_a) override;
+
+	bool init_error () const override;
+
+	/** Set the environment variable TEST_USE_MEMORY_STORE=1 to run tests against the memory store */
+	static bool using_memory_store_in_tests ();
+
+private:
+	memory::table_base const & table_of (tables table_a) const;
+	std::vector<std::pair<nano::tables, memory::table_base *>> all_tables ();
+
+	/** Registers a reader at the last committed version */
+	memory::view begin_read () const;
+	void end_read (memory::view const &) const;
+	/** Called with `write_mutex` held */
+	memory::view begin_write ();
+	/** Publishes the version written by the write transaction and collects what readers can no longer see */
+	void commit (memory::view const &);
+
+	/** Held by the write transaction for its whole lifetime */
+	nano::mutex write_mutex;
+	mutable nano::mutex readers_mutex;
+	uint64_t committed{ 0 };
+	/** Versions active read transactions are looking at */
+	mutable std::multiset<uint64_t> readers;
+
+	static int constexpr status_success{ 0 };
+	static int constexpr status_not_found{ 1 };
+};
+} // namespace nano::store::memory
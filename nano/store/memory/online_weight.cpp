@@ -0,0 +1,42 @@
+#include <nano/store/memory/memory.hpp>
+#include <nano/store/memory/online_weight.hpp>
+
+nano::store::memory::online_weight::online_weight (nano::store::memory::component & store_a) :
+	store{ store_a }
+{
+}
+
+void nano::store::memory::online_weight::put (store::write_transaction const & transaction, uint64_t time, nano::amount const & amount)
+{
+	online_weights.put (view_of (transaction), time, amount);
+}
+
+void nano::store::memory::online_weight::del (store::write_transaction const & transaction, uint64_t time)
+{
+	online_weights.del (view_of (transaction), time);
+}
+
+nano::store::iterator<uint64_t, nano::amount> nano::store::memory::online_weight::begin (store::transaction const & transaction) const
+{
+	return make_iterator (online_weights, transaction);
+}
+
+nano::store::iterator<uint64_t, nano::amount> nano::store::memory::online_weight::rbegin (store::transaction const & transaction) const
+{
+	return make_reverse_iterator (online_weights, transaction);
+}
+
+nano::store::iterator<uint64_t, nano::amount> nano::store::memory::online_weight::end () const
+{
+	return store::iterator<uint64_t, nano::amount> (nullptr);
+}
+
+size_t nano::store::memory::online_weight::count (store::transaction const & transaction) const
+{
+	return online_weights.count (view_of (transaction));
+}
+
+void nano::store::memory::online_weight::clear (store::write_transaction const & transaction)
+{
+	online_weights.clear (view_of (transaction));
+}
@@ -0,0 +1,40 @@
+#include <nano/store/memory/memory.hpp>
+#include <nano/store/memory/peer.hpp>
+
+nano::store::memory::peer::peer (nano::store::memory::component & store) :
+	store{ store } {};
+
+void nano::store::memory::peer::put (store::write_transaction const & transaction, nano::endpoint_key const & endpoint)
+{
+	peers.put (view_of (transaction), endpoint, nano::no_value::dummy);
+}
+
+void nano::store::memory::peer::del (store::write_transaction const & transaction, nano::endpoint_key const & endpoint)
+{
+	peers.del (view_of (transaction), endpoint);
+}
+
+bool nano::store::memory::peer::exists (store::transaction const & transaction, nano::endpoint_key const & endpoint) const
+{
+	return peers.exists (view_of (transaction), endpoint);
+}
+
+size_t nano::store::memory::peer::count (store::transaction const & transaction) const
+{
+	return peers.count (view_of (transaction));
+}
+
+void nano::store::memory::peer::clear (store::write_transaction const & transaction)
+{
+	peers.clear (view_of (transaction));
+}
+
+nano::store::iterator<nano::endpoint_key, nano::no_value> nano::store::memory::peer::begin (store::transaction const & transaction) const
+{
+	return make_iterator (peers, transaction);
+}
+
+nano::store::iterator<nano::endpoint_key, nano::no_value> nano::store::memory::peer::end () const
+{
+	return store::iterator<nano::endpoint_key, nano::no_value> (nullptr);
+}
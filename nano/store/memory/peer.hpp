@@ -0,0 +1,33 @@
+#pragma once
+
+#include <nano/store/memory/table.hpp>
+#include <nano/store/peer.hpp>
+
+namespace nano::store::memory
+{
+class component;
+}
+namespace nano::store::memory
+{
+class peer : public nano::store::peer
+{
+private:
+	nano::store::memory::component & store;
+
+public:
+	explicit peer (nano::store::memory::component & store_a);
+	void put (store::write_transaction const & transaction_a, nano::endpoint_key const & endpoint_a) override;
+	void del (store::write_transaction const & transaction_a, nano::endpoint_key const & endpoint_a) override;
+	bool exists (store::transaction const & transaction_a, nano::endpoint_key const & endpoint_a) const override;
+	size_t count (store::transaction const & transaction_a) const override;
+	void clear (store::write_transaction const & transaction_a) override;
+	store::iterator<nano::endpoint_key, nano::no_value> begin (store::transaction const & transaction_a) const override;
+	store::iterator<nano::endpoint_key, nano::no_value> end () const override;
+
+	/*
+	 * Endpoints for peers
+	 * nano::endpoint_key -> no_value
+	 */
+	memory::table<nano::endpoint_key, nano::no_value> peers;
+};
+} // namespace nano::store::memory
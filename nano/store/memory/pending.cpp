@@ -0,0 +1,65 @@
+#include <nano/secure/parallel_traversal.hpp>
+#include <nano/store/memory/memory.hpp>
+#include <nano/store/memory/pending.hpp>
+
+nano::store::memory::pending::pending (nano::store::memory::component & store) :
+	store{ store } {};
+
+void nano::store::memory::pending::put (store::write_transaction const & transaction, nano::pending_key const & key, nano::pending_info const & pending)
+{
+	pendings.put (view_of (transaction), key, pending);
+}
+
+void nano::store::memory::pending::del (store::write_transaction const & transaction, nano::pending_key const & key)
+{
+	pendings.del (view_of (transaction), key);
+}
+
+bool nano::store::memory::pending::get (store::transaction const & transaction, nano::pending_key const & key, nano::pending_info & pending_a)
+{
+	auto existing = pendings.get (view_of (transaction), key);
+	if (existing)
+	{
+		pending_a = *existing;
+	}
+	return !existing;
+}
+
+bool nano::store::memory::pending::exists (store::transaction const & transaction_a, nano::pending_key const & key_a)
+{
+	return pendings.exists (view_of (transaction_a), key_a);
+}
+
+bool nano::store::memory::pending::any (store::transaction const & transaction_a, nano::account const & account_a)
+{
+	auto iterator (begin (transaction_a, nano::pending_key (account_a, 0)));
+	return iterator != end () && nano::pending_key (iterator->first).account == account_a;
+}
+
+nano::store::iterator<nano::pending_key, nano::pending_info> nano::store::memory::pending::begin (store::transaction const & transaction_a, nano::pending_key const & key_a) const
+{
+	return make_iterator (pendings, transaction_a, key_a);
+}
+
+nano::store::iterator<nano::pending_key, nano::pending_info> nano::store::memory::pending::begin (store::transaction const & transaction_a) const
+{
+	return make_iterator (pendings, transaction_a);
+}
+
+nano::store::iterator<nano::pending_key, nano::pending_info> nano::store::memory::pending::end () const
+{
+	return store::iterator<nano::pending_key, nano::pending_info> (nullptr);
+}
+
+void nano::store::memory::pending::for_each_par (std::function<void (store::read_transaction const &, store::iterator<nano::pending_key, nano::pending_info>, store::iterator<nano::pending_key, nano::pending_info>)> const & action_a) const
+{
+	parallel_traversal<nano::uint512_t> (
+	[&action_a, this] (nano::uint512_t const & start, nano::uint512_t const & end, bool const is_last) {
+		nano::uint512_union union_start (start);
+		nano::uint512_union union_end (end);
+		nano::pending_key key_start (union_start.uint256s[0].number (), union_start.uint256s[1].number ());
+		nano::pending_key key_end (union_end.uint256s[0].number (), union_end.uint256s[1].number ());
+		auto transaction (this->store.tx_begin_read ());
+		action_a (transaction, this->begin (transaction, key_start), !is_last ? this->begin (transaction, key_end) : this->end ());
+	});
+}
@@ -0,0 +1,68 @@
+#include <nano/crypto_lib/random_pool.hpp>
+#include <nano/secure/parallel_traversal.hpp>
+#include <nano/store/memory/memory.hpp>
+#include <nano/store/memory/pruned.hpp>
+
+nano::store::memory::pruned::pruned (nano::store::memory::component & store_a) :
+	store{ store_a } {};
+
+void nano::store::memory::pruned::put (store::write_transaction const & transaction_a, nano::block_hash const & hash_a)
+{
+	pruned_blocks.put (view_of (transaction_a), hash_a, nullptr);
+}
+
+void nano::store::memory::pruned::del (store::write_transaction const & transaction_a, nano::block_hash const & hash_a)
+{
+	pruned_blocks.del (view_of (transaction_a), hash_a);
+}
+
+bool nano::store::memory::pruned::exists (store::transaction const & transaction, nano::block_hash const & hash_a) const
+{
+	return pruned_blocks.exists (view_of (transaction), hash_a);
+}
+
+nano::block_hash nano::store::memory::pruned::random (store::transaction const & transaction)
+{
+	nano::block_hash random_hash;
+	nano::random_pool::generate_block (random_hash.bytes.data (), random_hash.bytes.size ());
+	auto existing = begin (transaction, random_hash);
+	if (existing == end ())
+	{
+		existing = begin (transaction);
+	}
+	return existing != end () ? existing->first : 0;
+}
+
+size_t nano::store::memory::pruned::count (store::transaction const & transaction_a) const
+{
+	return pruned_blocks.count (view_of (transaction_a));
+}
+
+void nano::store::memory::pruned::clear (store::write_transaction const & transaction_a)
+{
+	pruned_blocks.clear (view_of (transaction_a));
+}
+
+nano::store::iterator<nano::block_hash, std::nullptr_t> nano::store::memory::pruned::begin (store::transaction const & transaction, nano::block_hash const & hash) const
+{
+	return make_iterator (pruned_blocks, transaction, hash);
+}
+
+nano::store::iterator<nano::block_hash, std::nullptr_t> nano::store::memory::pruned::begin (store::transaction const & transaction) const
+{
+	return make_iterator (pruned_blocks, transaction);
+}
+
+nano::store::iterator<nano::block_hash, std::nullptr_t> nano::store::memory::pruned::end () const
+{
+	return store::iterator<nano::block_hash, std::nullptr_t> (nullptr);
+}
+
+void nano::store::memory::pruned::for_each_par (std::function<void (store::read_transaction const &, store::iterator<nano::block_hash, std::nullptr_t>, store::iterator<nano::block_hash, std::nullptr_t>)> const & action_a) const
+{
+	parallel_traversal<nano::uint256_t> (
+	[&action_a, this] (nano::uint256_t const & start, nano::uint256_t const & end, bool const is_last) {
+		auto transaction (this->store.tx_begin_read ());
+		action_a (transaction, this->begin (transaction, start), !is_last ? this->begin (transaction, end) : this->end ());
+	});
+}
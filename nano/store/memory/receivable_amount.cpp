@@ -0,0 +1,45 @@
+#include <nano/store/memory/receivable_amount.hpp>
+#include <nano/store/memory/memory.hpp>
+
+nano::store::memory::receivable_amount::receivable_amount (nano::store::memory::component & store_a) :
+	store{ store_a } {};
+
+void nano::store::memory::receivable_amount::put (store::write_transaction const & transaction_a, nano::receivable_amount_key const & key_a)
+{
+	receivable_amounts.put (view_of (transaction_a), key_a, nullptr);
+}
+
+void nano::store::memory::receivable_amount::del (store::write_transaction const & transaction_a, nano::receivable_amount_key const & key_a)
+{
+	receivable_amounts.del (view_of (transaction_a), key_a);
+}
+
+bool nano::store::memory::receivable_amount::exists (store::transaction const & transaction_a, nano::receivable_amount_key const & key_a) const
+{
+	return receivable_amounts.exists (view_of (transaction_a), key_a);
+}
+
+size_t nano::store::memory::receivable_amount::count (store::transaction const & transaction_a) const
+{
+	return receivable_amounts.count (view_of (transaction_a));
+}
+
+void nano::store::memory::receivable_amount::clear (store::write_transaction const & transaction_a)
+{
+	receivable_amounts.clear (view_of (transaction_a));
+}
+
+nano::store::iterator<nano::receivable_amount_key, std::nullptr_t> nano::store::memory::receivable_amount::begin (store::transaction const & transaction_a, nano::receivable_amount_key const & key_a) const
+{
+	return make_iterator (receivable_amounts, transaction_a, key_a);
+}
+
+nano::store::iterator<nano::receivable_amount_key, std::nullptr_t> nano::store::memory::receivable_amount::begin (store::transaction const & transaction_a) const
+{
+	return make_iterator (receivable_amounts, transaction_a);
+}
+
+nano::store::iterator<nano::receivable_amount_key, std::nullptr_t> nano::store::memory::receivable_amount::end () const
+{
+	return store::iterator<nano::receivable_amount_key, std::nullptr_t> (nullptr);
+}
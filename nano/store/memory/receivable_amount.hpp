@@ -0,0 +1,34 @@
+#pragma once
+
+#include <nano/store/receivable_amount.hpp>
+#include <nano/store/memory/table.hpp>
+
+namespace nano::store::memory
+{
+class component;
+}
+namespace nano::store::memory
+{
+class receivable_amount : public nano::store::receivable_amount
+{
+private:
+	nano::store::memory::component & store;
+
+public:
+	explicit receivable_amount (nano::store::memory::component & store_a);
+	void put (store::write_transaction const & transaction_a, nano::receivable_amount_key const & key_a) override;
+	void del (store::write_transaction const & transaction_a, nano::receivable_amount_key const & key_a) override;
+	bool exists (store::transaction const & transaction_a, nano::receivable_amount_key const & key_a) const override;
+	size_t count (store::transaction const & transaction_a) const override;
+	void clear (store::write_transaction const & transaction_a) override;
+	store::iterator<nano::receivable_amount_key, std::nullptr_t> begin (store::transaction const & transaction_a, nano::receivable_amount_key const & key_a) const override;
+	store::iterator<nano::receivable_amount_key, std::nullptr_t> begin (store::transaction const & transaction_a) const override;
+	store::iterator<nano::receivable_amount_key, std::nullptr_t> end () const override;
+
+	/**
+	 * Receivable entries ordered by descending amount per account
+	 * nano::receivable_amount_key -> none
+	 */
+	memory::table<nano::receivable_amount_key, std::nullptr_t> receivable_amounts;
+};
+} // namespace nano::store::memory
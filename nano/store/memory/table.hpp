@@ -0,0 +1,504 @@
+#pragma once
+
+#include <nano/lib/utility.hpp>
+#include <nano/secure/common.hpp>
+#include <nano/store/instrumentation.hpp>
+#include <nano/store/iterator.hpp>
+#include <nano/store/iterator_impl.hpp>
+#include <nano/store/transaction.hpp>
+
+#include <boost/endian/conversion.hpp>
+#include <boost/polymorphic_cast.hpp>
+
+#include <cstring>
+#include <deque>
+#include <map>
+#include <optional>
+#include <shared_mutex>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace nano::store::memory
+{
+/**
+ * Point in the version history a transaction operates on.
+ * Read transactions see what was committed up to `version`, the write transaction sees the newest value of every key including its own changes.
+ */
+class view final
+{
+public:
+	uint64_t version{ 0 };
+	bool write{ false };
+	/** Oldest version a read transaction could still be looking at when the write transaction started, older versions can be discarded */
+	uint64_t oldest{ 0 };
+};
+
+/** Returns the view of a transaction started by the memory store */
+view const & view_of (store::transaction const &);
+
+/** Orders keys the way LMDB does by comparing their raw bytes, integral keys are stored big endian by the other backends so they compare numerically */
+template <typename Key>
+class key_less final
+{
+public:
+	bool operator() (Key const & lhs, Key const & rhs) const
+	{
+		if constexpr (std::is_integral_v<Key>)
+		{
+			return lhs < rhs;
+		}
+		else
+		{
+			return std::memcmp (&lhs, &rhs, sizeof (Key)) < 0;
+		}
+	}
+};
+
+class table_base
+{
+public:
+	virtual ~table_base () = default;
+	virtual uint64_t count (view const &) const = 0;
+	virtual void clear (view const &) = 0;
+	/** Discards versions and deleted keys no longer visible to any transaction older than `oldest` */
+	virtual void collect (uint64_t oldest) = 0;
+	/** Number of keys held including deleted ones which have not been collected yet */
+	virtual std::size_t size () const = 0;
+
+	/** Records the operations on this table as operations on `id_a` */
+	void instrument (store::instrumentation const & instrumentation_a, nano::tables id_a)
+	{
+		instrumentation = &instrumentation_a;
+		id = id_a;
+	}
+
+	store::instrumentation::clock::time_point start () const
+	{
+		return instrumentation != nullptr ? instrumentation->start () : store::instrumentation::clock::time_point{};
+	}
+
+	void stop (store::instrumentation::clock::time_point start_a, store::instrumentation::operation op, std::size_t bytes) const
+	{
+		if (instrumentation != nullptr)
+		{
+			instrumentation->stop (start_a, id, op, bytes);
+		}
+	}
+
+	/** Wraps an iterator which was positioned starting at `start_a` */
+	template <typename Key, typename Value>
+	store::iterator<Key, Value> wrap (std::unique_ptr<store::iterator_impl<Key, Value>> impl, store::instrumentation::clock::time_point start_a) const
+	{
+		if (instrumentation == nullptr)
+		{
+			return store::iterator<Key, Value> (std::move (impl));
+		}
+		return store::iterator<Key, Value> (std::move (impl), *instrumentation, id, start_a);
+	}
+
+private:
+	store::instrumentation const * instrumentation{ nullptr };
+	nano::tables id{ nano::tables::default_unused };
+};
+
+/**
+ * Sorted table keeping a short chain of versions per key so read transactions keep seeing the snapshot they started with while a writer modifies the table.
+ * There is a single writer at a time, chains are trimmed to the versions still visible to the oldest active reader whenever a key is written.
+ */
+template <typename Key, typename Value>
+class table final : public table_base
+{
+public:
+	using entry = std::pair<Key, Value>;
+
+	std::optional<Value> get (view const & view, Key const & key) const
+	{
+		auto const start_l = start ();
+		std::optional<Value> result;
+		{
+			std::shared_lock lock{ mutex };
+			auto existing = values.find (key);
+			if (existing != values.end ())
+			{
+				if (auto value = visible (existing->second, view))
+				{
+					result = *value;
+				}
+			}
+		}
+		stop (start_l, store::instrumentation::operation::get, result ? bytes (*result) : 0);
+		return result;
+	}
+
+	bool exists (view const & view, Key const & key) const
+	{
+		auto const start_l = start ();
+		bool result;
+		{
+			std::shared_lock lock{ mutex };
+			auto existing = values.find (key);
+			result = existing != values.end () && visible (existing->second, view) != nullptr;
+		}
+		stop (start_l, store::instrumentation::operation::get, 0);
+		return result;
+	}
+
+	void put (view const & view, Key const & key, Value const & value)
+	{
+		debug_assert (view.write);
+		auto const start_l = start ();
+		{
+			std::unique_lock lock{ mutex };
+			write (values[key], view, value);
+		}
+		stop (start_l, store::instrumentation::operation::put, bytes (value));
+	}
+
+	void del (view const & view, Key const & key)
+	{
+		debug_assert (view.write);
+		auto const start_l = start ();
+		{
+			std::unique_lock lock{ mutex };
+			auto existing = values.find (key);
+			if (existing != values.end () && visible (existing->second, view) != nullptr)
+			{
+				write (existing->second, view, std::nullopt);
+				tombstones.emplace_back (view.version, key);
+			}
+		}
+		stop (start_l, store::instrumentation::operation::del, 0);
+	}
+
+	void clear (view const & view) override
+	{
+		debug_assert (view.write);
+		std::unique_lock lock{ mutex };
+		for (auto & [key, versions] : values)
+		{
+			if (visible (versions, view) != nullptr)
+			{
+				write (versions, view, std::nullopt);
+				tombstones.emplace_back (view.version, key);
+			}
+		}
+	}
+
+	uint64_t count (view const & view) const override
+	{
+		std::shared_lock lock{ mutex };
+		uint64_t result{ 0 };
+		for (auto const & [key, versions] : values)
+		{
+			result += visible (versions, view) != nullptr ? 1 : 0;
+		}
+		return result;
+	}
+
+	/** First visible entry with a key equal to or greater than `key` */
+	std::optional<entry> lower_bound (view const & view, Key const & key) const
+	{
+		std::shared_lock lock{ mutex };
+		return forward (view, values.lower_bound (key));
+	}
+
+	/** First visible entry with a key greater than `key` */
+	std::optional<entry> upper_bound (view const & view, Key const & key) const
+	{
+		std::shared_lock lock{ mutex };
+		return forward (view, values.upper_bound (key));
+	}
+
+	std::optional<entry> first (view const & view) const
+	{
+		std::shared_lock lock{ mutex };
+		return forward (view, values.begin ());
+	}
+
+	/** Last visible entry with a key less than `key` */
+	std::optional<entry> previous (view const & view, Key const & key) const
+	{
+		std::shared_lock lock{ mutex };
+		return backward (view, values.lower_bound (key));
+	}
+
+	std::optional<entry> last (view const & view) const
+	{
+		std::shared_lock lock{ mutex };
+		return backward (view, values.end ());
+	}
+
+	void collect (uint64_t oldest) override
+	{
+		std::unique_lock lock{ mutex };
+		while (!tombstones.empty () && tombstones.front ().first <= oldest)
+		{
+			auto existing = values.find (tombstones.front ().second);
+			if (existing != values.end ())
+			{
+				trim (existing->second, oldest);
+				if (existing->second.size () == 1 && !existing->second.front ().value)
+				{
+					values.erase (existing);
+				}
+			}
+			tombstones.pop_front ();
+		}
+	}
+
+	std::size_t size () const override
+	{
+		std::shared_lock lock{ mutex };
+		return values.size ();
+	}
+
+private:
+	class version_value final
+	{
+	public:
+		uint64_t version;
+		/** Empty if the key was deleted in this version */
+		std::optional<Value> value;
+	};
+	using versions_t = std::vector<version_value>;
+	using map_t = std::map<Key, versions_t, key_less<Key>>;
+
+	/** Value bytes reported to instrumentation, serialized values report their length */
+	static std::size_t bytes (Value const & value)
+	{
+		if constexpr (std::is_same_v<Value, std::vector<uint8_t>>)
+		{
+			return value.size ();
+		}
+		else if constexpr (std::is_empty_v<Value> || std::is_null_pointer_v<Value>)
+		{
+			return 0;
+		}
+		else
+		{
+			return sizeof (Value);
+		}
+	}
+
+	static Value const * visible (versions_t const & versions, view const & view)
+	{
+		for (auto i = versions.rbegin (), n = versions.rend (); i != n; ++i)
+		{
+			if (view.write || i->version <= view.version)
+			{
+				return i->value ? &*i->value : nullptr;
+			}
+		}
+		return nullptr;
+	}
+
+	static void write (versions_t & versions, view const & view, std::optional<Value> value)
+	{
+		if (!versions.empty () && versions.back ().version == view.version)
+		{
+			versions.back ().value = std::move (value);
+		}
+		else
+		{
+			versions.push_back ({ view.version, std::move (value) });
+		}
+		trim (versions, view.oldest);
+	}
+
+	/** Keeps the newest version visible to the oldest reader and everything after it */
+	static void trim (versions_t & versions, uint64_t oldest)
+	{
+		auto keep = versions.begin ();
+		for (auto i = versions.begin (), n = versions.end (); i != n && i->version <= oldest; ++i)
+		{
+			keep = i;
+		}
+		versions.erase (versions.begin (), keep);
+	}
+
+	std::optional<entry> forward (view const & view, typename map_t::const_iterator i) const
+	{
+		for (auto n = values.end (); i != n; ++i)
+		{
+			if (auto value = visible (i->second, view))
+			{
+				return entry{ i->first, *value };
+			}
+		}
+		return std::nullopt;
+	}
+
+	std::optional<entry> backward (view const & view, typename map_t::const_iterator i) const
+	{
+		for (auto n = values.begin (); i != n;)
+		{
+			--i;
+			if (auto value = visible (i->second, view))
+			{
+				return entry{ i->first, *value };
+			}
+		}
+		return std::nullopt;
+	}
+
+	mutable std::shared_mutex mutex;
+	map_t values;
+	/** Keys deleted by a write transaction, erased once no reader can see them anymore */
+	std::deque<std::pair<uint64_t, Key>> tombstones;
+};
+
+/**
+ * Bytes of `value` in the form the other backends store it, so views of memory iterators can be decoded the same way.
+ * Serialized values are returned as they are, everything else is written to `buffer`.
+ */
+template <typename T>
+std::span<uint8_t const> stored_bytes (T const & value, std::vector<uint8_t> & buffer)
+{
+	if constexpr (std::is_same_v<T, std::vector<uint8_t>>)
+	{
+		return value;
+	}
+	else if constexpr (std::is_null_pointer_v<T> || std::is_same_v<T, nano::no_value>)
+	{
+		return {};
+	}
+	else
+	{
+		if constexpr (std::is_integral_v<T>)
+		{
+			auto const big_endian = boost::endian::native_to_big (static_cast<uint64_t> (value));
+			buffer.resize (sizeof (big_endian));
+			std::memcpy (buffer.data (), &big_endian, sizeof (big_endian));
+		}
+		else if constexpr (requires { value.db_size (); })
+		{
+			buffer.resize (value.db_size ());
+			std::memcpy (buffer.data (), &value, buffer.size ());
+		}
+		else
+		{
+			static_assert (std::is_trivially_copyable_v<T>);
+			buffer.resize (sizeof (T));
+			std::memcpy (buffer.data (), &value, sizeof (T));
+		}
+		return buffer;
+	}
+}
+
+/**
+ * Iterator positioned on a key, each step looks up the neighbouring visible key so it stays valid while the table is modified.
+ * `Stored` is the type held by the table, tables holding a serialized form pass a function converting it to the iterated `Value`.
+ */
+template <typename Key, typename Value, typename Stored = Value>
+class iterator final : public store::iterator_impl<Key, Value>
+{
+public:
+	using convert_t = Value (*) (Stored const &);
+
+	iterator (memory::table<Key, Stored> const & table_a, memory::view const & view_a, std::optional<std::pair<Key, Stored>> current_a, convert_t convert_a = nullptr) :
+		table{ table_a },
+		snapshot{ view_a },
+		current{ std::move (current_a) },
+		convert{ convert_a }
+	{
+	}
+
+	store::iterator_impl<Key, Value> & operator++ () override
+	{
+		if (current)
+		{
+			current = table.upper_bound (snapshot, current->first);
+		}
+		return *this;
+	}
+
+	store::iterator_impl<Key, Value> & operator-- () override
+	{
+		current = current ? table.previous (snapshot, current->first) : table.last (snapshot);
+		return *this;
+	}
+
+	bool operator== (store::iterator_impl<Key, Value> const & base_a) const override
+	{
+		auto const other_a (boost::polymorphic_downcast<iterator const *> (&base_a));
+		if (!current || !other_a->current)
+		{
+			return !current && !other_a->current;
+		}
+		key_less<Key> less;
+		return !less (current->first, other_a->current->first) && !less (other_a->current->first, current->first);
+	}
+
+	bool is_end_sentinal () const override
+	{
+		return !current;
+	}
+
+	store::entry_view view () const override
+	{
+		if (!current)
+		{
+			return {};
+		}
+		return { stored_bytes (current->first, key_buffer), stored_bytes (current->second, value_buffer) };
+	}
+
+	void fill (std::pair<Key, Value> & value_a) const override
+	{
+		if (current)
+		{
+			value_a.first = current->first;
+			if constexpr (std::is_same_v<Value, Stored>)
+			{
+				value_a.second = current->second;
+			}
+			else
+			{
+				value_a.second = convert (current->second);
+			}
+		}
+		else
+		{
+			value_a.first = Key{};
+			value_a.second = Value{};
+		}
+	}
+
+private:
+	memory::table<Key, Stored> const & table;
+	memory::view const snapshot;
+	std::optional<std::pair<Key, Stored>> current;
+	convert_t convert;
+	mutable std::vector<uint8_t> key_buffer;
+	mutable std::vector<uint8_t> value_buffer;
+};
+
+/** Iterator over `table` starting at the first key */
+template <typename Key, typename Value>
+store::iterator<Key, Value> make_iterator (memory::table<Key, Value> const & table, store::transaction const & transaction)
+{
+	auto const & view = view_of (transaction);
+	auto const start = table.start ();
+	return table.template wrap<Key, Value> (std::make_unique<memory::iterator<Key, Value>> (table, view, table.first (view)), start);
+}
+
+/** Iterator over `table` starting at the first key equal to or greater than `key` */
+template <typename Key, typename Value>
+store::iterator<Key, Value> make_iterator (memory::table<Key, Value> const & table, store::transaction const & transaction, Key const & key)
+{
+	auto const & view = view_of (transaction);
+	auto const start = table.start ();
+	return table.template wrap<Key, Value> (std::make_unique<memory::iterator<Key, Value>> (table, view, table.lower_bound (view, key)), start);
+}
+
+/** Iterator over `table` starting at the last key */
+template <typename Key, typename Value>
+store::iterator<Key, Value> make_reverse_iterator (memory::table<Key, Value> const & table, store::transaction const & transaction)
+{
+	auto const & view = view_of (transaction);
+	auto const start = table.start ();
+	return table.template wrap<Key, Value> (std::make_unique<memory::iterator<Key, Value>> (table, view, table.last (view)), start);
+}
+}
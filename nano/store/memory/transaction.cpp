@@ -0,0 +1,78 @@
+#include <nano/store/memory/memory.hpp>
+#include <nano/store/memory/transaction_impl.hpp>
+
+nano::store::memory::view const & nano::store::memory::view_of (store::transaction const & transaction_a)
+{
+	return *static_cast<nano::store::memory::view const *> (transaction_a.get_handle ());
+}
+
+nano::store::memory::read_transaction_impl::read_transaction_impl (nano::store::memory::component const & store_a) :
+	store{ store_a }
+{
+	renew ();
+}
+
+nano::store::memory::read_transaction_impl::~read_transaction_impl ()
+{
+	reset ();
+}
+
+void nano::store::memory::read_transaction_impl::reset ()
+{
+	if (active)
+	{
+		store.end_read (view);
+		active = false;
+	}
+}
+
+void nano::store::memory::read_transaction_impl::renew ()
+{
+	reset ();
+	view = store.begin_read ();
+	active = true;
+}
+
+void * nano::store::memory::read_transaction_impl::get_handle () const
+{
+	return (void *)&view;
+}
+
+nano::store::memory::write_transaction_impl::write_transaction_impl (nano::store::memory::component & store_a) :
+	store{ store_a }
+{
+	store.write_mutex.lock ();
+	renew ();
+}
+
+nano::store::memory::write_transaction_impl::~write_transaction_impl ()
+{
+	commit ();
+	store.write_mutex.unlock ();
+}
+
+void nano::store::memory::write_transaction_impl::commit ()
+{
+	if (active)
+	{
+		store.commit (view);
+		active = false;
+	}
+}
+
+void nano::store::memory::write_transaction_impl::renew ()
+{
+	view = store.begin_write ();
+	active = true;
+}
+
+void * nano::store::memory::write_transaction_impl::get_handle () const
+{
+	return (void *)&view;
+}
+
+bool nano::store::memory::write_transaction_impl::contains (nano::tables table_a) const
+{
+	// Writers are serialized by the store, every table is available to the write transaction
+	return true;
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <nano/store/memory/table.hpp>
+#include <nano/store/transaction.hpp>
+
+namespace nano::store::memory
+{
+class component;
+}
+
+namespace nano::store::memory
+{
+/** Snapshot of the last committed version, registered with the store so the versions it sees are kept until it is reset */
+class read_transaction_impl final : public store::read_transaction_impl
+{
+public:
+	explicit read_transaction_impl (nano::store::memory::component const &);
+	~read_transaction_impl ();
+	void reset () override;
+	void renew () override;
+	void * get_handle () const override;
+
+private:
+	nano::store::memory::component const & store;
+	memory::view view;
+	bool active{ false };
+};
+
+/** Holds the store's writer lock for its whole lifetime, each commit publishes a new version to readers */
+class write_transaction_impl final : public store::write_transaction_impl
+{
+public:
+	explicit write_transaction_impl (nano::store::memory::component &);
+	~write_transaction_impl ();
+	void commit () override;
+	void renew () override;
+	void * get_handle () const override;
+	bool contains (nano::tables table_a) const override;
+
+private:
+	nano::store::memory::component & store;
+	memory::view view;
+	bool active{ false };
+};
+} // namespace nano::store::memory
@@ -0,0 +1,20 @@
+#include <nano/store/memory/memory.hpp>
+#include <nano/store/memory/version.hpp>
+
+namespace
+{
+uint64_t constexpr version_key{ 1 };
+}
+
+nano::store::memory::version::version (nano::store::memory::component & store_a) :
+	store{ store_a } {};
+
+void nano::store::memory::version::put (store::write_transaction const & transaction_a, int version)
+{
+	meta.put (view_of (transaction_a), version_key, version);
+}
+
+int nano::store::memory::version::get (store::transaction const & transaction_a) const
+{
+	return meta.get (view_of (transaction_a), version_key).value_or (store.version_minimum);
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <nano/store/memory/table.hpp>
+#include <nano/store/version.hpp>
+
+namespace nano::store::memory
+{
+class component;
+}
+namespace nano::store::memory
+{
+class version : public nano::store::version
+{
+protected:
+	nano::store::memory::component & store;
+
+public:
+	explicit version (nano::store::memory::component & store_a);
+	void put (store::write_transaction const & transaction_a, int version_a) override;
+	int get (store::transaction const & transaction_a) const override;
+
+	/**
+	 * Store version, kept under a single key like the meta table of the other backends
+	 * uint64_t -> int
+	 */
+	memory::table<uint64_t, int> meta;
+};
+} // namespace nano::store::memory
@@ -0,0 +1 @@
+#include <nano/store/receivable_amount.hpp>
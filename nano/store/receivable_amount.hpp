@@ -0,0 +1,24 @@
+#pragma once
+
+#include <nano/lib/numbers.hpp>
+#include <nano/store/component.hpp>
+#include <nano/store/iterator.hpp>
+
+namespace nano::store
+{
+/**
+ * Manages the receivable amount index, an entry for every pending entry ordered by destination account and then by descending amount
+ */
+class receivable_amount
+{
+public:
+	virtual void put (store::write_transaction const & transaction_a, nano::receivable_amount_key const & key_a) = 0;
+	virtual void del (store::write_transaction const & transaction_a, nano::receivable_amount_key const & key_a) = 0;
+	virtual bool exists (store::transaction const & transaction_a, nano::receivable_amount_key const & key_a) const = 0;
+	virtual size_t count (store::transaction const & transaction_a) const = 0;
+	virtual void clear (store::write_transaction const &) = 0;
+	virtual store::iterator<nano::receivable_amount_key, std::nullptr_t> begin (store::transaction const & transaction_a, nano::receivable_amount_key const & key_a) const = 0;
+	virtual store::iterator<nano::receivable_amount_key, std::nullptr_t> begin (store::transaction const & transaction_a) const = 0;
+	virtual store::iterator<nano::receivable_amount_key, std::nullptr_t> end () const = 0;
+};
+} // namespace nano::store
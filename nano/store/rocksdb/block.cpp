@@ -100,6 +100,26 @@ std::shared_ptr<nano::block> nano::store::rocksdb::block::get (store::transactio
 	}
 	return result;
 }
+
+std::optional<nano::block_hash> nano::store::rocksdb::block::get_serialized (store::transaction const & transaction, nano::block_hash const & hash, std::vector<uint8_t> & buffer) const
+{
+	nano::store::rocksdb::db_val value;
+	block_raw_get (transaction, hash, value);
+	if (value.size () == 0)
+	{
+		return std::nullopt;
+	}
+	auto type = block_type_from_raw (value.data ());
+	auto data = reinterpret_cast<uint8_t const *> (value.data ());
+	auto sideband_offset = block_successor_offset (transaction, value.size (), type);
+	release_assert (sideband_offset + sizeof (nano::block_hash) <= value.size ());
+	// Stored value is the network serialization of the block followed by its sideband, which starts with the successor
+	buffer.insert (buffer.end (), data, data + sideband_offset);
+	nano::block_hash successor;
+	std::copy (data + sideband_offset, data + sideband_offset + sizeof (nano::block_hash), successor.bytes.begin ());
+	return successor;
+}
+
 std::shared_ptr<nano::block> nano::store::rocksdb::block::random (store::transaction const & transaction)
 {
 	nano::block_hash hash;
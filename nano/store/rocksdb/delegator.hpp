@@ -0,0 +1,27 @@
+#pragma once
+
+#include <nano/store/delegator.hpp>
+
+namespace nano::store::rocksdb
+{
+class component;
+}
+namespace nano::store::rocksdb
+{
+class delegator : public nano::store::delegator
+{
+private:
+	nano::store::rocksdb::component & store;
+
+public:
+	explicit delegator (nano::store::rocksdb::component & store_a);
+	void put (store::write_transaction const & transaction_a, nano::delegator_key const & key_a) override;
+	void del (store::write_transaction const & transaction_a, nano::delegator_key const & key_a) override;
+	bool exists (store::transaction const & transaction_a, nano::delegator_key const & key_a) const override;
+	size_t count (store::transaction const & transaction_a) const override;
+	void clear (store::write_transaction const & transaction_a) override;
+	store::iterator<nano::delegator_key, std::nullptr_t> begin (store::transaction const & transaction_a, nano::delegator_key const & key_a) const override;
+	store::iterator<nano::delegator_key, std::nullptr_t> begin (store::transaction const & transaction_a) const override;
+	store::iterator<nano::delegator_key, std::nullptr_t> end () const override;
+};
+} // namespace nano::store::rocksdb
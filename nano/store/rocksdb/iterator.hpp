@@ -35,17 +35,20 @@ public:
 
 	iterator (::rocksdb::DB * db, store::transaction const & transaction_a, ::rocksdb::ColumnFamilyHandle * handle_a, db_val const * val_a, bool const direction_asc)
 	{
-		// Don't fill the block cache for any blocks read as a result of an iterator
+		// Don't fill the block cache for any blocks read as a result of an iterator.
+		// Iterators walk across key prefixes, so seeks must ignore any prefix extractor of the table.
 		if (is_read (transaction_a))
 		{
 			auto read_options = snapshot_options (transaction_a);
 			read_options.fill_cache = false;
+			read_options.total_order_seek = true;
 			cursor.reset (db->NewIterator (read_options, handle_a));
 		}
 		else
 		{
 			::rocksdb::ReadOptions ropts;
 			ropts.fill_cache = false;
+			ropts.total_order_seek = true;
 			cursor.reset (tx (transaction_a)->GetIterator (ropts, handle_a));
 		}
 
@@ -180,6 +183,10 @@ public:
 			}
 		}
 	}
+	store::entry_view view () const override
+	{
+		return { { static_cast<uint8_t const *> (current.first.data ()), current.first.size () }, { static_cast<uint8_t const *> (current.second.data ()), current.second.size () } };
+	}
 	void clear ()
 	{
 		current.first = nano::store::rocksdb::db_val{};
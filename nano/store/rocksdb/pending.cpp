@@ -33,14 +33,12 @@ bool nano::store::rocksdb::pending::get (store::transaction const & transaction,
 
 bool nano::store::rocksdb::pending::exists (store::transaction const & transaction_a, nano::pending_key const & key_a)
 {
-	auto iterator (begin (transaction_a, key_a));
-	return iterator != end () && nano::pending_key (iterator->first) == key_a;
+	return store.exists (transaction_a, tables::pending, key_a);
 }
 
 bool nano::store::rocksdb::pending::any (store::transaction const & transaction_a, nano::account const & account_a)
 {
-	auto iterator (begin (transaction_a, nano::pending_key (account_a, 0)));
-	return iterator != end () && nano::pending_key (iterator->first).account == account_a;
+	return store.exists_prefix (transaction_a, tables::pending, nano::pending_key (account_a, 0), sizeof (nano::account));
 }
 
 nano::store::iterator<nano::pending_key, nano::pending_info> nano::store::rocksdb::pending::begin (store::transaction const & transaction_a, nano::pending_key const & key_a) const
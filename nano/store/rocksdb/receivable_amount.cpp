@@ -0,0 +1,48 @@
+#include <nano/store/rocksdb/receivable_amount.hpp>
+#include <nano/store/rocksdb/rocksdb.hpp>
+
+nano::store::rocksdb::receivable_amount::receivable_amount (nano::store::rocksdb::component & store_a) :
+	store{ store_a } {};
+
+void nano::store::rocksdb::receivable_amount::put (store::write_transaction const & transaction_a, nano::receivable_amount_key const & key_a)
+{
+	auto status = store.put (transaction_a, tables::receivable_amounts, key_a, nullptr);
+	store.release_assert_success (status);
+}
+
+void nano::store::rocksdb::receivable_amount::del (store::write_transaction const & transaction_a, nano::receivable_amount_key const & key_a)
+{
+	auto status = store.del (transaction_a, tables::receivable_amounts, key_a);
+	store.release_assert_success (status);
+}
+
+bool nano::store::rocksdb::receivable_amount::exists (store::transaction const & transaction_a, nano::receivable_amount_key const & key_a) const
+{
+	return store.exists (transaction_a, tables::receivable_amounts, key_a);
+}
+
+size_t nano::store::rocksdb::receivable_amount::count (store::transaction const & transaction_a) const
+{
+	return store.count (transaction_a, tables::receivable_amounts);
+}
+
+void nano::store::rocksdb::receivable_amount::clear (store::write_transaction const & transaction_a)
+{
+	auto status = store.drop (transaction_a, tables::receivable_amounts);
+	store.release_assert_success (status);
+}
+
+nano::store::iterator<nano::receivable_amount_key, std::nullptr_t> nano::store::rocksdb::receivable_amount::begin (store::transaction const & transaction, nano::receivable_amount_key const & key) const
+{
+	return store.make_iterator<nano::receivable_amount_key, std::nullptr_t> (transaction, tables::receivable_amounts, key);
+}
+
+nano::store::iterator<nano::receivable_amount_key, std::nullptr_t> nano::store::rocksdb::receivable_amount::begin (store::transaction const & transaction) const
+{
+	return store.make_iterator<nano::receivable_amount_key, std::nullptr_t> (transaction, tables::receivable_amounts);
+}
+
+nano::store::iterator<nano::receivable_amount_key, std::nullptr_t> nano::store::rocksdb::receivable_amount::end () const
+{
+	return store::iterator<nano::receivable_amount_key, std::nullptr_t> (nullptr);
+}
@@ -46,6 +46,8 @@ nano::store::rocksdb::component::component (nano::logger_mt & logger_a, std::fil
 		peer_store,
 		confirmation_height_store,
 		final_vote_store,
+		delegator_store,
+		receivable_amount_store,
 		version_store
 	},
 	// clang-format on
@@ -58,6 +60,8 @@ nano::store::rocksdb::component::component (nano::logger_mt & logger_a, std::fil
 	peer_store{ *this },
 	confirmation_height_store{ *this },
 	final_vote_store{ *this },
+	delegator_store{ *this },
+	receivable_amount_store{ *this },
 	version_store{ *this },
 	logger{ logger_a },
 	constants{ constants },
@@ -78,6 +82,11 @@ nano::store::rocksdb::component::component (nano::logger_mt & logger_a, std::fil
 	debug_assert (path_a.filename () == "rocksdb");
 
 	generate_tombstone_map ();
+	if (rocksdb_config.partitioned_index_filters)
+	{
+		// Shared by all ledger tables, index and filter blocks go to the high priority pool so data blocks evict them last
+		shared_block_cache = ::rocksdb::NewLRUCache (block_cache_size_bytes () * shared_block_cache_multiplier, -1, false, 0.5);
+	}
 	small_table_factory.reset (::rocksdb::NewBlockBasedTableFactory (get_small_table_options ()));
 
 	// TODO: get_db_options () registers a listener for resetting tombstones, needs to check if it is a problem calling it more than once.
@@ -167,6 +176,8 @@ std::unordered_map<char const *, nano::tables> nano::store::rocksdb::component::
 		{ "meta", tables::meta },
 		{ "peers", tables::peers },
 		{ "confirmation_height", tables::confirmation_height },
+		{ "delegators", tables::delegators },
+		{ "receivable_amounts", tables::receivable_amounts },
 		{ "pruned", tables::pruned },
 		{ "final_votes", tables::final_votes } };
 
@@ -238,6 +249,12 @@ bool nano::store::rocksdb::component::do_upgrades (store::write_transaction cons
 			upgrade_v21_to_v22 (transaction_a);
 			[[fallthrough]];
 		case 22:
+			upgrade_v22_to_v23 (transaction_a);
+			[[fallthrough]];
+		case 23:
+			upgrade_v23_to_v24 (transaction_a);
+			[[fallthrough]];
+		case 24:
 			break;
 		default:
 			logger.always_log (boost::str (boost::format ("The version of the ledger (%1%) is too high for this node") % version_l));
@@ -269,6 +286,35 @@ void nano::store::rocksdb::component::upgrade_v21_to_v22 (store::write_transacti
 	logger.always_log ("Finished removing unchecked table");
 }
 
+void nano::store::rocksdb::component::upgrade_v22_to_v23 (store::write_transaction const & transaction_a)
+{
+	logger.always_log ("Preparing v22 to v23 database upgrade...");
+	// Upgrades open the column families found in the database, the delegators index is new and created empty
+	if (!column_family_exists ("delegators"))
+	{
+		::rocksdb::ColumnFamilyHandle * delegators_handle{ nullptr };
+		auto status = db->CreateColumnFamily (get_cf_options ("delegators"), "delegators", &delegators_handle);
+		release_assert (status.ok ());
+		handles.emplace_back (delegators_handle);
+	}
+	version.put (transaction_a, 23);
+	logger.always_log ("Finished adding delegators table");
+}
+
+void nano::store::rocksdb::component::upgrade_v23_to_v24 (store::write_transaction const & transaction_a)
+{
+	logger.always_log ("Preparing v23 to v24 database upgrade...");
+	if (!column_family_exists ("receivable_amounts"))
+	{
+		::rocksdb::ColumnFamilyHandle * receivable_amounts_handle{ nullptr };
+		auto status = db->CreateColumnFamily (get_cf_options ("receivable_amounts"), "receivable_amounts", &receivable_amounts_handle);
+		release_assert (status.ok ());
+		handles.emplace_back (receivable_amounts_handle);
+	}
+	version.put (transaction_a, 24);
+	logger.always_log ("Finished adding receivable amounts table");
+}
+
 void nano::store::rocksdb::component::generate_tombstone_map ()
 {
 	tombstone_map.emplace (std::piecewise_construct, std::forward_as_tuple (nano::tables::blocks), std::forward_as_tuple (0, 25000));
@@ -312,9 +358,10 @@ rocksdb::ColumnFamilyOptions nano::store::rocksdb::component::get_cf_options (st
 {
 	::rocksdb::ColumnFamilyOptions cf_options;
 	auto const memtable_size_bytes = base_memtable_size_bytes ();
-	auto const block_cache_size_bytes = 1024ULL * 1024 * rocksdb_config.memory_multiplier * base_block_cache_size;
+	auto const block_cache_size_bytes = this->block_cache_size_bytes ();
 	if (cf_name_a == "blocks")
 	{
+		// Blocks are only looked up by their full hash, the default whole key bloom filter suits them
 		std::shared_ptr<::rocksdb::TableFactory> table_factory (::rocksdb::NewBlockBasedTableFactory (get_active_table_options (block_cache_size_bytes * 4)));
 		cf_options = get_active_cf_options (table_factory, blocks_memtable_size_bytes ());
 	}
@@ -347,6 +394,8 @@ rocksdb::ColumnFamilyOptions nano::store::rocksdb::component::get_cf_options (st
 
 		// L1 size, compaction is triggered for L0 at this size (2 SST files in L1)
 		cf_options.max_bytes_for_level_base = memtable_size_bytes * 2;
+
+		set_account_prefix_options (cf_options);
 	}
 	else if (cf_name_a == "frontiers")
 	{
@@ -371,6 +420,19 @@ rocksdb::ColumnFamilyOptions nano::store::rocksdb::component::get_cf_options (st
 		std::shared_ptr<::rocksdb::TableFactory> table_factory (::rocksdb::NewBlockBasedTableFactory (get_active_table_options (block_cache_size_bytes * 2)));
 		cf_options = get_active_cf_options (table_factory, memtable_size_bytes);
 	}
+	else if (cf_name_a == "delegators")
+	{
+		// Keys only, one per account which moves when the account changes representative
+		std::shared_ptr<::rocksdb::TableFactory> table_factory (::rocksdb::NewBlockBasedTableFactory (get_active_table_options (block_cache_size_bytes)));
+		cf_options = get_active_cf_options (table_factory, memtable_size_bytes);
+	}
+	else if (cf_name_a == "receivable_amounts")
+	{
+		// Keys only, written and deleted along with the pending entries
+		std::shared_ptr<::rocksdb::TableFactory> table_factory (::rocksdb::NewBlockBasedTableFactory (get_active_table_options (block_cache_size_bytes)));
+		cf_options = get_active_cf_options (table_factory, memtable_size_bytes);
+		set_account_prefix_options (cf_options);
+	}
 	else if (cf_name_a == "final_votes")
 	{
 		std::shared_ptr<::rocksdb::TableFactory> table_factory (::rocksdb::NewBlockBasedTableFactory (get_active_table_options (block_cache_size_bytes * 2)));
@@ -388,6 +450,17 @@ rocksdb::ColumnFamilyOptions nano::store::rocksdb::component::get_cf_options (st
 	return cf_options;
 }
 
+void nano::store::rocksdb::component::set_account_prefix_options (::rocksdb::ColumnFamilyOptions & cf_options_a) const
+{
+	if (rocksdb_config.pending_prefix_bloom)
+	{
+		// Keys start with the account, filters on it let lookups for accounts without entries skip files and memtables.
+		// Iterators use total order seeks so iterating across accounts is unaffected.
+		cf_options_a.prefix_extractor.reset (::rocksdb::NewFixedPrefixTransform (sizeof (nano::account)));
+		cf_options_a.memtable_prefix_bloom_size_ratio = 0.1;
+	}
+}
+
 std::vector<rocksdb::ColumnFamilyDescriptor> nano::store::rocksdb::component::create_column_families ()
 {
 	std::vector<::rocksdb::ColumnFamilyDescriptor> column_families;
@@ -501,6 +574,10 @@ rocksdb::ColumnFamilyHandle * nano::store::rocksdb::component::table_to_column_f
 			return get_column_family ("confirmation_height");
 		case tables::final_votes:
 			return get_column_family ("final_votes");
+		case tables::delegators:
+			return get_column_family ("delegators");
+		case tables::receivable_amounts:
+			return get_column_family ("receivable_amounts");
 		default:
 			release_assert (false);
 			return get_column_family ("");
@@ -511,6 +588,7 @@ bool nano::store::rocksdb::component::exists (store::transaction const & transac
 {
 	::rocksdb::PinnableSlice slice;
 	::rocksdb::Status status;
+	auto const start = instrumentation.start ();
 	if (is_read (transaction_a))
 	{
 		status = db->Get (snapshot_options (transaction_a), table_to_column_family (table_a), key_a, &slice);
@@ -521,17 +599,42 @@ bool nano::store::rocksdb::component::exists (store::transaction const & transac
 		options.fill_cache = false;
 		status = tx (transaction_a)->Get (options, table_to_column_family (table_a), key_a, &slice);
 	}
+	instrumentation.stop (start, table_a, store::instrumentation::operation::get, slice.size ());
 
 	return (status.ok ());
 }
 
+bool nano::store::rocksdb::component::exists_prefix (store::transaction const & transaction_a, tables table_a, nano::store::rocksdb::db_val const & key_a, std::size_t prefix_size_a) const
+{
+	debug_assert (prefix_size_a <= key_a.size ());
+	auto const start = instrumentation.start ();
+	// Restricting the seek to the prefix of the key lets the prefix bloom filters rule out files without it
+	::rocksdb::ReadOptions options;
+	if (is_read (transaction_a))
+	{
+		options = snapshot_options (transaction_a);
+	}
+	options.fill_cache = false;
+	options.total_order_seek = false;
+	options.prefix_same_as_start = true;
+	auto const handle = table_to_column_family (table_a);
+	std::unique_ptr<::rocksdb::Iterator> cursor{ is_read (transaction_a) ? db->NewIterator (options, handle) : tx (transaction_a)->GetIterator (options, handle) };
+	cursor->Seek (key_a);
+	auto const result = cursor->Valid () && cursor->key ().starts_with (::rocksdb::Slice{ static_cast<char const *> (key_a.data ()), prefix_size_a });
+	instrumentation.stop (start, table_a, store::instrumentation::operation::iterate, 0);
+	return result;
+}
+
 int nano::store::rocksdb::component::del (store::write_transaction const & transaction_a, tables table_a, nano::store::rocksdb::db_val const & key_a)
 {
 	debug_assert (transaction_a.contains (table_a));
 	// RocksDB does not report not_found status, it is a pre-condition that the key exists
 	debug_assert (exists (transaction_a, table_a, key_a));
 	flush_tombstones_check (table_a);
-	return tx (transaction_a)->Delete (table_to_column_family (table_a), key_a).code ();
+	auto const start = instrumentation.start ();
+	auto status = tx (transaction_a)->Delete (table_to_column_family (table_a), key_a).code ();
+	instrumentation.stop (start, table_a, store::instrumentation::operation::del, 0);
+	return status;
 }
 
 void nano::store::rocksdb::component::flush_tombstones_check (tables table_a)
@@ -566,6 +669,7 @@ int nano::store::rocksdb::component::get (store::transaction const & transaction
 	::rocksdb::PinnableSlice slice;
 	auto handle = table_to_column_family (table_a);
 	::rocksdb::Status status;
+	auto const start = instrumentation.start ();
 	if (is_read (transaction_a))
 	{
 		status = db->Get (snapshot_options (transaction_a), handle, key_a, &slice);
@@ -581,6 +685,7 @@ int nano::store::rocksdb::component::get (store::transaction const & transaction
 		std::memcpy (value_a.buffer->data (), slice.data (), slice.size ());
 		value_a.convert_buffer_to_value ();
 	}
+	instrumentation.stop (start, table_a, store::instrumentation::operation::get, slice.size ());
 	return status.code ();
 }
 
@@ -588,7 +693,10 @@ int nano::store::rocksdb::component::put (store::write_transaction const & trans
 {
 	debug_assert (transaction_a.contains (table_a));
 	auto txn = tx (transaction_a);
-	return txn->Put (table_to_column_family (table_a), key_a, value_a).code ();
+	auto const start = instrumentation.start ();
+	auto status = txn->Put (table_to_column_family (table_a), key_a, value_a).code ();
+	instrumentation.stop (start, table_a, store::instrumentation::operation::put, value_a.size ());
+	return status;
 }
 
 bool nano::store::rocksdb::component::not_found (int status) const
@@ -629,6 +737,11 @@ uint64_t nano::store::rocksdb::component::count (store::transaction const & tran
 	{
 		db->GetIntProperty (table_to_column_family (table_a), "rocksdb.estimate-num-keys", &sum);
 	}
+	// Estimated, the indexes have deletions whenever an account changes representative or a receivable is received
+	else if (table_a == tables::delegators || table_a == tables::receivable_amounts)
+	{
+		db->GetIntProperty (table_to_column_family (table_a), "rocksdb.estimate-num-keys", &sum);
+	}
 	// This should be accurate as long as there continues to be no deletes or duplicate entries.
 	else if (table_a == tables::final_votes)
 	{
@@ -776,11 +889,28 @@ rocksdb::BlockBasedTableOptions nano::store::rocksdb::component::get_active_tabl
 	table_options.format_version = 4;
 	table_options.index_block_restart_interval = 16;
 
-	// Block cache for reads
-	table_options.block_cache = ::rocksdb::NewLRUCache (lru_size);
-
 	// Bloom filter to help with point reads. 10bits gives 1% false positive rate.
-	table_options.filter_policy.reset (::rocksdb::NewBloomFilterPolicy (10, false));
+	if (rocksdb_config.bloom_filter_bits != 0)
+	{
+		table_options.filter_policy.reset (::rocksdb::NewBloomFilterPolicy (rocksdb_config.bloom_filter_bits, false));
+	}
+
+	if (shared_block_cache != nullptr)
+	{
+		// Split index and filters into partitions loaded on demand through the shared cache, only the top level index stays pinned.
+		// Avoids loading the full index and filter of every open file into memory on large ledgers.
+		table_options.block_cache = shared_block_cache;
+		table_options.index_type = ::rocksdb::BlockBasedTableOptions::IndexType::kTwoLevelIndexSearch;
+		table_options.partition_filters = table_options.filter_policy != nullptr;
+		table_options.cache_index_and_filter_blocks = true;
+		table_options.cache_index_and_filter_blocks_with_high_priority = true;
+		table_options.pin_top_level_index_and_filter = true;
+	}
+	else
+	{
+		// Block cache for reads
+		table_options.block_cache = ::rocksdb::NewLRUCache (lru_size);
+	}
 
 	// Increasing block_size decreases memory usage and space amplification, but increases read amplification.
 	table_options.block_size = 16 * 1024ULL;
@@ -842,7 +972,7 @@ void nano::store::rocksdb::component::on_flush (::rocksdb::FlushJobInfo const &
 
 std::vector<nano::tables> nano::store::rocksdb::component::all_tables () const
 {
-	return std::vector<nano::tables>{ tables::accounts, tables::blocks, tables::confirmation_height, tables::final_votes, tables::frontiers, tables::meta, tables::online_weight, tables::peers, tables::pending, tables::pruned, tables::vote };
+	return std::vector<nano::tables>{ tables::accounts, tables::blocks, tables::confirmation_height, tables::delegators, tables::final_votes, tables::frontiers, tables::meta, tables::online_weight, tables::peers, tables::pending, tables::pruned, tables::receivable_amounts, tables::vote };
 }
 
 bool nano::store::rocksdb::component::copy_db (std::filesystem::path const & destination_path)
@@ -982,6 +1112,11 @@ unsigned long long nano::store::rocksdb::component::base_memtable_size_bytes ()
 	return 1024ULL * 1024 * rocksdb_config.memory_multiplier * base_memtable_size;
 }
 
+unsigned long long nano::store::rocksdb::component::block_cache_size_bytes () const
+{
+	return 1024ULL * 1024 * rocksdb_config.memory_multiplier * base_block_cache_size;
+}
+
 // This is a ratio of the blocks memtable size to keep total write transaction commit size down.
 unsigned nano::store::rocksdb::component::max_block_write_batch_num () const
 {
@@ -8,6 +8,7 @@
 #include <nano/store/rocksdb/account.hpp>
 #include <nano/store/rocksdb/block.hpp>
 #include <nano/store/rocksdb/confirmation_height.hpp>
+#include <nano/store/rocksdb/delegator.hpp>
 #include <nano/store/rocksdb/final_vote.hpp>
 #include <nano/store/rocksdb/frontier.hpp>
 #include <nano/store/rocksdb/iterator.hpp>
@@ -15,6 +16,7 @@
 #include <nano/store/rocksdb/peer.hpp>
 #include <nano/store/rocksdb/pending.hpp>
 #include <nano/store/rocksdb/pruned.hpp>
+#include <nano/store/rocksdb/receivable_amount.hpp>
 #include <nano/store/rocksdb/version.hpp>
 
 #include <rocksdb/db.h>
@@ -44,24 +46,28 @@ private:
 	nano::store::rocksdb::account account_store;
 	nano::store::rocksdb::block block_store;
 	nano::store::rocksdb::confirmation_height confirmation_height_store;
+	nano::store::rocksdb::delegator delegator_store;
 	nano::store::rocksdb::final_vote final_vote_store;
 	nano::store::rocksdb::frontier frontier_store;
 	nano::store::rocksdb::online_weight online_weight_store;
 	nano::store::rocksdb::peer peer_store;
 	nano::store::rocksdb::pending pending_store;
 	nano::store::rocksdb::pruned pruned_store;
+	nano::store::rocksdb::receivable_amount receivable_amount_store;
 	nano::store::rocksdb::version version_store;
 
 public:
 	friend class nano::store::rocksdb::account;
 	friend class nano::store::rocksdb::block;
 	friend class nano::store::rocksdb::confirmation_height;
+	friend class nano::store::rocksdb::delegator;
 	friend class nano::store::rocksdb::final_vote;
 	friend class nano::store::rocksdb::frontier;
 	friend class nano::store::rocksdb::online_weight;
 	friend class nano::store::rocksdb::peer;
 	friend class nano::store::rocksdb::pending;
 	friend class nano::store::rocksdb::pruned;
+	friend class nano::store::rocksdb::receivable_amount;
 	friend class nano::store::rocksdb::version;
 
 	explicit component (nano::logger_mt &, std::filesystem::path const &, nano::ledger_constants & constants, nano::rocksdb_config const & = nano::rocksdb_config{}, bool open_read_only = false);
@@ -74,6 +80,8 @@ public:
 	uint64_t count (store::transaction const & transaction_a, tables table_a) const override;
 
 	bool exists (store::transaction const & transaction_a, tables table_a, nano::store::rocksdb::db_val const & key_a) const;
+	/** Whether any key starting with the first `prefix_size` bytes of `key` exists, uses the prefix bloom filters of the table */
+	bool exists_prefix (store::transaction const & transaction_a, tables table_a, nano::store::rocksdb::db_val const & key_a, std::size_t prefix_size) const;
 	int get (store::transaction const & transaction_a, tables table_a, nano::store::rocksdb::db_val const & key_a, nano::store::rocksdb::db_val & value_a) const;
 	int put (store::write_transaction const & transaction_a, tables table_a, nano::store::rocksdb::db_val const & key_a, nano::store::rocksdb::db_val const & value_a);
 	int del (store::write_transaction const & transaction_a, tables table_a, nano::store::rocksdb::db_val const & key_a);
@@ -88,13 +96,15 @@ public:
 	template <typename Key, typename Value>
 	store::iterator<Key, Value> make_iterator (store::transaction const & transaction_a, tables table_a, bool const direction_asc = true) const
 	{
-		return store::iterator<Key, Value> (std::make_unique<nano::store::rocksdb::iterator<Key, Value>> (db.get (), transaction_a, table_to_column_family (table_a), nullptr, direction_asc));
+		auto const start = instrumentation.start ();
+		return store::iterator<Key, Value> (std::make_unique<nano::store::rocksdb::iterator<Key, Value>> (db.get (), transaction_a, table_to_column_family (table_a), nullptr, direction_asc), instrumentation, table_a, start);
 	}
 
 	template <typename Key, typename Value>
 	store::iterator<Key, Value> make_iterator (store::transaction const & transaction_a, tables table_a, nano::store::rocksdb::db_val const & key) const
 	{
-		return store::iterator<Key, Value> (std::make_unique<nano::store::rocksdb::iterator<Key, Value>> (db.get (), transaction_a, table_to_column_family (table_a), &key, true));
+		auto const start = instrumentation.start ();
+		return store::iterator<Key, Value> (std::make_unique<nano::store::rocksdb::iterator<Key, Value>> (db.get (), transaction_a, table_to_column_family (table_a), &key, true), instrumentation, table_a, start);
 	}
 
 	bool init_error () const override;
@@ -110,6 +120,8 @@ private:
 	std::unique_ptr<::rocksdb::DB> db;
 	std::vector<std::unique_ptr<::rocksdb::ColumnFamilyHandle>> handles;
 	std::shared_ptr<::rocksdb::TableFactory> small_table_factory;
+	/** Block cache shared by the ledger tables when index and filter blocks are partitioned */
+	std::shared_ptr<::rocksdb::Cache> shared_block_cache;
 	std::unordered_map<nano::tables, nano::mutex> write_lock_mutexes;
 	nano::rocksdb_config rocksdb_config;
 	unsigned const max_block_write_batch_num_m;
@@ -151,6 +163,8 @@ private:
 
 	bool do_upgrades (store::write_transaction const &);
 	void upgrade_v21_to_v22 (store::write_transaction const &);
+	void upgrade_v22_to_v23 (store::write_transaction const &);
+	void upgrade_v23_to_v24 (store::write_transaction const &);
 
 	void construct_column_family_mutexes ();
 	::rocksdb::Options get_db_options ();
@@ -160,6 +174,7 @@ private:
 	::rocksdb::BlockBasedTableOptions get_active_table_options (std::size_t lru_size) const;
 	::rocksdb::BlockBasedTableOptions get_small_table_options () const;
 	::rocksdb::ColumnFamilyOptions get_cf_options (std::string const & cf_name_a) const;
+	void set_account_prefix_options (::rocksdb::ColumnFamilyOptions &) const;
 
 	void on_flush (::rocksdb::FlushJobInfo const &);
 	void flush_table (nano::tables table_a);
@@ -170,9 +185,12 @@ private:
 	std::vector<::rocksdb::ColumnFamilyDescriptor> create_column_families ();
 	unsigned long long base_memtable_size_bytes () const;
 	unsigned long long blocks_memtable_size_bytes () const;
+	unsigned long long block_cache_size_bytes () const;
 
 	constexpr static int base_memtable_size = 16;
 	constexpr static int base_block_cache_size = 8;
+	/** Roughly the sum of the per table block cache sizes used when caches are not shared */
+	constexpr static int shared_block_cache_multiplier = 16;
 
 	friend class nano::rocksdb_block_store_tombstone_count_Test;
 	friend class rocksdb_block_store_upgrade_v21_v22_Test;
@@ -11,6 +11,7 @@ enum class tables
 	blocks,
 	confirmation_height,
 	default_unused, // RocksDB only
+	delegators,
 	final_votes,
 	frontiers,
 	meta,
@@ -18,6 +19,7 @@ enum class tables
 	peers,
 	pending,
 	pruned,
+	receivable_amounts,
 	vote
 };
 } // namespace nano
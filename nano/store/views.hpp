@@ -0,0 +1,119 @@
+#pragma once
+
+#include <nano/lib/numbers.hpp>
+#include <nano/secure/common.hpp>
+
+#include <cstddef>
+#include <cstring>
+#include <span>
+
+namespace nano::store
+{
+/** Reads a field at `offset` of a stored value */
+template <typename T>
+T read_field (std::span<uint8_t const> bytes, std::size_t offset)
+{
+	static_assert (std::is_trivially_copyable_v<T>);
+	debug_assert (offset + sizeof (T) <= bytes.size ());
+	T result;
+	std::memcpy (&result, bytes.data () + offset, sizeof (T));
+	return result;
+}
+
+/**
+ * Fields of a stored nano::account_info, each decoded only when accessed.
+ * Account and pending info are stored as the bytes of their leading members, so fields are found at their member offsets.
+ */
+class account_info_view final
+{
+public:
+	explicit account_info_view (std::span<uint8_t const> bytes_a) :
+		bytes{ bytes_a }
+	{
+		debug_assert (bytes.size () == nano::account_info{}.db_size ());
+	}
+	nano::block_hash head () const
+	{
+		return read_field<nano::block_hash> (bytes, offsetof (nano::account_info, head));
+	}
+	nano::account representative () const
+	{
+		return read_field<nano::account> (bytes, offsetof (nano::account_info, representative));
+	}
+	nano::block_hash open_block () const
+	{
+		return read_field<nano::block_hash> (bytes, offsetof (nano::account_info, open_block));
+	}
+	nano::amount balance () const
+	{
+		return read_field<nano::amount> (bytes, offsetof (nano::account_info, balance));
+	}
+	nano::seconds_t modified () const
+	{
+		return read_field<nano::seconds_t> (bytes, offsetof (nano::account_info, modified));
+	}
+	uint64_t block_count () const
+	{
+		return read_field<uint64_t> (bytes, offsetof (nano::account_info, block_count));
+	}
+	nano::epoch epoch () const
+	{
+		return read_field<nano::epoch> (bytes, offsetof (nano::account_info, epoch_m));
+	}
+
+private:
+	std::span<uint8_t const> bytes;
+};
+
+/**
+ * Fields of a stored nano::pending_info, each decoded only when accessed
+ */
+class pending_info_view final
+{
+public:
+	explicit pending_info_view (std::span<uint8_t const> bytes_a) :
+		bytes{ bytes_a }
+	{
+		debug_assert (bytes.size () == nano::pending_info{}.db_size ());
+	}
+	nano::account source () const
+	{
+		return read_field<nano::account> (bytes, offsetof (nano::pending_info, source));
+	}
+	nano::amount amount () const
+	{
+		return read_field<nano::amount> (bytes, offsetof (nano::pending_info, amount));
+	}
+	nano::epoch epoch () const
+	{
+		return read_field<nano::epoch> (bytes, offsetof (nano::pending_info, epoch));
+	}
+
+private:
+	std::span<uint8_t const> bytes;
+};
+
+/**
+ * Fields of a stored nano::confirmation_height_info, each decoded only when accessed
+ */
+class confirmation_height_info_view final
+{
+public:
+	explicit confirmation_height_info_view (std::span<uint8_t const> bytes_a) :
+		bytes{ bytes_a }
+	{
+		debug_assert (bytes.size () == sizeof (uint64_t) + sizeof (nano::block_hash));
+	}
+	uint64_t height () const
+	{
+		return read_field<uint64_t> (bytes, 0);
+	}
+	nano::block_hash frontier () const
+	{
+		return read_field<nano::block_hash> (bytes, sizeof (uint64_t));
+	}
+
+private:
+	std::span<uint8_t const> bytes;
+};
+}